@@ -0,0 +1,122 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+// Measures KmipClientPool borrow/return throughput under thread contention.
+//
+// No server is involved: connections use a transport that does no I/O, so
+// the numbers reflect only the pool's own synchronisation.  The single-shard
+// configuration corresponds to the former one-list, one-mutex pool; the last
+// run adds the per-thread connection cache (Config::thread_affinity).
+//
+// Usage: bench_pool_contention [threads] [iterations per thread]
+//                              [max connections] [shards, 0 = automatic]
+
+#include "kmipclient/KmipClientPool.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace kmipclient;
+
+namespace {
+
+  /// Transport that connects instantly and never carries data.
+  class NullNetClient : public NetClient {
+  public:
+    NullNetClient() : NetClient("null", "0", "", "", "", 0) {}
+
+    bool connect() override {
+      m_isConnected = true;
+      return true;
+    }
+    void close() override { m_isConnected = false; }
+    int send(std::span<const std::uint8_t> data) override {
+      return static_cast<int>(data.size());
+    }
+    int recv(std::span<std::uint8_t>) override { return 0; }
+  };
+
+  double run(
+      size_t shards,
+      size_t threads,
+      size_t iterations,
+      size_t max,
+      bool affinity = false
+  ) {
+    KmipClientPool pool({
+        .max_connections = max,
+        .transport_factory =
+            [](const KmipClientPool::Config &) {
+              return std::make_unique<NullNetClient>();
+            },
+        .shards = shards,
+        .thread_affinity = affinity,
+    });
+
+    // Open every connection up front so that only borrow/return is timed.
+    {
+      std::vector<KmipClientPool::BorrowedClient> warm;
+      for (size_t i = 0; i < max; ++i) {
+        warm.push_back(pool.borrow());
+      }
+    }
+
+    std::vector<std::thread> workers;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&pool, iterations] {
+        for (size_t i = 0; i < iterations; ++i) {
+          auto conn = pool.borrow();
+          (void) conn.isHealthy();
+        }
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << "shards=" << pool.shard_count()
+              << (affinity ? " affinity=on" : "") << "  "
+              << static_cast<double>(threads * iterations) / elapsed.count()
+              << " borrows/s" << std::endl;
+    return elapsed.count();
+  }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 256;
+  const size_t iterations =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+  const size_t max = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 16;
+  const size_t shards = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 0;
+
+  std::cout << threads << " threads x " << iterations << " borrows, " << max
+            << " connections" << std::endl;
+  const double single = run(1, threads, iterations, max);
+  const double sharded = run(shards, threads, iterations, max);
+  std::cout << "speedup: " << single / sharded << "x" << std::endl;
+  const double affine = run(shards, threads, iterations, max, true);
+  std::cout << "speedup with affinity: " << single / affine << "x"
+            << std::endl;
+  return 0;
+}
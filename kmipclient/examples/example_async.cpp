@@ -0,0 +1,124 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * example_async.cpp
+ *
+ * Demonstrates AsyncKmipClient: many operations are queued from a single
+ * thread and executed concurrently over a KmipClientPool.
+ *
+ * Usage:
+ *   example_async <host> <port> <client_cert> <client_key> <server_ca_cert>
+ *                 <key_name_prefix> [num_keys] [max_pool_size]
+ *
+ * Creates num_keys AES-256 keys through futures, then fetches each created
+ * key with a completion callback.
+ */
+
+#include "kmipclient/AsyncKmipClient.hpp"
+#include "kmipclient/KmipClientPool.hpp"
+#include "kmipclient/kmipclient_version.hpp"
+
+#include <atomic>
+#include <future>
+#include <iostream>
+#include <latch>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace kmipclient;
+
+int main(int argc, char **argv) {
+  std::cout << "KMIP CLIENT version: " << KMIPCLIENT_VERSION_STR << "\n";
+
+  if (argc < 7) {
+    std::cerr
+        << "Usage: example_async <host> <port> <client_cert> <client_key> "
+           "<server_ca_cert> <key_name_prefix> [num_keys] [max_pool_size]\n";
+    return 1;
+  }
+
+  const std::string key_name_prefix = argv[6];
+  const int num_keys = argc > 7 ? std::stoi(argv[7]) : 8;
+  const int max_pool_size = argc > 8 ? std::stoi(argv[8]) : 4;
+
+  KmipClientPool pool(
+      KmipClientPool::Config{
+          .host = argv[1],
+          .port = argv[2],
+          .client_cert = argv[3],
+          .client_key = argv[4],
+          .server_ca_cert = argv[5],
+          .timeout_ms = 5000,
+          .max_connections = static_cast<size_t>(max_pool_size),
+      }
+  );
+  AsyncKmipClient async(pool);
+
+  // ------------------------------------------------------------------
+  // Queue all creations at once; the calling thread does not block here.
+  // ------------------------------------------------------------------
+  std::vector<std::future<std::string>> created;
+  created.reserve(num_keys);
+  for (int i = 0; i < num_keys; ++i) {
+    created.push_back(async.create_aes_key_async(
+        key_name_prefix + "_" + std::to_string(i), "AsyncTestGroup"
+    ));
+  }
+
+  std::vector<std::string> ids;
+  for (auto &f : created) {
+    try {
+      ids.push_back(f.get());
+    } catch (const std::exception &e) {
+      std::cerr << "create failed: " << e.what() << "\n";
+    }
+  }
+
+  // ------------------------------------------------------------------
+  // Fetch every key back, reporting through completion callbacks.
+  // ------------------------------------------------------------------
+  std::latch done(static_cast<std::ptrdiff_t>(ids.size()));
+  std::atomic<int> failures{0};
+  for (const auto &id : ids) {
+    async.get_key_async(
+        id,
+        false,
+        [&done, &failures, id](std::future<std::unique_ptr<Key>> key) {
+          std::ostringstream oss;
+          try {
+            oss << "fetched " << id << " (" << key.get()->value().size()
+                << " bytes)\n";
+            std::cout << oss.str();
+          } catch (const std::exception &e) {
+            oss << "get " << id << " failed: " << e.what() << "\n";
+            std::cerr << oss.str();
+            ++failures;
+          }
+          done.count_down();
+        }
+    );
+  }
+  done.wait();
+
+  std::cout << "Created " << ids.size() << " keys, " << failures.load()
+            << " fetch failures\n";
+  return failures.load() == 0 && static_cast<int>(ids.size()) == num_keys
+             ? 0
+             : 1;
+}
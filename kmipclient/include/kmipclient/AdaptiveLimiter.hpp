@@ -0,0 +1,112 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_ADAPTIVE_LIMITER_HPP
+#define KMIPCLIENT_ADAPTIVE_LIMITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace kmipclient {
+
+  /**
+   * @brief Concurrency limit that follows the server's round-trip latency
+   * (additive increase, multiplicative decrease).
+   *
+   * The lowest latency seen recently serves as the no-load baseline.  A
+   * sample slower than Config::tolerance times the baseline, or a failed
+   * exchange, signals congestion and multiplies the limit by
+   * Config::backoff; further congestion signals are ignored for one limit's
+   * worth of samples, since they mostly stem from the same episode.  Fast
+   * samples raise the limit by about one per limit's worth of samples, but
+   * only while callers use at least half of it.
+   *
+   * Thread-safe.
+   */
+  class AdaptiveLimiter {
+  public:
+    /** @brief Limits and sensitivity. */
+    struct Config {
+      /** Limit before the first sample. */
+      size_t initial_limit = 4;
+      /** The limit never drops below this. */
+      size_t min_limit = 1;
+      /** The limit never grows beyond this. */
+      size_t max_limit = 64;
+      /** Latency above tolerance times the baseline signals congestion;
+       * must be greater than one. */
+      double tolerance = 2.0;
+      /** Factor applied to the limit on congestion, in (0, 1). */
+      double backoff = 0.75;
+      /** Samples after which the baseline is re-learned from the latest
+       * ones, so that a server that became slower for good is not treated
+       * as congested forever. */
+      size_t baseline_window = 1000;
+    };
+
+    /** @brief Creates a limiter with the default settings. */
+    AdaptiveLimiter();
+
+    /**
+     * @param config Limits and sensitivity; initial_limit is clamped to
+     *        [min_limit, max_limit].
+     * @throws kmipcore::KmipException when a setting is out of range.
+     */
+    explicit AdaptiveLimiter(const Config &config);
+
+    /** @brief Current number of requests allowed in flight. */
+    [[nodiscard]] size_t limit() const noexcept {
+      return limit_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records a completed round trip.
+     * @param latency Time from sending the request to the response.
+     * @param in_flight Requests in flight when it completed, this one
+     *        included.
+     */
+    void on_success(
+        std::chrono::steady_clock::duration latency, size_t in_flight
+    );
+
+    /** @brief Records a round trip that failed or timed out. */
+    void on_failure();
+
+    /** @brief Current no-load latency estimate; zero before any sample. */
+    [[nodiscard]] std::chrono::microseconds baseline() const;
+
+  private:
+    /// Backs off unless still cooling down.  Called with mutex_ held.
+    void decrease();
+
+    /// Publishes estimate_ as limit_.  Called with mutex_ held.
+    void publish();
+
+    Config config_;
+    mutable std::mutex mutex_;
+    double estimate_;
+    std::atomic<size_t> limit_;
+    std::chrono::microseconds baseline_{0};
+    std::chrono::microseconds window_min_{0};
+    size_t window_samples_ = 0;
+    size_t cooldown_ = 0;  ///< samples left in which congestion is ignored
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_ADAPTIVE_LIMITER_HPP
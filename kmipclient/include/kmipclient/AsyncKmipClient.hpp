@@ -0,0 +1,349 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_ASYNC_KMIP_CLIENT_HPP
+#define KMIPCLIENT_ASYNC_KMIP_CLIENT_HPP
+
+#include "kmipclient/KmipClient.hpp"
+#include "kmipclient/KmipClientPool.hpp"
+#include "kmipclient/KmipIOException.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Asynchronous front end for KmipClient operations.
+   *
+   * Operations are queued and executed by a fixed set of worker threads, each
+   * of which borrows a connection from the supplied @ref KmipClientPool for
+   * the duration of one operation.  Callers are never blocked on network
+   * I/O: every operation is available in two flavours
+   *
+   *  - `xxx_async(args...)` returns a `std::future` with the result;
+   *  - `xxx_async(args..., done)` invokes @p done on the worker thread with a
+   *    ready `std::future`, whose get() yields the result or rethrows the
+   *    failure.
+   *
+   * Callback overloads take every optional argument of the synchronous
+   * method explicitly, followed by the callback.
+   *
+   * A connection on which an operation failed with @ref KmipIOException is
+   * marked unhealthy and discarded by the pool; server-side KMIP errors keep
+   * the connection.
+   *
+   * @code
+   *   KmipClientPool pool(config);
+   *   AsyncKmipClient async(pool);
+   *
+   *   auto id = async.create_aes_key_async("mykey", "mygroup");
+   *   async.get_key_async(
+   *       id.get(), false, [](std::future<std::unique_ptr<Key>> key) {
+   *         try {
+   *           use(key.get());
+   *         } catch (const std::exception &e) {
+   *           report(e);
+   *         }
+   *       }
+   *   );
+   * @endcode
+   */
+  class AsyncKmipClient {
+  public:
+    /** Completion callback; receives a ready future holding the outcome. */
+    template <typename T> using Callback = std::function<void(std::future<T>)>;
+
+    /**
+     * @brief Starts the worker threads.
+     * @param pool Connection pool; must outlive this object.
+     * @param worker_threads Number of operations executed concurrently; zero
+     *        selects @ref KmipClientPool::max_connections().
+     */
+    explicit AsyncKmipClient(KmipClientPool &pool, size_t worker_threads = 0);
+
+    /**
+     * @brief Completes all queued operations and joins the worker threads.
+     */
+    ~AsyncKmipClient();
+
+    // Non-copyable, non-movable (worker threads refer to this instance)
+    AsyncKmipClient(const AsyncKmipClient &) = delete;
+    AsyncKmipClient &operator=(const AsyncKmipClient &) = delete;
+    AsyncKmipClient(AsyncKmipClient &&) = delete;
+    AsyncKmipClient &operator=(AsyncKmipClient &&) = delete;
+
+    // ---- Generic submission
+    // ----------------------------------------------------
+
+    /**
+     * @brief Runs @p fn with a borrowed KmipClient on a worker thread.
+     *
+     * Useful for operation sequences that must share one connection.
+     * @throws kmipcore::KmipException when the client is shutting down.
+     */
+    template <typename F>
+    auto submit(F &&fn)
+        -> std::future<std::invoke_result_t<F &, KmipClient &>> {
+      using R = std::invoke_result_t<F &, KmipClient &>;
+      auto work = std::make_shared<std::decay_t<F>>(std::forward<F>(fn));
+      auto promise = std::make_shared<std::promise<R>>();
+      auto future = promise->get_future();
+      enqueue([this, work, promise] { fulfil(*promise, *work); });
+      return future;
+    }
+
+    /**
+     * @brief Runs @p fn with a borrowed KmipClient on a worker thread and
+     * reports the outcome to @p done.
+     *
+     * Exceptions escaping @p done are discarded.
+     * @throws kmipcore::KmipException when the client is shutting down.
+     */
+    template <typename F, typename R = std::invoke_result_t<F &, KmipClient &>>
+    void submit(F &&fn, std::type_identity_t<Callback<R>> done) {
+      auto work = std::make_shared<std::decay_t<F>>(std::forward<F>(fn));
+      enqueue([this, work, done = std::move(done)] {
+        std::promise<R> promise;
+        fulfil(promise, *work);
+        try {
+          done(promise.get_future());
+        } catch (...) {
+          // Keep the worker alive; the callback owns its error handling.
+        }
+      });
+    }
+
+    // ---- KMIP operations
+    // -------------------------------------------------------
+
+    /** @brief Asynchronous KmipClient::op_register_key(). */
+    [[nodiscard]] std::future<std::string> register_key_async(
+        const std::string &name, const std::string &group, const Key &k
+    );
+    /** @copydoc register_key_async */
+    void register_key_async(
+        const std::string &name,
+        const std::string &group,
+        const Key &k,
+        Callback<std::string> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_register_secret(). */
+    [[nodiscard]] std::future<std::string> register_secret_async(
+        const std::string &name, const std::string &group, const Secret &secret
+    );
+    /** @copydoc register_secret_async */
+    void register_secret_async(
+        const std::string &name,
+        const std::string &group,
+        const Secret &secret,
+        Callback<std::string> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_create_aes_key(). */
+    [[nodiscard]] std::future<std::string> create_aes_key_async(
+        const std::string &name,
+        const std::string &group,
+        aes_key_size key_size = aes_key_size::AES_256,
+        cryptographic_usage_mask usage_mask =
+            static_cast<cryptographic_usage_mask>(
+                kmipcore::KMIP_CRYPTOMASK_ENCRYPT |
+                kmipcore::KMIP_CRYPTOMASK_DECRYPT
+            )
+    );
+    /** @copydoc create_aes_key_async */
+    void create_aes_key_async(
+        const std::string &name,
+        const std::string &group,
+        aes_key_size key_size,
+        cryptographic_usage_mask usage_mask,
+        Callback<std::string> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_get_key(). */
+    [[nodiscard]] std::future<std::unique_ptr<Key>>
+        get_key_async(const std::string &id, bool all_attributes = false);
+    /** @copydoc get_key_async */
+    void get_key_async(
+        const std::string &id,
+        bool all_attributes,
+        Callback<std::unique_ptr<Key>> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_get_secret(). */
+    [[nodiscard]] std::future<Secret>
+        get_secret_async(const std::string &id, bool all_attributes = false);
+    /** @copydoc get_secret_async */
+    void get_secret_async(
+        const std::string &id, bool all_attributes, Callback<Secret> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_activate(). */
+    [[nodiscard]] std::future<std::string>
+        activate_async(const std::string &id);
+    /** @copydoc activate_async */
+    void activate_async(const std::string &id, Callback<std::string> done);
+
+    /** @brief Asynchronous KmipClient::op_get_attribute_list(). */
+    [[nodiscard]] std::future<std::vector<std::string>>
+        get_attribute_list_async(const std::string &id);
+    /** @copydoc get_attribute_list_async */
+    void get_attribute_list_async(
+        const std::string &id, Callback<std::vector<std::string>> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_get_attributes(). */
+    [[nodiscard]] std::future<kmipcore::Attributes> get_attributes_async(
+        const std::string &id, const std::vector<std::string> &attr_names
+    );
+    /** @copydoc get_attributes_async */
+    void get_attributes_async(
+        const std::string &id,
+        const std::vector<std::string> &attr_names,
+        Callback<kmipcore::Attributes> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_locate_by_name(). */
+    [[nodiscard]] std::future<std::vector<std::string>>
+        locate_by_name_async(const std::string &name, object_type o_type);
+    /** @copydoc locate_by_name_async */
+    void locate_by_name_async(
+        const std::string &name,
+        object_type o_type,
+        Callback<std::vector<std::string>> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_locate_by_group(). */
+    [[nodiscard]] std::future<std::vector<std::string>> locate_by_group_async(
+        const std::string &group,
+        object_type o_type,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
+    /** @copydoc locate_by_group_async */
+    void locate_by_group_async(
+        const std::string &group,
+        object_type o_type,
+        std::size_t max_ids,
+        Callback<std::vector<std::string>> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_all(). */
+    [[nodiscard]] std::future<std::vector<std::string>> all_async(
+        object_type o_type,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
+    /** @copydoc all_async */
+    void all_async(
+        object_type o_type,
+        std::size_t max_ids,
+        Callback<std::vector<std::string>> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_revoke(). */
+    [[nodiscard]] std::future<std::string> revoke_async(
+        const std::string &id,
+        revocation_reason_type reason,
+        const std::string &message,
+        time_t occurrence_time
+    );
+    /** @copydoc revoke_async */
+    void revoke_async(
+        const std::string &id,
+        revocation_reason_type reason,
+        const std::string &message,
+        time_t occurrence_time,
+        Callback<std::string> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_destroy(). */
+    [[nodiscard]] std::future<std::string> destroy_async(const std::string &id);
+    /** @copydoc destroy_async */
+    void destroy_async(const std::string &id, Callback<std::string> done);
+
+    /** @brief Asynchronous KmipClient::op_discover_versions(). */
+    [[nodiscard]] std::future<std::vector<kmipcore::ProtocolVersion>>
+        discover_versions_async();
+    /** @copydoc discover_versions_async */
+    void discover_versions_async(
+        Callback<std::vector<kmipcore::ProtocolVersion>> done
+    );
+
+    /** @brief Asynchronous KmipClient::op_query(). */
+    [[nodiscard]] std::future<KmipClient::QueryServerInfo> query_async();
+    /** @copydoc query_async */
+    void query_async(Callback<KmipClient::QueryServerInfo> done);
+
+    // ---- Diagnostic accessors
+    // --------------------------------------------------
+
+    /// Number of operations queued but not yet picked up by a worker.
+    [[nodiscard]] size_t pending_count() const;
+
+    /// Number of worker threads.
+    [[nodiscard]] size_t worker_count() const noexcept {
+      return workers_.size();
+    }
+
+  private:
+    /// Queues @p task; throws when the client is shutting down.
+    void enqueue(std::function<void()> task);
+
+    /// Worker thread body.
+    void run_worker();
+
+    /// Runs @p fn on a borrowed connection and stores the outcome.
+    template <typename R, typename F>
+    void fulfil(std::promise<R> &promise, F &fn) noexcept {
+      try {
+        auto conn = pool_.borrow();
+        try {
+          if constexpr (std::is_void_v<R>) {
+            fn(*conn);
+            promise.set_value();
+          } else {
+            promise.set_value(fn(*conn));
+          }
+        } catch (const KmipIOException &) {
+          conn.markUnhealthy();
+          throw;
+        }
+      } catch (...) {
+        promise.set_exception(std::current_exception());
+      }
+    }
+
+    KmipClientPool &pool_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_ASYNC_KMIP_CLIENT_HPP
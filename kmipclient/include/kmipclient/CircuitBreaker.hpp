@@ -0,0 +1,164 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_CIRCUIT_BREAKER_HPP
+#define KMIPCLIENT_CIRCUIT_BREAKER_HPP
+
+#include "kmipclient/KmipIOException.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+
+namespace kmipclient {
+
+  /**
+   * Thrown instead of connecting while a @ref CircuitBreaker is open.
+   * Nothing was sent to the server.
+   */
+  class KmipCircuitOpenException : public KmipIOException {
+  public:
+    /**
+     * @brief Creates the exception with a message.
+     * @param msg Human-readable error description.
+     */
+    explicit KmipCircuitOpenException(const std::string &msg)
+      : KmipIOException(kmipcore::KMIP_IO_FAILURE, msg) {}
+  };
+
+  /**
+   * @brief Fails calls to an unreachable endpoint fast instead of letting
+   * each of them wait for its own connection attempt.
+   *
+   * The breaker is @c closed while the endpoint works.  After
+   * Config::failure_threshold consecutive failures it opens: calls are
+   * refused, and after Config::open_duration a single probe (run by the
+   * owner, see begin_probe()) checks the endpoint.  While the probe runs the
+   * breaker is @c half_open.  A successful probe closes the breaker; a failed
+   * one reopens it and doubles the wait before the next probe, up to
+   * Config::max_backoff, each wait randomised by Config::jitter so that many
+   * clients do not probe in lockstep.
+   *
+   * Thread-safe.
+   */
+  class CircuitBreaker {
+  public:
+    /** @brief Breaker state. */
+    enum class State {
+      closed,     ///< calls are admitted
+      open,       ///< calls are refused until a probe succeeds
+      half_open,  ///< calls are refused; a probe is in progress
+    };
+
+    /** @brief Called after every state change, outside internal locks. */
+    using Listener = std::function<void(State from, State to)>;
+
+    /** Default number of consecutive failures that open the breaker. */
+    static constexpr unsigned DEFAULT_FAILURE_THRESHOLD = 5;
+
+    /** @brief Thresholds and backoff. */
+    struct Config {
+      /** Consecutive failures after which the breaker opens. */
+      unsigned failure_threshold = DEFAULT_FAILURE_THRESHOLD;
+      /** Wait before the first probe after opening. */
+      std::chrono::milliseconds open_duration{1000};
+      /** Upper bound of the wait between failed probes. */
+      std::chrono::milliseconds max_backoff{30000};
+      /** Each wait is varied randomly by up to this fraction, in [0, 1). */
+      double jitter = 0.2;
+      /** Notified of state changes, e.g. for logging or metrics. */
+      Listener listener;
+    };
+
+    /** @brief Creates a closed breaker with the default settings. */
+    CircuitBreaker();
+
+    /**
+     * @param config Thresholds and backoff.
+     * @throws kmipcore::KmipException when a setting is out of range.
+     */
+    explicit CircuitBreaker(Config config);
+
+    /** @brief Current state. */
+    [[nodiscard]] State state() const noexcept {
+      return state_.load(std::memory_order_acquire);
+    }
+
+    /** @brief True while calls are admitted. */
+    [[nodiscard]] bool allows() const noexcept {
+      return state() == State::closed;
+    }
+
+    /** @brief Records a successful call; resets the failure count. */
+    void on_success();
+
+    /** @brief Records a failed call; may open the breaker. */
+    void on_failure();
+
+    /**
+     * @brief Time at which the next probe is due.
+     * @return std::nullopt unless the breaker is open.
+     */
+    [[nodiscard]] std::optional<std::chrono::steady_clock::time_point>
+        probe_due() const;
+
+    /**
+     * @brief Moves an open breaker whose probe is due to half_open.
+     * @return true when the caller must now probe and call end_probe().
+     */
+    bool begin_probe(std::chrono::steady_clock::time_point now);
+
+    /** @brief Closes the breaker, or reopens it with a longer wait. */
+    void end_probe(bool success);
+
+    /** @brief Number of times the breaker has opened. */
+    [[nodiscard]] std::uint64_t opens() const noexcept {
+      return opens_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Lower-case name of @p state, e.g. for log messages. */
+    [[nodiscard]] static const char *to_string(State state) noexcept;
+
+  private:
+    /// Opens the breaker and schedules the next probe after @p wait.
+    /// Called with mutex_ held.
+    void open(std::chrono::milliseconds wait);
+
+    /// Changes state under mutex_; returns the previous one.
+    State set_state(State state) noexcept;
+
+    /// Invokes the listener for a change from @p from to @p to.
+    void notify(State from, State to) const;
+
+    Config config_;
+    std::atomic<State> state_{State::closed};
+    std::atomic<std::uint64_t> opens_{0};
+
+    mutable std::mutex mutex_;
+    unsigned failures_ = 0;
+    std::chrono::milliseconds backoff_{0};
+    std::chrono::steady_clock::time_point probe_at_{};
+    std::minstd_rand random_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_CIRCUIT_BREAKER_HPP
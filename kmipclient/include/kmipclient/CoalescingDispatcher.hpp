@@ -0,0 +1,155 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_COALESCING_DISPATCHER_HPP
+#define KMIPCLIENT_COALESCING_DISPATCHER_HPP
+
+#include "kmipclient/KmipClientPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Packs concurrently submitted operations into shared KMIP batches.
+   *
+   * Operations submitted from any thread are collected for at most
+   * Config::window (or until Config::max_operations are pending) and then
+   * sent as one request message with one batch item group per operation.
+   * Results are fanned back out to each caller's future by Unique Batch Item
+   * Id, so a failure of one operation does not affect the others.
+   *
+   * Batches are executed by Config::workers threads, each borrowing one
+   * connection from the pool per batch.  The request header asks the server
+   * to continue after a failed batch item; servers that stop anyway report
+   * the remaining items as missing and only those operations fail.
+   *
+   * Under KMIP 2.0, a Get whose attribute selectors are rejected by the
+   * server is retried individually with KmipClient::op_get_key() /
+   * op_get_secret(), which carry the full compatibility fallback chain.
+   *
+   * @code
+   *   CoalescingDispatcher dispatcher(pool, {.window = 200us});
+   *   // From many threads:
+   *   auto key = dispatcher.get_key(id).get();
+   * @endcode
+   */
+  class CoalescingDispatcher {
+  public:
+    /** Default time operations may wait for companions. */
+    static constexpr std::chrono::microseconds DEFAULT_WINDOW{200};
+    /** Default upper bound of operations packed into one message. */
+    static constexpr size_t DEFAULT_MAX_OPERATIONS = 32;
+
+    /** @brief Batching settings. */
+    struct Config {
+      /** Maximum delay between the first pending operation and its send. */
+      std::chrono::microseconds window = DEFAULT_WINDOW;
+      /** A batch is sent immediately once this many operations wait. */
+      size_t max_operations = DEFAULT_MAX_OPERATIONS;
+      /** Batches in flight at once; zero selects the pool capacity. */
+      size_t workers = 0;
+    };
+
+    /**
+     * @brief Starts the batching workers with default settings.
+     * @param pool Connection pool; must outlive the dispatcher.
+     */
+    explicit CoalescingDispatcher(KmipClientPool &pool);
+
+    /**
+     * @brief Starts the batching workers.
+     * @param pool Connection pool; must outlive the dispatcher.
+     * @param config Batching settings.
+     * @throws kmipcore::KmipException when max_operations is zero.
+     */
+    CoalescingDispatcher(KmipClientPool &pool, const Config &config);
+
+    /** @brief Sends all pending operations and joins the workers. */
+    ~CoalescingDispatcher();
+
+    // Non-copyable, non-movable (workers refer to this instance)
+    CoalescingDispatcher(const CoalescingDispatcher &) = delete;
+    CoalescingDispatcher &operator=(const CoalescingDispatcher &) = delete;
+    CoalescingDispatcher(CoalescingDispatcher &&) = delete;
+    CoalescingDispatcher &operator=(CoalescingDispatcher &&) = delete;
+
+    /** @brief Coalesced KmipClient::op_get_key(). */
+    [[nodiscard]] std::future<std::unique_ptr<Key>>
+        get_key(const std::string &id, bool all_attributes = false);
+
+    /** @brief Coalesced KmipClient::op_get_secret(). */
+    [[nodiscard]] std::future<Secret>
+        get_secret(const std::string &id, bool all_attributes = false);
+
+    /** @brief Coalesced KmipClient::op_activate(). */
+    [[nodiscard]] std::future<std::string> activate(const std::string &id);
+
+    /** @brief Coalesced KmipClient::op_destroy(). */
+    [[nodiscard]] std::future<std::string> destroy(const std::string &id);
+
+    /// Number of operations waiting to be sent.
+    [[nodiscard]] size_t pending_count() const;
+
+    /// Number of request messages sent so far.
+    [[nodiscard]] std::uint64_t messages_sent() const noexcept {
+      return messages_sent_.load(std::memory_order_relaxed);
+    }
+
+    /// Number of operations completed (successfully or not) so far.
+    [[nodiscard]] std::uint64_t operations_completed() const noexcept {
+      return operations_completed_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Operation;
+    template <typename T> struct TypedOperation;
+
+    /// Queues @p op; throws when the dispatcher is shutting down.
+    void enqueue(std::unique_ptr<Operation> op);
+
+    /// Worker thread body.
+    void run_worker();
+
+    /// Sends one batch and completes every operation in it.
+    void execute(std::vector<std::unique_ptr<Operation>> batch) noexcept;
+
+    KmipClientPool &pool_;
+    Config config_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::unique_ptr<Operation>> pending_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    std::atomic<std::uint64_t> messages_sent_{0};
+    std::atomic<std::uint64_t> operations_completed_{0};
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_COALESCING_DISPATCHER_HPP
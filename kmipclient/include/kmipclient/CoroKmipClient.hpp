@@ -0,0 +1,282 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_CORO_KMIP_CLIENT_HPP
+#define KMIPCLIENT_CORO_KMIP_CLIENT_HPP
+
+#include "kmipclient/KmipClient.hpp"
+#include "kmipclient/Reactor.hpp"
+#include "kmipclient/Task.hpp"
+#include "kmipcore/response_parser.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Coroutine KMIP client on non-blocking connections.
+   *
+   * Every operation is a Task that sends its request and reads the response
+   * with NetClient::send_nonblocking() / recv_nonblocking(), slicing the
+   * response out of a read-ahead buffer.  Whenever the socket is not ready
+   * the coroutine is suspended and the @ref Reactor resumes it, so no thread
+   * is held while a request is on the wire: a few reactor threads can drive
+   * thousands of operations, of which max_connections are exchanged at a
+   * time and the rest wait, suspended, for a free connection.
+   *
+   * Connecting is the exception: connections are opened on first use and
+   * after a failure with the transport's blocking connect(), on the thread
+   * that runs the coroutine.  After a transport error the connection is
+   * closed and the operation fails; requests are not resent.
+   *
+   * Continuations run on the reactor thread once an operation had to wait;
+   * the object and the reactor must outlive every operation.
+   *
+   * @code
+   *   Task<void> rotate(CoroKmipClient &kmip, std::string old_id) {
+   *     auto new_id = co_await kmip.create_aes_key("k", "g");
+   *     co_await kmip.activate(new_id);
+   *     co_await kmip.revoke(
+   *         old_id, KMIP_REVOKE_CESSATION_OF_OPERATION, "rotated", 0
+   *     );
+   *   }
+   *
+   *   PollReactor reactor;
+   *   std::thread loop([&reactor] { reactor.run(); });
+   *   CoroKmipClient kmip(reactor, {.transport_factory = make_transport});
+   *   spawn(rotate(kmip, id)).get();
+   * @endcode
+   */
+  class CoroKmipClient {
+  public:
+    /** Default number of connections opened at most. */
+    static constexpr std::size_t DEFAULT_MAX_CONNECTIONS = 4;
+
+    /**
+     * @brief Creates an unconnected transport for one connection.
+     *
+     * The transport must support the non-blocking calls, as
+     * @ref NetClientOpenSSL, @ref NetClientTcp and @ref NetClientUnix do.
+     */
+    using TransportFactory = std::function<std::unique_ptr<NetClient>()>;
+
+    /** @brief Settings used to construct @ref CoroKmipClient. */
+    struct Config {
+      /** Creates the transports; required. */
+      TransportFactory transport_factory;
+      /** Connections opened at most; further operations wait for one. */
+      std::size_t max_connections = DEFAULT_MAX_CONNECTIONS;
+      /** KMIP protocol version of every request. */
+      kmipcore::ProtocolVersion version = kmipcore::KMIP_VERSION_1_4;
+      /** Longest wait for the socket within one exchange; zero waits
+       * without limit. */
+      std::chrono::milliseconds io_timeout{5000};
+      /** Server capabilities shared with other clients, such as the Get
+       * Attributes encoding; may be empty. */
+      std::shared_ptr<ServerProfile> server_profile;
+    };
+
+    /**
+     * @brief Asynchronous generator over paged Locate results.
+     *
+     * Each next() issues one Locate request for the following page.  Paging
+     * goes on while the server's Located Items count says more objects
+     * remain, or, without a count, until an empty page; it also stops after
+     * @p max_ids identifiers.  Short pages do not end it, since servers may
+     * cap Maximum Items below the page size.  The object must outlive every
+     * awaited next() call.
+     *
+     * @code
+     *   auto pages = kmip.locate_pages("group", KMIP_OBJTYPE_SYMMETRIC_KEY);
+     *   while (auto page = co_await pages.next()) {
+     *     for (const auto &id : *page) { ... }
+     *   }
+     * @endcode
+     */
+    class LocatePages {
+    public:
+      /** @brief Fetches the next page of identifiers. */
+      [[nodiscard]] Task<std::optional<std::vector<std::string>>> next();
+
+      /** @brief Number of identifiers produced so far. */
+      [[nodiscard]] std::size_t produced() const noexcept { return offset_; }
+
+    private:
+      friend class CoroKmipClient;
+
+      LocatePages(
+          CoroKmipClient &client,
+          std::string group,
+          object_type o_type,
+          std::size_t page_size,
+          std::size_t max_ids
+      );
+
+      CoroKmipClient *client_;
+      std::string group_;
+      object_type o_type_;
+      std::size_t page_size_;
+      std::size_t max_ids_;
+      std::size_t offset_ = 0;
+      std::optional<std::size_t> located_items_;
+      bool finished_ = false;
+    };
+
+    /**
+     * @brief Creates the client; no connection is opened yet.
+     * @param reactor Resumes suspended operations; must outlive this object.
+     * @throws kmipcore::KmipException when the transport factory is missing
+     *         or max_connections is zero.
+     */
+    CoroKmipClient(Reactor &reactor, Config config);
+    ~CoroKmipClient();
+
+    CoroKmipClient(const CoroKmipClient &) = delete;
+    CoroKmipClient &operator=(const CoroKmipClient &) = delete;
+    CoroKmipClient(CoroKmipClient &&) = delete;
+    CoroKmipClient &operator=(CoroKmipClient &&) = delete;
+
+    /** @brief Creates an empty request with the configured version. */
+    [[nodiscard]] kmipcore::RequestMessage make_request_message() const {
+      return kmipcore::RequestMessage(config_.version);
+    }
+
+    /**
+     * @brief Sends a prepared request message and reads its response.
+     *
+     * The returned bytes are normally decoded with kmipcore::ResponseParser
+     * constructed from the same request.
+     * @throws KmipIOException on transport failure or timeout.
+     */
+    [[nodiscard]] Task<std::vector<uint8_t>>
+        exchange(kmipcore::RequestMessage request);
+
+    /** @brief Awaitable KmipClient::op_create_aes_key(). */
+    [[nodiscard]] Task<std::string> create_aes_key(
+        std::string name,
+        std::string group,
+        aes_key_size key_size = aes_key_size::AES_256,
+        cryptographic_usage_mask usage_mask =
+            static_cast<cryptographic_usage_mask>(
+                kmipcore::KMIP_CRYPTOMASK_ENCRYPT |
+                kmipcore::KMIP_CRYPTOMASK_DECRYPT
+            )
+    );
+
+    /** @brief Awaitable KmipClient::op_get_key(), with the same Get
+     * Attributes encoding fallbacks. */
+    [[nodiscard]] Task<std::unique_ptr<Key>>
+        get_key(std::string id, bool all_attributes = false);
+
+    /** @brief Awaitable KmipClient::op_get_secret(). */
+    [[nodiscard]] Task<Secret>
+        get_secret(std::string id, bool all_attributes = false);
+
+    /** @brief Awaitable KmipClient::op_activate(). */
+    [[nodiscard]] Task<std::string> activate(std::string id);
+
+    /** @brief Awaitable KmipClient::op_get_attribute_list(). */
+    [[nodiscard]] Task<std::vector<std::string>>
+        get_attribute_list(std::string id);
+
+    /** @brief All identifiers of @p group, read page by page as
+     * locate_pages() does. */
+    [[nodiscard]] Task<std::vector<std::string>> locate_by_group(
+        std::string group,
+        object_type o_type,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
+
+    /**
+     * @brief Paged Locate by object group as an asynchronous generator.
+     * @param group Group name to match; empty string disables filtering.
+     * @param o_type KMIP object type to search.
+     * @param page_size Identifiers requested per Locate round trip.
+     * @param max_ids Upper bound on identifiers produced overall.
+     */
+    [[nodiscard]] LocatePages locate_pages(
+        std::string group,
+        object_type o_type,
+        std::size_t page_size = MAX_ITEMS_IN_BATCH,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
+
+    /** @brief Awaitable KmipClient::op_revoke(). */
+    [[nodiscard]] Task<std::string> revoke(
+        std::string id,
+        revocation_reason_type reason,
+        std::string message,
+        time_t occurrence_time
+    );
+
+    /** @brief Awaitable KmipClient::op_destroy(). */
+    [[nodiscard]] Task<std::string> destroy(std::string id);
+
+  private:
+    struct Connection;
+    class Acquire;
+    class Lease;
+    class Ready;
+
+    struct Page {
+      std::vector<std::string> ids;
+      std::optional<std::size_t> located_items;
+    };
+
+    /// One Locate page of @p group.
+    [[nodiscard]] Task<Page> locate_page(
+        std::string group,
+        object_type o_type,
+        std::size_t offset,
+        std::size_t page_size
+    );
+
+    /// Get and Get Attributes of @p id, decoded by @p decode, falling back
+    /// through the Get Attributes encodings like KmipClient does.
+    template <typename Decode>
+    [[nodiscard]] Task<std::invoke_result_t<
+        Decode &,
+        kmipcore::ResponseParser &,
+        uint32_t,
+        uint32_t>>
+        get_with_attributes(
+            std::string id, std::vector<std::string> selectors, Decode decode
+        );
+
+    /// Returns @p connection to the idle list or hands it to a waiter.
+    void release(Connection *connection) noexcept;
+
+    Reactor &reactor_;
+    Config config_;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Connection>> connections_;
+    std::vector<Connection *> idle_;
+    std::deque<Acquire *> waiters_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_CORO_KMIP_CLIENT_HPP
@@ -0,0 +1,271 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_CORO_POOL_BRIDGE_HPP
+#define KMIPCLIENT_CORO_POOL_BRIDGE_HPP
+
+#include "kmipclient/AsyncKmipClient.hpp"
+#include "kmipclient/Task.hpp"
+
+#include <coroutine>
+#include <functional>
+#include <future>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Bridge from coroutines to the blocking connection pool.
+   *
+   * Offers co_await versions of the KmipClient operations without any
+   * non-blocking I/O: each operation is handed to an @ref AsyncKmipClient,
+   * one of whose worker threads borrows a pooled connection and performs the
+   * usual blocking exchange.  Only the awaiting coroutine is suspended and
+   * free of a thread meanwhile; the operation itself occupies a worker and a
+   * connection until the response arrives, so operations in flight are
+   * bounded by the AsyncKmipClient workers and the pool size.  See
+   * @ref CoroKmipClient for operations on non-blocking connections.
+   *
+   * When the operation completes, the coroutine is resumed through the
+   * configured @ref Executor, or directly on the worker thread when no
+   * executor is set.
+   *
+   * @code
+   *   Task<void> rotate(CoroPoolBridge &kmip, std::string old_id) {
+   *     auto new_id = co_await kmip.create_aes_key("k", "g");
+   *     co_await kmip.activate(new_id);
+   *     co_await kmip.revoke(
+   *         old_id, KMIP_REVOKE_CESSATION_OF_OPERATION, "rotated", 0
+   *     );
+   *   }
+   *
+   *   auto done = spawn(rotate(kmip, id));
+   * @endcode
+   */
+  class CoroPoolBridge {
+  public:
+    /**
+     * @brief Awaitable for one operation; produced by CoroPoolBridge methods.
+     *
+     * co_await yields the operation result or rethrows its exception.
+     */
+    template <typename T> class Operation {
+    public:
+      Operation(Operation &&) noexcept = default;
+      Operation &operator=(Operation &&) noexcept = default;
+      Operation(const Operation &) = delete;
+      Operation &operator=(const Operation &) = delete;
+
+      [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+      void await_suspend(std::coroutine_handle<> awaiting) {
+        auto launch = std::move(launch_);
+        // The callback may run (and resume the coroutine) before launch()
+        // returns, so nothing may touch *this after this call.
+        launch([this, awaiting](std::future<T> result) {
+          result_.emplace(std::move(result));
+          if (executor_ != nullptr) {
+            executor_->post([awaiting] { awaiting.resume(); });
+          } else {
+            awaiting.resume();
+          }
+        });
+      }
+
+      T await_resume() { return result_->get(); }
+
+    private:
+      friend class CoroPoolBridge;
+
+      using Launch = std::function<void(AsyncKmipClient::Callback<T>)>;
+
+      Operation(Launch launch, Executor *executor)
+        : launch_(std::move(launch)), executor_(executor) {}
+
+      Launch launch_;
+      Executor *executor_;
+      std::optional<std::future<T>> result_;
+    };
+
+    /**
+     * @brief Asynchronous generator over paged Locate results.
+     *
+     * Each next() issues one Locate request for the following page.  Paging
+     * goes on while the server's Located Items count says more objects
+     * remain, or, without a count, until an empty page; it also stops after
+     * @p max_ids identifiers.  Short pages do not end it, since servers may
+     * cap Maximum Items below the page size.  The object must outlive every
+     * awaited next() call.
+     *
+     * @code
+     *   auto pages = kmip.locate_pages("group", KMIP_OBJTYPE_SYMMETRIC_KEY);
+     *   while (auto page = co_await pages.next()) {
+     *     for (const auto &id : *page) { ... }
+     *   }
+     * @endcode
+     */
+    class LocatePages {
+    public:
+      /** @brief Fetches the next page of identifiers. */
+      [[nodiscard]] Task<std::optional<std::vector<std::string>>> next();
+
+      /** @brief Number of identifiers produced so far. */
+      [[nodiscard]] std::size_t produced() const noexcept { return offset_; }
+
+    private:
+      friend class CoroPoolBridge;
+
+      LocatePages(
+          CoroPoolBridge &client,
+          std::string group,
+          object_type o_type,
+          std::size_t page_size,
+          std::size_t max_ids
+      );
+
+      CoroPoolBridge *client_;
+      std::string group_;
+      object_type o_type_;
+      std::size_t page_size_;
+      std::size_t max_ids_;
+      std::size_t offset_ = 0;
+      std::optional<std::size_t> located_items_;
+      bool finished_ = false;
+    };
+
+    /**
+     * @brief Creates the coroutine front end.
+     * @param async Executes the operations; must outlive this object.
+     * @param executor Where suspended coroutines are resumed; nullptr resumes
+     *        them on the AsyncKmipClient worker thread.  Must outlive this
+     *        object when set.
+     */
+    explicit CoroPoolBridge(
+        AsyncKmipClient &async, Executor *executor = nullptr
+    ) noexcept
+      : async_(async), executor_(executor) {}
+
+    /**
+     * @brief Awaitable running @p fn with a borrowed KmipClient.
+     *
+     * All calls made by @p fn use the same connection.
+     */
+    template <typename F, typename R = std::invoke_result_t<F &, KmipClient &>>
+    [[nodiscard]] Operation<R> run(F fn) {
+      return Operation<R>(
+          [async = &async_, fn = std::move(fn)](
+              AsyncKmipClient::Callback<R> done
+          ) { async->submit(fn, std::move(done)); },
+          executor_
+      );
+    }
+
+    /** @brief Awaitable KmipClient::op_register_key(). */
+    [[nodiscard]] Operation<std::string> register_key(
+        const std::string &name, const std::string &group, const Key &k
+    );
+
+    /** @brief Awaitable KmipClient::op_register_secret(). */
+    [[nodiscard]] Operation<std::string> register_secret(
+        const std::string &name, const std::string &group, const Secret &secret
+    );
+
+    /** @brief Awaitable KmipClient::op_create_aes_key(). */
+    [[nodiscard]] Operation<std::string> create_aes_key(
+        const std::string &name,
+        const std::string &group,
+        aes_key_size key_size = aes_key_size::AES_256,
+        cryptographic_usage_mask usage_mask =
+            static_cast<cryptographic_usage_mask>(
+                kmipcore::KMIP_CRYPTOMASK_ENCRYPT |
+                kmipcore::KMIP_CRYPTOMASK_DECRYPT
+            )
+    );
+
+    /** @brief Awaitable KmipClient::op_get_key(). */
+    [[nodiscard]] Operation<std::unique_ptr<Key>>
+        get_key(const std::string &id, bool all_attributes = false);
+
+    /** @brief Awaitable KmipClient::op_get_secret(). */
+    [[nodiscard]] Operation<Secret>
+        get_secret(const std::string &id, bool all_attributes = false);
+
+    /** @brief Awaitable KmipClient::op_activate(). */
+    [[nodiscard]] Operation<std::string> activate(const std::string &id);
+
+    /** @brief Awaitable KmipClient::op_get_attribute_list(). */
+    [[nodiscard]] Operation<std::vector<std::string>>
+        get_attribute_list(const std::string &id);
+
+    /** @brief Awaitable KmipClient::op_get_attributes(). */
+    [[nodiscard]] Operation<kmipcore::Attributes> get_attributes(
+        const std::string &id, const std::vector<std::string> &attr_names
+    );
+
+    /** @brief Awaitable KmipClient::op_locate_by_name(). */
+    [[nodiscard]] Operation<std::vector<std::string>>
+        locate_by_name(const std::string &name, object_type o_type);
+
+    /** @brief Awaitable KmipClient::op_locate_by_group(). */
+    [[nodiscard]] Operation<std::vector<std::string>> locate_by_group(
+        const std::string &group,
+        object_type o_type,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
+
+    /**
+     * @brief Paged Locate by object group as an asynchronous generator.
+     * @param group Group name to match; empty string disables filtering.
+     * @param o_type KMIP object type to search.
+     * @param page_size Identifiers requested per Locate round trip.
+     * @param max_ids Upper bound on identifiers produced overall.
+     */
+    [[nodiscard]] LocatePages locate_pages(
+        const std::string &group,
+        object_type o_type,
+        std::size_t page_size = MAX_ITEMS_IN_BATCH,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
+
+    /** @brief Awaitable KmipClient::op_revoke(). */
+    [[nodiscard]] Operation<std::string> revoke(
+        const std::string &id,
+        revocation_reason_type reason,
+        const std::string &message,
+        time_t occurrence_time
+    );
+
+    /** @brief Awaitable KmipClient::op_destroy(). */
+    [[nodiscard]] Operation<std::string> destroy(const std::string &id);
+
+    /** @brief Awaitable KmipClient::op_discover_versions(). */
+    [[nodiscard]] Operation<std::vector<kmipcore::ProtocolVersion>>
+        discover_versions();
+
+    /** @brief Awaitable KmipClient::op_query(). */
+    [[nodiscard]] Operation<KmipClient::QueryServerInfo> query();
+
+  private:
+    AsyncKmipClient &async_;
+    Executor *executor_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_CORO_POOL_BRIDGE_HPP
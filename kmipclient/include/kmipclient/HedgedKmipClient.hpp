@@ -0,0 +1,308 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_HEDGED_KMIP_CLIENT_HPP
+#define KMIPCLIENT_HEDGED_KMIP_CLIENT_HPP
+
+#include "kmipclient/KmipClusterPool.hpp"
+#include "kmipclient/LatencyTracker.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Hedged execution of idempotent reads over a KmipClusterPool.
+   *
+   * Every call is first sent on one connection.  If it has not completed
+   * after the configured percentile of recently observed latencies (or it
+   * failed at the I/O level), the same operation is sent once more on a
+   * connection to a different node, and whichever attempt succeeds first is
+   * returned.  With a single-node cluster the hedge uses a second connection
+   * to the same node.
+   *
+   * Attempts run on the client's worker threads.  The losing attempt is not
+   * interrupted: it completes in the background, its result is discarded and
+   * its connection is returned to the pool as usual.  The destructor waits
+   * for such attempts.
+   *
+   * The percentile is recomputed every Config::refresh_samples successful
+   * attempts, so starting a call does not sort the latency window.
+   *
+   * Hedges are limited to roughly Config::max_hedge_ratio of all calls so an
+   * overloaded cluster does not receive twice the traffic.
+   *
+   * Only use this for operations that may safely run twice (Get, Get
+   * Attributes, Locate).
+   */
+  class HedgedKmipClient {
+  public:
+    /** @brief Hedging policy. */
+    struct Config {
+      /** Latency quantile after which a hedge is sent, e.g. 0.95 for p95. */
+      double percentile = 0.95;
+      /** Hedge delay used until min_samples latencies were observed. */
+      std::chrono::milliseconds initial_delay{100};
+      /** Lower bound of the hedge delay. */
+      std::chrono::milliseconds min_delay{1};
+      /** Samples required before the percentile is trusted. */
+      size_t min_samples = 20;
+      /** Latency samples between recomputations of the hedge delay. */
+      size_t refresh_samples = 16;
+      /** Upper bound of hedges per call, averaged over all calls. */
+      double max_hedge_ratio = 0.1;
+      /** Worker threads; zero selects the cluster's connection limit. */
+      size_t workers = 0;
+    };
+
+    /**
+     * @brief Starts the worker threads with the default policy.
+     * @param cluster Connection source; must outlive this object.
+     */
+    explicit HedgedKmipClient(KmipClusterPool &cluster);
+
+    /**
+     * @brief Starts the worker threads.
+     * @param cluster Connection source; must outlive this object.
+     * @param config Hedging policy.
+     * @throws kmipcore::KmipException when a setting is out of range.
+     */
+    HedgedKmipClient(KmipClusterPool &cluster, const Config &config);
+
+    /** @brief Waits for outstanding attempts and joins the workers. */
+    ~HedgedKmipClient();
+
+    // Non-copyable, non-movable (workers refer to this instance)
+    HedgedKmipClient(const HedgedKmipClient &) = delete;
+    HedgedKmipClient &operator=(const HedgedKmipClient &) = delete;
+    HedgedKmipClient(HedgedKmipClient &&) = delete;
+    HedgedKmipClient &operator=(HedgedKmipClient &&) = delete;
+
+    /**
+     * @brief Runs @p fn with hedging and returns the first successful result.
+     *
+     * @p fn may be invoked twice, concurrently, on different connections,
+     * and may still be running after execute() returned; it must not refer
+     * to the caller's locals.
+     *
+     * A KMIP error reported by a server is returned at once.  When every
+     * attempt fails at the I/O level, the last such error is rethrown.
+     */
+    template <typename F, typename R = std::invoke_result_t<F &, KmipClient &>>
+    R execute(F fn) {
+      auto race = std::make_shared<Race<R>>();
+      auto op = std::make_shared<F>(std::move(fn));
+      const auto attempt = [this, race, op](size_t index) {
+        run_attempt<R>(
+            *race, index, [op](KmipClient &c) { return (*op)(c); }
+        );
+      };
+
+      requests_.fetch_add(1, std::memory_order_relaxed);
+      race->launched = 1;
+      post([attempt] { attempt(0); });
+
+      std::unique_lock<std::mutex> lk(race->mutex);
+      race->cv.wait_for(lk, hedge_delay(), [&] {
+        return race->settled() || race->finished == race->launched;
+      });
+      if (!race->settled() && take_hedge_budget()) {
+        race->launched = 2;
+        lk.unlock();
+        post([attempt] { attempt(1); });
+        lk.lock();
+      }
+      race->cv.wait(lk, [&] {
+        return race->settled() || race->finished == race->launched;
+      });
+
+      if (race->value) {
+        if (race->winner == 1) {
+          hedge_wins_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return std::move(*race->value);
+      }
+      std::rethrow_exception(race->error);
+    }
+
+    /** @brief Hedged KmipClient::op_get_key(). */
+    [[nodiscard]] std::unique_ptr<Key>
+        get_key(const std::string &id, bool all_attributes = false);
+
+    /** @brief Hedged KmipClient::op_get_secret(). */
+    [[nodiscard]] Secret
+        get_secret(const std::string &id, bool all_attributes = false);
+
+    /** @brief Hedged KmipClient::op_get_attributes(). */
+    [[nodiscard]] kmipcore::Attributes get_attributes(
+        const std::string &id, const std::vector<std::string> &attr_names
+    );
+
+    /** @brief Hedged KmipClient::op_locate_by_name(). */
+    [[nodiscard]] std::vector<std::string>
+        locate_by_name(const std::string &name, object_type o_type);
+
+    /** @brief Hedged KmipClient::op_locate_by_group(). */
+    [[nodiscard]] std::vector<std::string> locate_by_group(
+        const std::string &group,
+        object_type o_type,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
+
+    /// Delay after which the next call would be hedged.
+    [[nodiscard]] std::chrono::microseconds hedge_delay() const noexcept {
+      return std::chrono::microseconds(
+          hedge_delay_us_.load(std::memory_order_relaxed)
+      );
+    }
+
+    /// Latencies of successful attempts.
+    [[nodiscard]] const LatencyTracker &latencies() const noexcept {
+      return latencies_;
+    }
+
+    /// Number of execute() calls so far.
+    [[nodiscard]] std::uint64_t requests() const noexcept {
+      return requests_.load(std::memory_order_relaxed);
+    }
+
+    /// Number of hedge attempts sent so far.
+    [[nodiscard]] std::uint64_t hedges_sent() const noexcept {
+      return hedges_sent_.load(std::memory_order_relaxed);
+    }
+
+    /// Number of calls answered by the hedge rather than the first attempt.
+    [[nodiscard]] std::uint64_t hedge_wins() const noexcept {
+      return hedge_wins_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    /// Shared by the caller and both attempts of one execute() call.
+    template <typename R> struct Race {
+      std::mutex mutex;
+      std::condition_variable cv;
+      std::optional<R> value;
+      std::exception_ptr error;
+      bool server_error = false;  ///< a server answered with a KMIP error
+      size_t launched = 0;
+      size_t finished = 0;
+      size_t winner = 0;
+      /// Node picked by each attempt, known before it waits for a
+      /// connection.
+      std::array<std::optional<size_t>, 2> nodes;
+
+      [[nodiscard]] bool settled() const {
+        return value.has_value() || server_error;
+      }
+    };
+
+    /// Executes one attempt on a worker thread and reports to @p race.
+    template <typename R>
+    void run_attempt(
+        Race<R> &race,
+        size_t index,
+        const std::function<R(KmipClient &)> &fn
+    ) noexcept {
+      const auto started = std::chrono::steady_clock::now();
+      std::optional<R> value;
+      std::exception_ptr error;
+      bool server_error = false;
+      try {
+        size_t node = 0;
+        {
+          // Pick the node under the race lock, so that the other attempt
+          // avoids it even while this one still waits for a connection.
+          std::lock_guard<std::mutex> lk(race.mutex);
+          node = cluster_.select(race.nodes[1 - index]);
+          race.nodes[index] = node;
+        }
+        auto conn = cluster_.borrow_selected(node);
+        try {
+          value.emplace(fn(*conn));
+        } catch (const KmipIOException &) {
+          conn.markUnhealthy();
+          throw;
+        }
+        record_latency(std::chrono::steady_clock::now() - started);
+      } catch (const KmipIOException &) {
+        error = std::current_exception();
+      } catch (...) {
+        error = std::current_exception();
+        server_error = true;
+      }
+
+      std::lock_guard<std::mutex> lk(race.mutex);
+      ++race.finished;
+      if (!race.settled()) {
+        if (value) {
+          race.value = std::move(value);
+          race.winner = index;
+        } else {
+          race.error = error;
+          race.server_error = server_error;
+        }
+      }
+      race.cv.notify_all();
+    }
+
+    /// Adds a latency sample and recomputes the hedge delay every
+    /// Config::refresh_samples samples.
+    void record_latency(std::chrono::steady_clock::duration latency);
+
+    /// Consumes hedge budget; false when the hedge ratio is exhausted.
+    bool take_hedge_budget() noexcept;
+
+    /// Queues @p task for a worker thread.
+    void post(std::function<void()> task);
+
+    /// Worker thread body.
+    void run_worker();
+
+    KmipClusterPool &cluster_;
+    Config config_;
+    LatencyTracker latencies_;
+    std::atomic<std::uint64_t> samples_{0};
+    /// Cached percentile, so calls do not sort the samples.
+    std::atomic<std::chrono::microseconds::rep> hedge_delay_us_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    std::atomic<std::uint64_t> requests_{0};
+    std::atomic<std::uint64_t> hedges_sent_{0};
+    std::atomic<std::uint64_t> hedge_wins_{0};
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_HEDGED_KMIP_CLIENT_HPP
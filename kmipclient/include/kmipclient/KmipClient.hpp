@@ -18,13 +18,18 @@
 #define KMIP_CLIENT_HPP
 
 #include "kmipclient/Key.hpp"
+#include "kmipclient/LocateCursor.hpp"
 #include "kmipclient/NetClient.hpp"
+#include "kmipclient/RetryPolicy.hpp"
+#include "kmipclient/ServerProfile.hpp"
 #include "kmipclient/types.hpp"
 #include "kmipcore/kmip_attributes.hpp"
 #include "kmipcore/kmip_logger.hpp"
 #include "kmipcore/kmip_protocol.hpp"
 
+#include <chrono>
 #include <ctime>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -47,6 +52,13 @@ namespace kmipclient {
    */
   class KmipClient {
   public:
+    /**
+     * @brief Called after every exchange() with its duration and whether the
+     * transport completed it (false when it threw).
+     */
+    using ExchangeObserver = std::function<
+        void(std::chrono::steady_clock::duration elapsed, bool completed)>;
+
     /**
      * @brief Creates a client bound to an existing transport.
      * @param net_client Pre-initialized network transport implementation.
@@ -161,6 +173,40 @@ namespace kmipclient {
             )
     ) const;
 
+    /**
+     * @brief Creates a server-side AES key and activates it in one round
+     * trip.
+     *
+     * Activate is chained to Create through the ID Placeholder in the same
+     * batch.  If the server does not resolve the placeholder, the key is
+     * activated by identifier in a second round trip, and the server
+     * profile records this so that later calls use two round trips
+     * straight away.
+     *
+     * @return Unique identifier of the created, active key.
+     * @throws kmipcore::KmipException on protocol or server-side failure;
+     *         when only activation failed the key stays pre-active.
+     * @see op_create_aes_key()
+     */
+    [[nodiscard]] std::string op_create_and_activate(
+        const std::string &name,
+        const std::string &group,
+        aes_key_size key_size = aes_key_size::AES_256,
+        cryptographic_usage_mask usage_mask =
+            static_cast<cryptographic_usage_mask>(
+                kmipcore::KMIP_CRYPTOMASK_ENCRYPT |
+                kmipcore::KMIP_CRYPTOMASK_DECRYPT
+            )
+    ) const;
+
+    /**
+     * @brief Registers a key and activates it in one round trip.
+     * @see op_register_key(), op_create_and_activate()
+     */
+    [[nodiscard]] std::string op_register_and_activate(
+        const std::string &name, const std::string &group, const Key &k
+    ) const;
+
     /**
      * @brief Executes KMIP Get and decodes a key object.
      * @param id Unique identifier of the key object.
@@ -171,6 +217,32 @@ namespace kmipclient {
     [[nodiscard]] std::unique_ptr<Key>
         op_get_key(const std::string &id, bool all_attributes = false) const;
 
+    /**
+     * @brief Fetches the current key of a group in one round trip.
+     *
+     * Sends Locate (Object Group Member @p member, Maximum Items 1), Get and
+     * Get Attributes as one ordered batch whose last two items refer to the
+     * located key through the ID Placeholder.  A server that does not
+     * resolve the placeholder is asked again with the located identifier,
+     * and the server profile records this so that later calls run Locate
+     * and Get as two round trips straight away.
+     *
+     * @param group Object Group whose member is fetched.
+     * @param o_type KMIP object type of the member.
+     * @param member Default member, or a Fresh one (which the server then
+     *        no longer considers fresh).
+     * @param all_attributes When true, fetches all available attributes.
+     * @return The key, or nullptr when the group has no such member.
+     * @throws kmipcore::KmipException on protocol or server-side failure.
+     */
+    [[nodiscard]] std::unique_ptr<Key> op_get_latest_in_group(
+        const std::string &group,
+        object_type o_type = object_type::KMIP_OBJTYPE_SYMMETRIC_KEY,
+        object_group_member member =
+            object_group_member::KMIP_GROUP_MEMBER_DEFAULT,
+        bool all_attributes = false
+    ) const;
+
     /**
      * @brief Executes KMIP Get and decodes a secret object.
      * @param id Unique identifier of the secret object.
@@ -234,6 +306,19 @@ namespace kmipclient {
         std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
     ) const;
 
+    /**
+     * @brief Executes KMIP Locate with a server-side filter.
+     * @param query Object type, group, name, state, algorithm, date-range
+     *        and other criteria the server matches.
+     * @param max_ids Upper bound on collected IDs across locate batches.
+     * @return Matching object identifiers, up to @p max_ids entries.
+     * @throws kmipcore::KmipException on protocol or server-side failure.
+     */
+    [[nodiscard]] std::vector<std::string> op_locate(
+        const LocateQuery &query,
+        std::size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    ) const;
+
     /**
      * @brief Executes one paged KMIP Locate request using object group filter.
      * @param group Group name to match; empty string disables group filtering.
@@ -315,6 +400,39 @@ namespace kmipclient {
         std::optional<std::size_t> *located_items = nullptr
     ) const;
 
+    /**
+     * @brief Lazily pages through the objects of a group, one Locate round
+     * trip per page, without collecting them all in memory.
+     * @param group Group name to match; empty string matches all objects.
+     * @param o_type KMIP object type to search.
+     * @param options Page size, prefetching, limit and deduplication.
+     * @return Cursor that uses this client until it is destroyed; the
+     *         client must outlive it.
+     */
+    [[nodiscard]] LocateCursor locate_cursor_by_group(
+        const std::string &group,
+        object_type o_type,
+        LocateCursor::Options options = {}
+    ) const;
+
+    /**
+     * @brief Lazily pages through the objects with name @p name.
+     * @see locate_cursor_by_group()
+     */
+    [[nodiscard]] LocateCursor locate_cursor_by_name(
+        const std::string &name,
+        object_type o_type,
+        LocateCursor::Options options = {}
+    ) const;
+
+    /**
+     * @brief Lazily pages through the objects matching @p query.
+     * @see locate_cursor_by_group()
+     */
+    [[nodiscard]] LocateCursor locate_cursor(
+        LocateQuery query, LocateCursor::Options options = {}
+    ) const;
+
 
     /**
      * @brief Executes KMIP Discover Versions to query supported protocol
@@ -367,6 +485,73 @@ namespace kmipclient {
       version_ = version;
     }
 
+    /**
+     * @brief Switches to the highest protocol version supported by both
+     * sides, not above the configured one.
+     *
+     * Runs Discover Versions and Query and records their results in the
+     * server profile (creating one when none is set).  A server that
+     * rejects either operation keeps the configured version.
+     *
+     * @return The protocol version now in use.
+     * @throws KmipIOException on transport failure.
+     */
+    kmipcore::ProtocolVersion negotiate_protocol_version();
+
+    /**
+     * @brief Shares what is known about the server with other clients of
+     * the same endpoint, e.g. the Get Attributes encoding it accepts.
+     * Pass nullptr to stop recording.
+     */
+    void set_server_profile(std::shared_ptr<ServerProfile> profile) noexcept {
+      server_profile_ = std::move(profile);
+    }
+
+    /** @brief Server profile in use, or nullptr. */
+    [[nodiscard]] const std::shared_ptr<ServerProfile> &
+        server_profile() const noexcept {
+      return server_profile_;
+    }
+
+    /**
+     * @brief Creates an empty request message for the configured protocol
+     * version.
+     */
+    [[nodiscard]] kmipcore::RequestMessage make_request_message() const {
+      return kmipcore::RequestMessage(version_);
+    }
+
+    /**
+     * @brief Sends a prepared request message and reads its response.
+     *
+     * Low-level entry point for callers that assemble their own batches; the
+     * returned bytes are normally decoded with kmipcore::ResponseParser
+     * constructed from the same @p request.  A transport failure is retried
+     * on a reconnected transport as far as the retry policy allows.
+     * @throws KmipIOException on transport failure.
+     */
+    [[nodiscard]] std::vector<uint8_t>
+        exchange(const kmipcore::RequestMessage &request) const;
+
+    /**
+     * @brief Installs a hook timing every exchange(), e.g. for metrics.
+     * Pass an empty function to remove it.
+     */
+    void set_exchange_observer(ExchangeObserver observer) {
+      exchange_observer_ = std::move(observer);
+    }
+
+    /**
+     * @brief Sets when exchange() resends a request after a transport
+     * failure; by default it does not.
+     */
+    void set_retry_policy(const RetryPolicy &policy) { retry_policy_ = policy; }
+
+    /** @brief Current retry policy. */
+    [[nodiscard]] const RetryPolicy &retry_policy() const noexcept {
+      return retry_policy_;
+    }
+
     /**
      * @brief Queries the close_on_destroy setting.
      * @return true if the transport will be closed on destruction, false otherwise.
@@ -377,15 +562,42 @@ namespace kmipclient {
 
 
   private:
+    /// One send/receive round trip, reported to the exchange observer.
+    std::vector<uint8_t> exchange_once(
+        const std::vector<uint8_t> &request_bytes, size_t max_response_size
+    ) const;
+
+    /// Replaces the transport's connection before a retry.
+    void reconnect() const;
+
+    /// Sends Create or Register @p item with Activate chained to it and
+    /// returns the new object's identifier.
+    [[nodiscard]] std::string
+        activate_created(kmipcore::RequestBatchItem item) const;
+
+    /// One Get and Get Attributes round trip for the key @p id.
+    [[nodiscard]] std::unique_ptr<Key> get_key_once(
+        const std::string &id,
+        const std::vector<std::string> &selectors,
+        bool legacy_attribute_names_for_v2
+    ) const;
+
+    /// One Locate page of the objects matching @p query.
+    [[nodiscard]] std::vector<std::string> locate_page(
+        const LocateQuery &query,
+        std::size_t offset,
+        std::size_t page_size,
+        std::optional<std::size_t> *located_items
+    ) const;
+
     NetClient *net_client = nullptr;
     std::shared_ptr<NetClient> net_client_owner_;
     std::unique_ptr<IOUtils> io;
     kmipcore::ProtocolVersion version_;
     bool close_on_destroy_ = true;
-
-    [[nodiscard]] kmipcore::RequestMessage make_request_message() const {
-      return kmipcore::RequestMessage(version_);
-    }
+    ExchangeObserver exchange_observer_;
+    RetryPolicy retry_policy_;
+    std::shared_ptr<ServerProfile> server_profile_;
   };
 
 }  // namespace kmipclient
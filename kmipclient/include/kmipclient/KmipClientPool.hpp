@@ -17,15 +17,27 @@
 #ifndef KMIPCLIENT_KMIP_CLIENT_POOL_HPP
 #define KMIPCLIENT_KMIP_CLIENT_POOL_HPP
 
+#include "kmipclient/AdaptiveLimiter.hpp"
+#include "kmipclient/CircuitBreaker.hpp"
 #include "kmipclient/KmipClient.hpp"
+#include "kmipclient/KmipOverloadException.hpp"
 #include "kmipclient/NetClientOpenSSL.hpp"
+#include "kmipclient/PoolMetrics.hpp"
+#include "kmipclient/ServerProfile.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace kmipclient {
@@ -39,6 +51,33 @@ namespace kmipclient {
    * are in use and the limit has been reached, borrow() blocks until one
    * becomes available.
    *
+   * Idle connections are kept in several shards, each with its own lock.  A
+   * thread takes from and returns to its home shard and only scans (steals
+   * from) the other shards when that one is empty, so concurrent borrowers
+   * rarely contend.  Threads wait only when the pool is exhausted.
+   * Config::thread_affinity goes further and keeps each thread's last
+   * connection in a per-thread cache that the thread reuses without any
+   * lock; other borrowers reclaim such connections when the pool runs out.
+   *
+   * Waiting borrowers are served first come, first served within two
+   * priority classes; every interactive borrower is served before any bulk
+   * one.  borrow_async() queues in the same order without blocking a
+   * thread.  Config::reserved_interactive and reserved_bulk set aside
+   * connections that the other class cannot hold, e.g. so that a bulk
+   * Locate sweep never occupies every connection.
+   *
+   * With Config::adaptive_limit the number of borrowed connections is
+   * further capped by an @ref AdaptiveLimiter fed with the round-trip times
+   * of pooled exchanges: when the server slows down, fewer requests are let
+   * through and the rest queue (or are shed, see Config::max_waiting)
+   * instead of piling onto the server.
+   *
+   * With Config::circuit_breaker, consecutive connect and exchange failures
+   * open a @ref CircuitBreaker: borrowers then get KmipCircuitOpenException
+   * at once instead of each waiting for a connection attempt, and only the
+   * background thread probes the server, with jittered exponential backoff,
+   * until a connection succeeds again.
+   *
    * Typical usage:
    * @code
    *   KmipClientPool pool({
@@ -65,8 +104,12 @@ namespace kmipclient {
     // Slots are heap-allocated so that the KmipClient's reference to NetClient
     // stays valid even if the unique_ptr to the Slot is moved around.
     struct Slot {
-      std::unique_ptr<NetClientOpenSSL> net_client;
+      std::unique_ptr<NetClient> net_client;
       std::unique_ptr<KmipClient> kmip_client;
+      std::chrono::steady_clock::time_point created_at;
+      std::chrono::steady_clock::time_point last_used;  ///< last return
+      std::chrono::steady_clock::time_point borrowed_at;
+      bool bulk = false;  ///< borrowed with Priority::bulk
     };
 
   public:
@@ -75,8 +118,25 @@ namespace kmipclient {
     /** Default upper bound for simultaneously open KMIP connections. */
     static constexpr size_t DEFAULT_MAX_CONNECTIONS = 16;
 
+    /** @brief Borrower class; waiting interactive borrowers go first. */
+    enum class Priority {
+      interactive,  ///< latency-critical requests (default)
+      bulk,         ///< background work such as sweeps and migrations
+    };
+
     // ---- Config
     // ----------------------------------------------------------------
+    struct Config;
+
+    /**
+     * @brief Creates an unconnected transport for a new pooled connection.
+     *
+     * The pool calls connect() on the result.  Use it to pool plaintext
+     * transports (@ref NetClientUnix, @ref NetClientTcp) or custom ones.
+     */
+    using TransportFactory =
+        std::function<std::unique_ptr<NetClient>(const Config &)>;
+
     /**
      * @brief Connection and pooling settings used to construct @ref
      * KmipClientPool.
@@ -101,6 +161,67 @@ namespace kmipclient {
       /** TLS peer/hostname verification settings applied to each pooled
        * transport. */
       NetClient::TlsVerificationOptions tls_verification{};
+      /** Name resolution / TCP connect settings of each pooled transport. */
+      NetClient::ConnectOptions connect_options{};
+      /** Transport factory; when empty a @ref NetClientOpenSSL is created
+       * from the settings above. */
+      TransportFactory transport_factory;
+      /** Period of the background check of idle connections; zero (the
+       * default) runs no maintenance thread. */
+      std::chrono::milliseconds health_check_interval{0};
+      /** Idle connections unused for this long are closed by the background
+       * check; zero keeps them open. */
+      std::chrono::milliseconds idle_timeout{0};
+      /** Connections older than this are closed when returned and replaced
+       * by the background check; zero means no limit. */
+      std::chrono::milliseconds max_lifetime{0};
+      /** With health_check_interval set, an idle connection is probed when
+       * borrowed only after being idle this long; zero probes every time.
+       * Without the background check every borrow probes. */
+      std::chrono::milliseconds probe_idle_after{1000};
+      /** Number of idle-connection shards; zero picks one per hardware
+       * thread, at most max_connections.  One keeps a single shared list. */
+      size_t shards = 0;
+      /** Connections kept open: opened by warm_up() and in the background
+       * after construction, and re-opened in the background when discarded.
+       * Idle connections are not closed by idle_timeout below this number. */
+      size_t min_connections = 0;
+      /** Idle connections the background thread keeps ready, within
+       * max_connections, so borrowers rarely connect on their request path. */
+      size_t min_idle_connections = 0;
+      /** Connections bulk borrowers can never hold, kept for interactive
+       * ones. */
+      size_t reserved_interactive = 0;
+      /** Connections interactive borrowers can never hold, so that bulk
+       * work still progresses under constant interactive load. */
+      size_t reserved_bulk = 0;
+      /** Caps borrowed connections by the latency-driven limiter; its
+       * max_limit is capped at max_connections.  Empty (the default) keeps
+       * the static max_connections cap. */
+      std::optional<AdaptiveLimiter::Config> adaptive_limit;
+      /** Borrowers allowed to queue; when that many wait, borrow() fails at
+       * once with KmipOverloadException.  Zero queues without bound. */
+      size_t max_waiting = 0;
+      /** Fails borrows fast while the server is unreachable.  Empty (the
+       * default) lets every borrower attempt its own connection. */
+      std::optional<CircuitBreaker::Config> circuit_breaker;
+      /** Retry policy of every pooled KmipClient, e.g. to resend an
+       * idempotent request after its idle connection turned out to be
+       * closed.  The default makes a single attempt. */
+      RetryPolicy retry{};
+      /** Keep the connection a thread returns in a cache of that thread and
+       * hand it back to the same thread on its next borrow without taking
+       * any lock.  Cached connections still count as idle: borrowers that
+       * find no other connection reclaim them, and the background check
+       * probes them. */
+      bool thread_affinity = false;
+      /** Negotiate the protocol version on the first connection (see
+       * KmipClient::negotiate_protocol_version()); @c version is then the
+       * highest one used.  Later connections use the negotiated one. */
+      bool negotiate_version = false;
+      /** Called after every exchange of a pooled connection, e.g. to route
+       * by round-trip time; exceptions it throws are ignored. */
+      KmipClient::ExchangeObserver exchange_observer;
     };
 
     // ---- BorrowedClient
@@ -160,13 +281,23 @@ namespace kmipclient {
     // --------------------------------------------
 
     /**
-     * Construct the pool.  No connections are created immediately; they are
-     * established lazily on the first borrow() call.
+     * Construct the pool.  No connections are created by the constructor;
+     * they are established lazily on the first borrow() call, or by the
+     * background thread when min_connections or min_idle_connections is set.
      *
-     * @throws kmipcore::KmipException if max_connections == 0
+     * When Config::health_check_interval is set, a maintenance thread
+     * periodically probes idle connections without blocking (see
+     * NetClient::is_idle_usable()).  Connections closed by the server or
+     * past max_lifetime are replaced; those idle for idle_timeout are closed.
+     *
+     * @throws kmipcore::KmipException if max_connections == 0, a minimum
+     *         exceeds it or the reservations add up to more than it
      */
     explicit KmipClientPool(const Config &config);
-    ~KmipClientPool() = default;
+
+    /// Stops the background thread and fails borrow_async() requests still
+    /// queued; all connections must have been returned.
+    ~KmipClientPool();
 
     // Non-copyable, non-movable (holds a mutex and a condition_variable)
     KmipClientPool(const KmipClientPool &) = delete;
@@ -180,47 +311,174 @@ namespace kmipclient {
     /**
      * Borrow a client, blocking indefinitely until one is available.
      *
+     * An idle connection is probed before it is handed out and replaced by a
+     * new one when the server closed it.
      * If the pool is below max_connections a new TLS connection is created
-     * on demand.  If the pool is at capacity the call blocks until another
-     * thread returns a connection.
+     * on demand.  If the pool is at capacity (or @p priority has used up the
+     * connections it may hold) the call queues behind earlier borrowers of
+     * the same class until a connection is handed over.
      *
+     * @throws KmipOverloadException if Config::max_waiting borrowers are
+     *         already queued.
+     * @throws KmipCircuitOpenException while the circuit breaker is open.
      * @throws kmipcore::KmipException if a new connection must be created and
      *         the TLS handshake fails.
      */
-    [[nodiscard]] BorrowedClient borrow();
+    [[nodiscard]] BorrowedClient
+        borrow(Priority priority = Priority::interactive);
 
     /**
      * Like borrow(), but gives up after @p timeout.
      *
-     * @throws kmipcore::KmipException on timeout or TLS connection failure.
+     * @throws KmipOverloadException on timeout or when Config::max_waiting
+     *         borrowers are already queued.
+     * @throws KmipCircuitOpenException while the circuit breaker is open.
+     * @throws kmipcore::KmipException on TLS connection failure.
      */
-    [[nodiscard]] BorrowedClient borrow(std::chrono::milliseconds timeout);
+    [[nodiscard]] BorrowedClient borrow(
+        std::chrono::milliseconds timeout,
+        Priority priority = Priority::interactive
+    );
 
     /**
      * Non-blocking variant.
      *
-     * Returns std::nullopt immediately when no connection is available and the
-     * pool is at capacity.  Otherwise behaves like borrow().
+     * Returns std::nullopt immediately when no connection is available, the
+     * pool is at capacity or borrowers of the same or a higher class are
+     * queued.  Otherwise behaves like borrow().
      *
+     * @throws KmipCircuitOpenException while the circuit breaker is open.
      * @throws kmipcore::KmipException if a new connection must be created and
      *         the TLS handshake fails.
      */
-    [[nodiscard]] std::optional<BorrowedClient> try_borrow();
+    [[nodiscard]] std::optional<BorrowedClient>
+        try_borrow(Priority priority = Priority::interactive);
+
+    /**
+     * Receives the outcome of borrow_async(): either @p client holds the
+     * connection, or @p error the exception that prevented borrowing it.
+     */
+    using BorrowCallback = std::function<
+        void(std::optional<BorrowedClient> client, std::exception_ptr error)>;
+
+    /**
+     * Borrows without blocking the calling thread to wait for a connection,
+     * e.g. from an event loop.
+     *
+     * When a connection is available @p callback runs on the calling thread
+     * before borrow_async() returns.  Otherwise the request is queued like a
+     * blocked borrow() of the same @p priority, without a parked thread, and
+     * @p callback runs on the thread whose returned connection (or freed
+     * capacity) serves it.  It should therefore be short and must not block;
+     * exceptions it throws are ignored.
+     *
+     * Errors are passed to @p callback rather than thrown: the ones of
+     * borrow(), and kmipcore::KmipException for requests still queued when
+     * the pool is destroyed.  Opening a new connection (when the pool is
+     * below max_connections) still performs the TLS handshake on the thread
+     * that serves the request; keep min_connections open to avoid that.
+     */
+    void borrow_async(
+        BorrowCallback callback, Priority priority = Priority::interactive
+    );
+
+    /// borrow_async() delivering its outcome through a future.
+    [[nodiscard]] std::future<BorrowedClient>
+        borrow_async(Priority priority = Priority::interactive);
+
+    /**
+     * Opens connections in parallel until min_connections exist and waits
+     * for them, so that early borrowers need not connect.
+     *
+     * @return Number of connections opened.
+     * @throws The first connection error once all attempts finished; the
+     *         connections that succeeded stay in the pool.
+     */
+    size_t warm_up();
+
+    // ---- Bulk operations
+    // -------------------------------------------------------
+
+    /**
+     * Locates all objects of @p group (of every group when empty) with up
+     * to @p parallelism Locate round trips in flight on separate pooled
+     * connections, all borrowed as Priority::bulk.
+     *
+     * The first page also yields the server's Located Items count, which
+     * splits the rest of the result into offset ranges fetched
+     * concurrently; the pages are then merged in server order.  The ranges
+     * are as long as the first page, since servers may return fewer items
+     * than requested.  When the server does not report the count, or a
+     * page comes back short, the rest is fetched one page after another on
+     * a single connection until an empty page.  As with sequential paging,
+     * objects created or destroyed during the scan may shift the pages.
+     *
+     * Every call starts @p parallelism - 1 threads of its own for the
+     * concurrent fetchers, which is negligible next to a large scan but
+     * makes the call unsuited to small, frequent lookups.
+     *
+     * @param page_size Identifiers requested per Locate round trip.
+     * @param max_ids Upper bound on the identifiers returned; it also bounds
+     *        the ranges fetched whatever Located Items count the server
+     *        reports.
+     * @return Identifiers in the order the server returned them.
+     * @throws kmipcore::KmipException if a parameter is zero, or the first
+     *         error of any page once all fetches finished.
+     */
+    [[nodiscard]] std::vector<std::string> parallel_locate(
+        const std::string &group,
+        object_type o_type,
+        size_t parallelism = 4,
+        size_t page_size = MAX_ITEMS_IN_BATCH,
+        size_t max_ids = MAX_BATCHES_IN_SEARCH * MAX_ITEMS_IN_BATCH
+    );
 
     // ---- Diagnostic accessors
     // --------------------------------------------------
 
-    /// Number of connections currently idle in the pool.
+    /// Number of connections currently idle in the pool, including those
+    /// cached for a thread.
     [[nodiscard]] size_t available_count() const;
 
     /// Total connections in existence (idle + currently borrowed).
     [[nodiscard]] size_t total_count() const;
 
+    /// Number of idle-connection shards in use.
+    [[nodiscard]] size_t shard_count() const noexcept { return shard_count_; }
+
+    /**
+     * @brief Snapshot of the pool's latency histograms, event counters and
+     * occupancy, e.g. to size max_connections from observed borrow waits
+     * and exhaustion events.
+     */
+    [[nodiscard]] PoolMetrics metrics() const;
+
+    /// Passes metrics() to @p visitor.
+    void visit_metrics(PoolMetricsVisitor &visitor) const {
+      metrics().visit(visitor);
+    }
+
     /// Configured upper limit.
     [[nodiscard]] size_t max_connections() const noexcept {
       return config_.max_connections;
     }
 
+    /// Connections that may be borrowed at once right now: the adaptive
+    /// limit when configured, otherwise max_connections.
+    [[nodiscard]] size_t concurrency_limit() const noexcept;
+
+    /// What the connections have learned about the server; shared by all
+    /// of them.
+    [[nodiscard]] const std::shared_ptr<ServerProfile> &
+        server_profile() const noexcept {
+      return profile_;
+    }
+
+    /// State of the circuit breaker; always closed when none is configured.
+    [[nodiscard]] CircuitBreaker::State circuit_state() const noexcept {
+      return breaker_ ? breaker_->state() : CircuitBreaker::State::closed;
+    }
+
   private:
     // ---- Internal helpers
     // ------------------------------------------------------
@@ -233,23 +491,256 @@ namespace kmipclient {
     /// safe to call from BorrowedClient destructor (noexcept).
     void return_slot(std::unique_ptr<Slot> slot, bool healthy) noexcept;
 
-    /// Acquire one slot with the lock already held (and still locked via lk).
-    /// Unlocks lk before the potentially slow TLS connect call.
-    BorrowedClient acquire_locked(std::unique_lock<std::mutex> lk);
+    /// One list of idle connections with its own lock.  @c count mirrors
+    /// idle.size() so that empty shards are skipped without locking.
+    struct alignas(64) Shard {
+      std::mutex mutex;
+      std::vector<std::unique_ptr<Slot>> idle;
+      std::atomic<size_t> count{0};
+    };
+
+    /// Shard of the calling thread; threads are spread round-robin.
+    [[nodiscard]] size_t home_shard() const noexcept;
+
+    /// Pops an idle slot, trying the home shard first.  Never blocks on
+    /// connection I/O.
+    std::unique_ptr<Slot> take_idle();
+
+    /// Appends @p slot to the idle list of @p shard (at the front when it
+    /// should be reused last) and wakes a parked borrower.
+    void put_idle(size_t shard, std::unique_ptr<Slot> slot, bool front);
+
+    /// Per-thread cache of one idle connection (Config::thread_affinity).
+    /// Only its thread stores into it; any thread may take the connection
+    /// out, so whoever exchanges the pointer to null owns the slot.
+    struct alignas(64) AffinityCache {
+      std::atomic<Slot *> slot{nullptr};
+    };
+
+    /// Cache of the calling thread, registered on first use and dropped
+    /// when the thread exits.
+    AffinityCache &affinity_cache();
+
+    /// Lets exiting threads find the pool while it is alive.
+    struct AffinityRegistry {
+      explicit AffinityRegistry(KmipClientPool *owner) : pool(owner) {}
+      std::mutex mutex;
+      KmipClientPool *pool;  ///< null once the pool is being destroyed
+    };
+
+    /// Deregisters @p cache of an exiting thread and moves its connection
+    /// to the idle shards.
+    void release_affinity_cache(AffinityCache *cache) noexcept;
+
+    /// Takes the connection cached for the calling thread, if any.
+    std::unique_ptr<Slot> take_cached();
+
+    /// Caches @p slot for the calling thread unless it already holds one;
+    /// on success @p slot is released.  Wakes queued borrowers.
+    bool put_cached(std::unique_ptr<Slot> &slot);
+
+    /// Takes a connection cached for any thread.
+    std::unique_ptr<Slot> reclaim_cached();
+
+    /// Reserves capacity for one new connection; false at max_connections.
+    bool reserve_connection() noexcept;
+
+    /// Gives back the capacity of a destroyed or never created connection.
+    void release_connection() noexcept;
+
+    /// A queued borrower.  The serving thread fills in @c slot (an idle
+    /// connection) or sets @c granted (capacity for a new one).
+    struct Waiter {
+      explicit Waiter(Priority borrower_priority) noexcept
+        : priority(borrower_priority) {}
+
+      Priority priority;
+      std::unique_ptr<Slot> slot;
+      bool granted = false;
+      /// Wakes a blocked borrower.
+      std::condition_variable cv;
+      /// Set for borrow_async(); the queue then owns the heap-allocated
+      /// waiter until complete_async() runs it.
+      BorrowCallback callback;
+      std::chrono::steady_clock::time_point started{};
+      /// Links of the WaiterQueue, then of the list of served async waiters.
+      Waiter *prev = nullptr;
+      Waiter *next = nullptr;
+
+      [[nodiscard]] bool served() const { return slot || granted; }
+    };
+
+    /// Intrusive FIFO of waiters; queuing and leaving never allocate.
+    class WaiterQueue {
+    public:
+      [[nodiscard]] bool empty() const noexcept { return head_ == nullptr; }
+      [[nodiscard]] Waiter *front() const noexcept { return head_; }
+      void push_back(Waiter *waiter) noexcept;
+      void erase(Waiter *waiter) noexcept;
+
+    private:
+      Waiter *head_ = nullptr;
+      Waiter *tail_ = nullptr;
+    };
+
+    /// Connections @p priority may hold at once.
+    [[nodiscard]] size_t class_limit(Priority priority) const noexcept;
+
+    /// Counts one more connection held by @p priority; false at its limit
+    /// or at the adaptive limit.
+    bool reserve_class(Priority priority) noexcept;
+
+    /// Counts one connection fewer held by @p priority.
+    void release_class(Priority priority) noexcept;
+
+    /// Throws KmipCircuitOpenException while the breaker refuses calls.
+    void check_circuit();
+
+    /// Connects once on behalf of an open breaker and reports the outcome;
+    /// a successful connection is kept when there is room for it.
+    void probe_server();
+
+    /// Feeds one exchange result to the adaptive limiter and the breaker.
+    void observe_exchange(
+        std::chrono::steady_clock::duration elapsed, bool completed
+    ) noexcept;
+
+    /// Hands idle connections or free capacity to queued borrowers while
+    /// possible, interactive ones first.  Called with mutex_ held; returns
+    /// the served borrow_async() waiters, linked through Waiter::next, to be
+    /// passed to complete_async() once mutex_ is released.
+    [[nodiscard]] Waiter *serve_waiters() noexcept;
+
+    /// Turns served async waiters into connections and runs their
+    /// callbacks.  Called without mutex_ held.
+    void complete_async(Waiter *ready) noexcept;
+
+    /// Runs serve_waiters() if any borrower is queued.
+    void wake_waiter() noexcept;
+
+    /// Throws KmipOverloadException when Config::max_waiting borrowers are
+    /// queued.  Called with mutex_ held.
+    void check_queue_limit();
+
+    /// Fast path: reuses an idle slot or opens a new connection when below
+    /// the limits.  Returns std::nullopt when the borrower has to queue.
+    std::optional<BorrowedClient> try_acquire(Priority priority);
+
+    /// Turns a reserved class unit plus @p slot (or, when null, reserved
+    /// capacity) into a borrowed connection, replacing a stale @p slot.
+    BorrowedClient finish_acquire(
+        Priority priority, std::unique_ptr<Slot> slot
+    );
+
+    /// Records one borrow that took since @p started.
+    void record_borrow(std::chrono::steady_clock::time_point started) noexcept;
+
+    /// Queues until served; std::nullopt once @p deadline passed.
+    std::optional<BorrowedClient> acquire(
+        Priority priority,
+        std::optional<std::chrono::steady_clock::time_point> deadline
+    );
+
+    /// True when the slot has exceeded Config::max_lifetime.
+    [[nodiscard]] bool expired(
+        const Slot &slot, std::chrono::steady_clock::time_point now
+    ) const noexcept;
+
+    /// Background thread body: runs check_idle_slots() periodically and
+    /// replenish() when requested.
+    void run_maintenance();
+
+    /// Asks the background thread to restore the configured minimums.
+    void request_replenish() noexcept;
+
+    /// Opens the connections missing from min_connections and
+    /// min_idle_connections.  Returns false when a connection failed.
+    bool replenish();
+
+    /// Opens up to @p count idle connections in parallel within
+    /// max_connections.  Stores the first failure in @p error.
+    size_t open_idle_connections(size_t count, std::exception_ptr &error);
+
+    /// Probes every idle slot once, closing and replacing stale ones.
+    void check_idle_slots();
 
     // ---- Data members
     // ----------------------------------------------------------
 
     Config config_;
 
-    mutable std::mutex mutex_;
-    std::condition_variable cv_;
+    /// Live counterparts of the PoolMetrics fields.
+    struct Telemetry {
+      LatencyHistogram borrow_wait;
+      LatencyHistogram connect;
+      LatencyHistogram handshake;
+      LatencyHistogram hold;
+      LatencyHistogram exchange;
+      std::atomic<std::uint64_t> borrows{0};
+      std::atomic<std::uint64_t> borrow_timeouts{0};
+      std::atomic<std::uint64_t> exhaustions{0};
+      std::atomic<std::uint64_t> discards{0};
+      std::atomic<std::uint64_t> connects{0};
+      std::atomic<std::uint64_t> connect_failures{0};
+      std::atomic<std::uint64_t> reconnects{0};
+      std::atomic<std::uint64_t> exchange_errors{0};
+      std::atomic<std::uint64_t> sheds{0};
+      std::atomic<std::uint64_t> circuit_rejections{0};
+    };
+    Telemetry telemetry_;
 
     /// Idle (available) connections.
-    std::vector<std::unique_ptr<Slot>> available_;
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_count_ = 1;
 
     /// Total connections created and not yet destroyed (available + in-use).
-    size_t total_count_ = 0;
+    std::atomic<size_t> total_count_{0};
+
+    /// Connections currently held per Priority; only counted when a
+    /// reservation or the adaptive limit needs it.
+    std::array<std::atomic<size_t>, 2> class_in_use_{};
+    bool class_accounting_ = false;
+
+    /// Set when Config::adaptive_limit is; in_use_ then counts borrowed
+    /// connections of both classes against its limit.
+    std::unique_ptr<AdaptiveLimiter> limiter_;
+    std::atomic<size_t> in_use_{0};
+
+    /// Set when Config::circuit_breaker is.
+    std::unique_ptr<CircuitBreaker> breaker_;
+
+    std::shared_ptr<ServerProfile> profile_ =
+        std::make_shared<ServerProfile>();
+    /// Negotiation runs once, on the first connection that completes it.
+    std::once_flag negotiate_once_;
+
+    /// Queued borrowers per Priority; returns skip serving when both are
+    /// zero.
+    std::array<std::atomic<size_t>, 2> waiting_{};
+
+    /// Identifies the pool in the threads' affinity caches; unlike the
+    /// address it is never reused.
+    const std::uint64_t id_;
+    /// Every live thread's AffinityCache; guarded by affinity_mutex_.
+    std::vector<std::shared_ptr<AffinityCache>> affinity_caches_;
+    mutable std::mutex affinity_mutex_;
+    std::shared_ptr<AffinityRegistry> affinity_registry_ =
+        std::make_shared<AffinityRegistry>(this);
+
+    /// Guards waiters_, stopping_ and breaker_opened_.
+    std::mutex mutex_;
+    /// FIFO queues of borrowers per Priority.
+    std::array<WaiterQueue, 2> waiters_;
+
+    /// Wakes the background thread for replenishment or shutdown.
+    std::condition_variable maintenance_cv_;
+    bool stopping_ = false;
+    /// The breaker opened; the background thread schedules its probe.
+    bool breaker_opened_ = false;
+    std::atomic<bool> replenish_pending_{false};
+    /// Serialises warm_up() and replenish() so they do not overshoot.
+    std::mutex replenish_mutex_;
+    std::thread maintenance_thread_;
   };
 
 }  // namespace kmipclient
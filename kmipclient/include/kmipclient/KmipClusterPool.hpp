@@ -0,0 +1,306 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_KMIP_CLUSTER_POOL_HPP
+#define KMIPCLIENT_KMIP_CLUSTER_POOL_HPP
+
+#include "kmipclient/KmipClientPool.hpp"
+#include "kmipclient/KmipIOException.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * Connection pool spread over the nodes of a KMIP server cluster.
+   *
+   * One KmipClientPool is kept per node.  Each borrow() goes to the node with
+   * the lowest expected wait, estimated as the node's exponentially weighted
+   * moving average (EWMA) exchange round-trip time multiplied by its
+   * outstanding borrows + 1.
+   * Nodes without a latency sample yet are preferred so every node gets
+   * measured.
+   *
+   * A node that fails failure_threshold times in a row (connection failures
+   * and borrows released with markUnhealthy()) is ejected for
+   * ejection_duration.  Once that expires the node receives traffic again; a
+   * single further failure ejects it again, a success re-admits it fully.
+   * When every node is ejected, the one whose ejection expires first is used.
+   *
+   * @code
+   *   KmipClusterPool cluster({
+   *       .endpoints = {{"kms-1", "5696"}, {"kms-2", "5696"}},
+   *       .node = {.client_cert = ..., .client_key = ...,
+   *                .server_ca_cert = ..., .max_connections = 8},
+   *   });
+   *
+   *   // Retried on another node if the first one fails at the I/O level:
+   *   auto key = cluster.execute_with_failover(
+   *       [&](KmipClient &c) { return c.op_get_key(id); }
+   *   );
+   * @endcode
+   */
+  class KmipClusterPool {
+  public:
+    /** Default smoothing factor of the per-node latency average. */
+    static constexpr double DEFAULT_LATENCY_SMOOTHING = 0.2;
+    /** Default number of consecutive failures that eject a node. */
+    static constexpr unsigned DEFAULT_FAILURE_THRESHOLD = 3;
+    /** Default time an ejected node receives no traffic. */
+    static constexpr std::chrono::milliseconds DEFAULT_EJECTION_DURATION{
+        5000
+    };
+
+    /** @brief Address of one cluster node. */
+    struct Endpoint {
+      std::string host;
+      std::string port;
+    };
+
+    /** @brief Cluster settings. */
+    struct Config {
+      /** Cluster nodes; at least one is required. */
+      std::vector<Endpoint> endpoints;
+      /** Settings of each per-node pool; host and port are ignored. */
+      KmipClientPool::Config node;
+      /** Weight of the newest latency sample, in (0, 1]. */
+      double latency_smoothing = DEFAULT_LATENCY_SMOOTHING;
+      /** Consecutive failures after which a node is ejected. */
+      unsigned failure_threshold = DEFAULT_FAILURE_THRESHOLD;
+      /** How long an ejected node is skipped before it is retried. */
+      std::chrono::milliseconds ejection_duration = DEFAULT_EJECTION_DURATION;
+    };
+
+    /** @brief Snapshot of one node's routing state. */
+    struct NodeStats {
+      Endpoint endpoint;
+      /** Smoothed exchange round-trip time; zero until the first sample. */
+      std::chrono::microseconds latency{0};
+      /** Connections currently borrowed from this node. */
+      size_t outstanding = 0;
+      /** Failures since the last success. */
+      unsigned consecutive_failures = 0;
+      /** True while the node is skipped by borrow(). */
+      bool ejected = false;
+      /** Live connections (idle + borrowed) to this node. */
+      size_t total_connections = 0;
+    };
+
+    /**
+     * RAII guard for a connection borrowed from one cluster node.
+     *
+     * Behaves like KmipClientPool::BorrowedClient.  On release,
+     * markUnhealthy() counts as a failure of the node.  The node's latency
+     * average is fed by every completed exchange instead, so time the
+     * borrower spends between requests does not count.
+     */
+    class BorrowedClient {
+    public:
+      ~BorrowedClient();
+
+      BorrowedClient(const BorrowedClient &) = delete;
+      BorrowedClient &operator=(const BorrowedClient &) = delete;
+      BorrowedClient(BorrowedClient &&) noexcept;
+      BorrowedClient &operator=(BorrowedClient &&) noexcept;
+
+      /** @brief Accesses the borrowed client as a reference. */
+      KmipClient &operator*() { return *inner_; }
+      /** @brief Accesses the borrowed client as a pointer. */
+      KmipClient *operator->() { return inner_.operator->(); }
+
+      /** @brief Discards the connection and records a node failure. */
+      void markUnhealthy() noexcept { inner_.markUnhealthy(); }
+
+      /// Returns false if markUnhealthy() has been called.
+      [[nodiscard]] bool isHealthy() const noexcept {
+        return inner_.isHealthy();
+      }
+
+      /// Node this connection belongs to.
+      [[nodiscard]] const Endpoint &endpoint() const noexcept;
+
+      /// Index of that node in Config::endpoints.
+      [[nodiscard]] size_t node_index() const noexcept { return node_; }
+
+    private:
+      friend class KmipClusterPool;
+
+      BorrowedClient(
+          KmipClusterPool &cluster,
+          size_t node,
+          KmipClientPool::BorrowedClient inner
+      ) noexcept;
+
+      /// Returns the connection and updates the node statistics.
+      void release() noexcept;
+
+      KmipClusterPool *cluster_ = nullptr;  ///< non-owning
+      size_t node_ = 0;
+      KmipClientPool::BorrowedClient inner_;
+    };
+
+    /**
+     * Construct the cluster pool.  Connections are created lazily.
+     *
+     * @throws kmipcore::KmipException if no endpoint is configured or a
+     *         setting is out of range.
+     */
+    explicit KmipClusterPool(const Config &config);
+
+    /// Closes the node pools, whose connections report to this object.
+    ~KmipClusterPool();
+
+    // Non-copyable, non-movable (borrowed clients refer to this instance)
+    KmipClusterPool(const KmipClusterPool &) = delete;
+    KmipClusterPool &operator=(const KmipClusterPool &) = delete;
+    KmipClusterPool(KmipClusterPool &&) = delete;
+    KmipClusterPool &operator=(KmipClusterPool &&) = delete;
+
+    /**
+     * Borrow a connection from the best node.
+     *
+     * If connecting to that node fails, the node is charged a failure and
+     * the next best node is tried.
+     *
+     * @throws KmipIOException (or kmipcore::KmipException) from the last node
+     *         tried when no node accepts a connection.
+     */
+    [[nodiscard]] BorrowedClient borrow();
+
+    /**
+     * First half of borrow(): picks the best node, skipping @p avoid while
+     * another node is available, and counts it as outstanding.  Must be
+     * followed by borrow_selected(), which may wait for a connection; a
+     * concurrent borrower can thus learn the node before that wait.
+     */
+    [[nodiscard]] size_t select(std::optional<size_t> avoid = std::nullopt);
+
+    /**
+     * Second half of borrow(): borrows from @p node, returned by select().
+     * If connecting to it fails, the other nodes are tried as by borrow().
+     */
+    [[nodiscard]] BorrowedClient borrow_selected(size_t node);
+
+    /**
+     * Runs @p fn on one borrowed connection without failover.
+     *
+     * The connection is marked unhealthy when @p fn throws KmipIOException.
+     * Use this for operations that must not be sent twice (Create, Register,
+     * Revoke, ...).
+     */
+    template <typename F>
+    auto execute(F &&fn) -> std::invoke_result_t<F &, KmipClient &> {
+      auto conn = borrow();
+      try {
+        return fn(*conn);
+      } catch (const KmipIOException &) {
+        conn.markUnhealthy();
+        throw;
+      }
+    }
+
+    /**
+     * Runs @p fn, moving to another node when the current one fails at the
+     * I/O level.
+     *
+     * Every node is tried at most once.  KMIP errors reported by a server are
+     * rethrown immediately since another node would answer the same.  Only
+     * use this for idempotent operations (Get, Get Attributes, Locate,
+     * Query, ...): a request may have been processed by a node whose
+     * response was lost.
+     *
+     * @throws the error of the last node tried when all nodes failed.
+     */
+    template <typename F>
+    auto execute_with_failover(F &&fn)
+        -> std::invoke_result_t<F &, KmipClient &> {
+      std::vector<bool> tried(nodes_.size(), false);
+      for (;;) {
+        auto conn = borrow_excluding(tried);
+        tried[conn.node_] = true;
+        try {
+          return fn(*conn);
+        } catch (const KmipIOException &) {
+          conn.markUnhealthy();
+          if (std::find(tried.begin(), tried.end(), false) == tried.end()) {
+            throw;
+          }
+        }
+      }
+    }
+
+    /// Number of configured nodes.
+    [[nodiscard]] size_t node_count() const noexcept { return nodes_.size(); }
+
+    /// Connection limit summed over all nodes.
+    [[nodiscard]] size_t max_connections() const noexcept {
+      return nodes_.size() * config_.node.max_connections;
+    }
+
+    /// Routing state of every node, in configuration order.
+    [[nodiscard]] std::vector<NodeStats> node_stats() const;
+
+  private:
+    struct Node {
+      Endpoint endpoint;
+      std::unique_ptr<KmipClientPool> pool;
+
+      // Guarded by KmipClusterPool::mutex_
+      double latency_us = 0.0;
+      bool measured = false;
+      size_t outstanding = 0;
+      unsigned consecutive_failures = 0;
+      std::chrono::steady_clock::time_point ejected_until{};
+    };
+
+    /// Creates the pool of one more node.
+    void add_node(const Endpoint &endpoint);
+
+    /// Destroys the node pools while their exchange observers, which refer
+    /// to this object, may still run.
+    void close_nodes() noexcept;
+
+    /// Borrows from the best node whose @p excluded entry is false, falling
+    /// back to the remaining ones when connecting fails.  Nodes that failed
+    /// to connect are added to @p excluded.
+    BorrowedClient borrow_excluding(std::vector<bool> &excluded);
+
+    /// Picks the best eligible node and counts it as outstanding; returns
+    /// nullopt when every node is excluded.
+    std::optional<size_t> select_node(const std::vector<bool> &excluded);
+
+    /// Updates the statistics of @p node after a borrow ended.
+    void record(size_t node, bool healthy) noexcept;
+    /// Feeds one completed exchange on @p node into its latency average.
+    void observe_exchange(
+        size_t node, std::chrono::steady_clock::duration elapsed
+    ) noexcept;
+
+    Config config_;
+    std::vector<Node> nodes_;
+    mutable std::mutex mutex_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_KMIP_CLUSTER_POOL_HPP
@@ -48,6 +48,29 @@ namespace kmipclient {
      */
     KmipIOException(int code, const std::string &msg)
       : kmipcore::KmipException(code, msg) {}
+
+    /**
+     * @brief Creates an IO exception that records whether the request
+     * reached the transport.
+     * @param code Error code associated with the failure.
+     * @param msg Human-readable error description.
+     * @param bytes_sent See bytes_sent().
+     */
+    KmipIOException(int code, const std::string &msg, bool bytes_sent)
+      : kmipcore::KmipException(code, msg), bytes_sent_(bytes_sent) {}
+
+    /**
+     * @brief False only when it is certain that no byte of the request was
+     * handed to the transport, so that even a non-idempotent request can be
+     * sent again safely.
+     */
+    [[nodiscard]] bool bytes_sent() const noexcept { return bytes_sent_; }
+
+    /** @brief Overrides bytes_sent() before the exception is rethrown. */
+    void set_bytes_sent(bool bytes_sent) noexcept { bytes_sent_ = bytes_sent; }
+
+  private:
+    bool bytes_sent_ = true;
   };
 
 }  // namespace kmipclient
@@ -0,0 +1,48 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef KMIPOVERLOADEXCEPTION_HPP
+#define KMIPOVERLOADEXCEPTION_HPP
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <string>
+
+namespace kmipclient {
+
+  /**
+   * Exception thrown when a request is rejected on the client side because
+   * the server is saturated: a borrow was shed or timed out waiting for a
+   * connection.  Nothing has been sent to the server, so the request can be
+   * retried later or elsewhere.
+   *
+   * Inherits from kmipcore::KmipException so that existing catch handlers
+   * for the base class continue to work without modification.
+   */
+  class KmipOverloadException : public kmipcore::KmipException {
+  public:
+    /**
+     * @brief Creates an overload exception with a message.
+     * @param msg Human-readable error description.
+     */
+    explicit KmipOverloadException(const std::string &msg)
+      : kmipcore::KmipException(-1, msg) {}
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPOVERLOADEXCEPTION_HPP
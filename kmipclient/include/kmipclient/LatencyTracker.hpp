@@ -0,0 +1,68 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_LATENCY_TRACKER_HPP
+#define KMIPCLIENT_LATENCY_TRACKER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Thread-safe sliding window of latency samples.
+   *
+   * Keeps the most recent @p capacity samples and answers percentile
+   * queries over them.
+   */
+  class LatencyTracker {
+  public:
+    /** Default number of samples kept. */
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    /**
+     * @param capacity Number of most recent samples kept.
+     * @throws kmipcore::KmipException when @p capacity is zero.
+     */
+    explicit LatencyTracker(size_t capacity = DEFAULT_CAPACITY);
+
+    /** @brief Adds one sample, evicting the oldest when full. */
+    void record(std::chrono::steady_clock::duration latency);
+
+    /**
+     * @brief Latency below which fraction @p q of the samples lie.
+     * @param q Quantile in [0, 1], e.g. 0.95 for p95.
+     * @return std::nullopt while fewer than @p min_samples are recorded.
+     */
+    [[nodiscard]] std::optional<std::chrono::microseconds>
+        percentile(double q, size_t min_samples = 1) const;
+
+    /** @brief Number of samples currently kept. */
+    [[nodiscard]] size_t size() const;
+
+  private:
+    mutable std::mutex mutex_;
+    std::vector<std::chrono::microseconds> samples_;
+    size_t capacity_;
+    size_t next_ = 0;  ///< ring position of the next sample once full
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_LATENCY_TRACKER_HPP
@@ -0,0 +1,193 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_LOCATE_CURSOR_HPP
+#define KMIPCLIENT_LOCATE_CURSOR_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Lazily pages through the identifiers matched by a Locate.
+   *
+   * Unlike KmipClient::op_locate_by_group() and op_all(), which collect
+   * every identifier into one vector, a cursor holds a single page at a
+   * time: memory stays constant however many objects match, and iteration
+   * may stop at any point without fetching the rest.  Paging continues
+   * until the Located Items count reported by the server has been reached
+   * or, without a count, until the server returns an empty page.
+   *
+   * With Options::prefetch the next page is requested on a background
+   * thread while the caller consumes the current one.  The KmipClient
+   * behind the cursor is then used from that thread, so it must not be
+   * used otherwise while the cursor is iterated.
+   *
+   * Created by KmipClient::locate_cursor_by_group() and
+   * locate_cursor_by_name(), or from any page source:
+   * @code
+   *   for (const auto &id : client.locate_cursor_by_group("g", type)) {
+   *     if (done(id)) break;
+   *   }
+   * @endcode
+   *
+   * Not thread-safe; the destructor waits for a prefetch in flight.
+   */
+  class LocateCursor {
+  public:
+    /** Identifiers requested per Locate round trip by default. */
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 256;
+
+    /** @brief Paging behaviour. */
+    struct Options {
+      /** Identifiers requested per round trip. */
+      std::size_t page_size = DEFAULT_PAGE_SIZE;
+      /** Fetch the next page while the current one is consumed. */
+      bool prefetch = true;
+      /** Stop after this many identifiers; zero means no limit. */
+      std::size_t max_ids = 0;
+      /** Skip identifiers already returned among the last @c dedup_window
+       * ones, for servers whose page order is not stable; zero disables
+       * the check. */
+      std::size_t dedup_window = 0;
+    };
+
+    /**
+     * Fetches @p page_size identifiers starting at @p offset and stores the
+     * server's Located Items count, when reported, in @p located_items.
+     */
+    using FetchPage = std::function<std::vector<std::string>(
+        std::size_t offset,
+        std::size_t page_size,
+        std::optional<std::size_t> *located_items
+    )>;
+
+    /**
+     * @param fetch Page source; called again with the same offset when a
+     *        previous call threw and iteration is resumed.
+     * @param options Paging behaviour.
+     * @throws kmipcore::KmipException when Options::page_size is zero.
+     */
+    LocateCursor(FetchPage fetch, Options options);
+    ~LocateCursor();
+
+    LocateCursor(LocateCursor &&) noexcept;
+    LocateCursor &operator=(LocateCursor &&) noexcept;
+    LocateCursor(const LocateCursor &) = delete;
+    LocateCursor &operator=(const LocateCursor &) = delete;
+
+    /**
+     * @brief Next non-empty page of identifiers.
+     * @return std::nullopt once the result set is exhausted.
+     * @throws kmipcore::KmipException from the page source; the same page
+     *         is requested again by the next call.
+     */
+    std::optional<std::vector<std::string>> next_page();
+
+    /**
+     * @brief Next identifier.
+     * @return std::nullopt once the result set is exhausted.
+     */
+    std::optional<std::string> next();
+
+    /** @brief Identifiers returned so far. */
+    [[nodiscard]] std::size_t returned() const noexcept { return returned_; }
+
+    /** @brief Located Items count last reported by the server, if any. */
+    [[nodiscard]] std::optional<std::size_t> located_items() const noexcept {
+      return located_items_;
+    }
+
+    /** @brief Input iterator over the remaining identifiers. */
+    class iterator {
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = std::string;
+      using difference_type = std::ptrdiff_t;
+
+      iterator() = default;
+      explicit iterator(LocateCursor &cursor)
+        : cursor_(&cursor), id_(cursor.next()) {}
+
+      const std::string &operator*() const { return *id_; }
+      const std::string *operator->() const { return &*id_; }
+      iterator &operator++() {
+        id_ = cursor_->next();
+        return *this;
+      }
+      void operator++(int) { ++*this; }
+      bool operator==(std::default_sentinel_t) const noexcept {
+        return !id_.has_value();
+      }
+
+    private:
+      LocateCursor *cursor_ = nullptr;
+      std::optional<std::string> id_;
+    };
+
+    /** @brief Starts (or resumes) iteration; fetches the first page. */
+    iterator begin() { return iterator(*this); }
+    /** @brief End of the identifiers. */
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+  private:
+    /// One fetched page with the count that came with it.
+    struct Page {
+      std::vector<std::string> ids;
+      std::optional<std::size_t> located_items;
+    };
+
+    /// Fetches the page at @p offset.
+    static Page fetch_page(
+        const FetchPage &fetch, std::size_t offset, std::size_t requested
+    );
+
+    /// Identifiers to request next, within Options::max_ids.
+    [[nodiscard]] std::size_t next_request_size() const noexcept;
+
+    /// Starts fetching the page at offset_ on a background thread.
+    void start_prefetch();
+
+    /// Drops identifiers seen within the dedup window.
+    void deduplicate(std::vector<std::string> &ids);
+
+    std::shared_ptr<const FetchPage> fetch_;
+    Options options_;
+    std::size_t offset_ = 0;
+    std::size_t returned_ = 0;
+    bool exhausted_ = false;
+    std::optional<std::size_t> located_items_;
+    std::future<Page> prefetched_;
+
+    std::vector<std::string> page_;
+    std::size_t position_ = 0;
+
+    std::unordered_set<std::string> seen_;
+    std::deque<std::string> seen_order_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_LOCATE_CURSOR_HPP
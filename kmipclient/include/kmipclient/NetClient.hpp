@@ -18,6 +18,7 @@
 #ifndef KMIP_NET_CLIENT_HPP
 #define KMIP_NET_CLIENT_HPP
 
+#include <chrono>
 #include <cstdint>
 #include <span>
 #include <string>
@@ -44,6 +45,34 @@ namespace kmipclient {
       bool hostname_verification = true;
     };
 
+    /**
+     * @brief Name resolution and TCP connect settings applied on the next
+     * connect() by transports that resolve host names.
+     */
+    struct ConnectOptions {
+      /** How long resolved addresses are reused by all connections to the
+       * same host and port; zero resolves on every connect. */
+      std::chrono::milliseconds dns_cache_ttl{30000};
+      /** Delay before the next resolved address is raced against attempts
+       * still in progress (RFC 8305 "Connection Attempt Delay"). */
+      std::chrono::milliseconds attempt_delay{250};
+    };
+
+    /** @brief Socket readiness a non-blocking send or receive waits for. */
+    enum class Readiness {
+      none,      ///< the call made progress or failed
+      readable,  ///< retry once the socket is readable
+      writable,  ///< retry once the socket is writable
+    };
+
+    /** @brief Durations of the phases of the last successful connect(). */
+    struct ConnectTiming {
+      /** Name resolution and socket connect. */
+      std::chrono::microseconds connect{0};
+      /** TLS handshake; zero for plaintext transports. */
+      std::chrono::microseconds handshake{0};
+    };
+
     /**
      * @brief Stores transport configuration.
      * @param host KMIP server host.
@@ -105,11 +134,41 @@ namespace kmipclient {
       return m_tls_verification;
     }
 
+    /** @brief Updates name resolution / connect settings for future
+     * connect() calls. */
+    void set_connect_options(ConnectOptions options) noexcept {
+      m_connect_options = options;
+    }
+
+    /** @brief Returns the configured name resolution / connect settings. */
+    [[nodiscard]] ConnectOptions connect_options() const noexcept {
+      return m_connect_options;
+    }
+
+    /** @brief Returns how long the phases of the last successful connect()
+     * took; all zero when the transport does not measure them. */
+    [[nodiscard]] ConnectTiming last_connect_timing() const noexcept {
+      return m_connect_timing;
+    }
+
     /**
      * @brief Checks whether a connection is currently established.
      * @return true when connected, false otherwise.
      */
     [[nodiscard]] bool is_connected() const { return m_isConnected; }
+
+    /**
+     * @brief Checks, without blocking, that an idle connection can still
+     * carry a request.
+     *
+     * Used by @ref KmipClientPool before handing out or keeping idle
+     * connections.  Implementations detect connections closed or reset by
+     * the peer (e.g. by a server idle timeout) and unexpected unread input.
+     * The default only reports is_connected().
+     */
+    [[nodiscard]] virtual bool is_idle_usable() noexcept {
+      return m_isConnected;
+    }
     /**
      * @brief Sends bytes over the established connection.
      * @param data Source buffer.
@@ -124,6 +183,46 @@ namespace kmipclient {
      */
     virtual int recv(std::span<std::uint8_t> data) = 0;
 
+    /**
+     * @brief Socket to poll for the readiness reported by send_nonblocking()
+     * and recv_nonblocking(); -1 when the transport has none or does not
+     * support non-blocking calls.
+     */
+    [[nodiscard]] virtual int native_handle() const noexcept { return -1; }
+
+    /**
+     * @brief Sends bytes without waiting for the socket.
+     * @param data Source buffer.
+     * @param wait Set to the readiness to wait for when nothing could be
+     *        sent yet; Readiness::none otherwise.
+     * @return Number of bytes sent; 0 when @p wait is set; -1 on failure.
+     *         The default does not support non-blocking calls and fails.
+     */
+    virtual int send_nonblocking(
+        std::span<const std::uint8_t> data, Readiness &wait
+    ) {
+      (void) data;
+      wait = Readiness::none;
+      return -1;
+    }
+
+    /**
+     * @brief Receives bytes without waiting for the socket.
+     * @param data Destination buffer.
+     * @param wait Set to the readiness to wait for when no byte is available
+     *        yet; Readiness::none otherwise.
+     * @return Number of bytes received; 0 when @p wait is set or at end of
+     *         stream; -1 on failure.  The default does not support
+     *         non-blocking calls and fails.
+     */
+    virtual int recv_nonblocking(
+        std::span<std::uint8_t> data, Readiness &wait
+    ) {
+      (void) data;
+      wait = Readiness::none;
+      return -1;
+    }
+
   protected:
     std::string m_host;
     std::string m_port;
@@ -132,6 +231,8 @@ namespace kmipclient {
     std::string m_serverCaCertificateFn;
     int m_timeout_ms;
     TlsVerificationOptions m_tls_verification{};
+    ConnectOptions m_connect_options{};
+    ConnectTiming m_connect_timing{};
     bool m_isConnected = false;
   };
 }  // namespace kmipclient
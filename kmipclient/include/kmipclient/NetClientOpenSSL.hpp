@@ -73,6 +73,12 @@ namespace kmipclient {
      *        Honors timeout_ms for both TCP connect and TLS handshake.
      *        The handshake also honors the TLS verification settings configured
      *        via @ref set_tls_verification().
+     *
+     *        Host names are resolved through a process-wide cache (see
+     *        NetClient::ConnectOptions::dns_cache_ttl).  When several
+     *        addresses are returned, IPv6 and IPv4 addresses are tried
+     *        alternately with staggered, overlapping attempts; the first TCP
+     *        connection to complete is used for the TLS handshake.
      * @return true on success, false on failure.
      */
     bool connect() override;
@@ -91,6 +97,31 @@ namespace kmipclient {
      */
     int recv(std::span<std::uint8_t> data) override;
 
+    /**
+     * @brief Peeks at the socket without blocking; false when the peer
+     * closed it, sent a TLS close_notify or unsolicited application data.
+     * Post-handshake TLS messages such as session tickets are consumed.
+     */
+    [[nodiscard]] bool is_idle_usable() noexcept override;
+
+    /** @brief The TLS connection's socket, or -1. */
+    [[nodiscard]] int native_handle() const noexcept override;
+
+    /**
+     * @brief Sends through the TLS channel without blocking.
+     *
+     * Switches the socket to non-blocking mode until the next blocking
+     * send() or recv().
+     */
+    int send_nonblocking(
+        std::span<const std::uint8_t> data, Readiness &wait
+    ) override;
+
+    /** @brief Receives through the TLS channel without blocking. */
+    int recv_nonblocking(
+        std::span<std::uint8_t> data, Readiness &wait
+    ) override;
+
   private:
     struct SslCtxDeleter {
       void operator()(SSL_CTX *ptr) const { SSL_CTX_free(ptr); }
@@ -101,8 +132,12 @@ namespace kmipclient {
 
     std::unique_ptr<SSL_CTX, SslCtxDeleter> ctx_;
     std::unique_ptr<BIO, BioDeleter> bio_;
+    /// Whether the socket is in O_NONBLOCK mode for the *_nonblocking calls.
+    bool nonblocking_ = false;
 
     bool checkConnected();
+    /// Switches the socket between the blocking and non-blocking calls.
+    void use_nonblocking(bool nonblocking);
   };
 }  // namespace kmipclient
 
@@ -0,0 +1,95 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_NET_CLIENT_SOCKET_HPP
+#define KMIPCLIENT_NET_CLIENT_SOCKET_HPP
+
+#include "kmipclient/NetClient.hpp"
+
+#include <string>
+
+namespace kmipclient {
+
+  /**
+   * @brief Common base of the plaintext transports (@ref NetClientUnix,
+   * @ref NetClientTcp).
+   *
+   * Sends and receives raw TTLV over a connected stream socket without TLS.
+   * Only use these transports where the channel is protected by other means,
+   * such as a local KMIP proxy reached over loopback or a Unix domain socket.
+   * TLS verification settings are ignored.
+   */
+  class NetClientSocket : public NetClient {
+  public:
+    /** @brief Closes the socket. */
+    ~NetClientSocket() override;
+
+    /** @brief Closes the socket. */
+    void close() override;
+
+    /**
+     * @brief Sends raw bytes.
+     * @return Number of bytes sent, or -1 on failure.
+     * @throws KmipIOException when the send timeout expires.
+     */
+    int send(std::span<const std::uint8_t> data) override;
+
+    /**
+     * @brief Receives raw bytes.
+     * @return Number of bytes read, 0 at end of stream, or -1 on failure.
+     * @throws KmipIOException when the receive timeout expires.
+     */
+    int recv(std::span<std::uint8_t> data) override;
+
+    /** @brief The connected socket, or -1. */
+    [[nodiscard]] int native_handle() const noexcept override { return fd_; }
+
+    /** @brief Sends with MSG_DONTWAIT; the socket itself stays blocking. */
+    int send_nonblocking(
+        std::span<const std::uint8_t> data, Readiness &wait
+    ) override;
+
+    /** @brief Receives with MSG_DONTWAIT. */
+    int recv_nonblocking(
+        std::span<std::uint8_t> data, Readiness &wait
+    ) override;
+
+    /**
+     * @brief Peeks at the socket without blocking; false when the peer
+     * closed it or sent unsolicited data.
+     */
+    [[nodiscard]] bool is_idle_usable() noexcept override;
+
+  protected:
+    /** @brief Stores the endpoint; certificate settings stay empty. */
+    NetClientSocket(
+        const std::string &host, const std::string &port, int timeout_ms
+    ) noexcept
+      : NetClient(host, port, {}, {}, {}, timeout_ms) {}
+
+    /**
+     * @brief Takes ownership of the connected socket @p fd, switches it to
+     * blocking mode and applies the read/write timeouts.
+     */
+    void adopt(int fd);
+
+  private:
+    int fd_ = -1;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_NET_CLIENT_SOCKET_HPP
@@ -0,0 +1,63 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_NET_CLIENT_TCP_HPP
+#define KMIPCLIENT_NET_CLIENT_TCP_HPP
+
+#include "kmipclient/NetClientSocket.hpp"
+
+#include <string>
+
+namespace kmipclient {
+
+  /**
+   * @brief Plaintext transport over TCP.
+   *
+   * Meant for a KMIP proxy on loopback or another channel that is already
+   * protected; never use it across an untrusted network.  Connecting uses
+   * the same resolver cache and address racing as @ref NetClientOpenSSL
+   * (see NetClient::ConnectOptions).  Nagle's algorithm is disabled.
+   */
+  class NetClientTcp : public NetClientSocket {
+  public:
+    /** Default transport timeout (connect/read/write), in ms. */
+    static constexpr int DEFAULT_TIMEOUT_MS = 500;
+
+    /**
+     * @brief Constructs the transport.
+     * @param host Host name or IP address.
+     * @param port Service port.
+     * @param timeout_ms Timeout applied to connect and to each read/write;
+     *        non-positive values disable it.
+     */
+    NetClientTcp(
+        const std::string &host,
+        const std::string &port,
+        int timeout_ms = DEFAULT_TIMEOUT_MS
+    ) noexcept
+      : NetClientSocket(host, port, timeout_ms) {}
+
+    /**
+     * @brief Connects to the configured host and port.
+     * @return true on success.
+     * @throws KmipIOException when resolution or every connect attempt fails.
+     */
+    bool connect() override;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_NET_CLIENT_TCP_HPP
@@ -0,0 +1,69 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_NET_CLIENT_UNIX_HPP
+#define KMIPCLIENT_NET_CLIENT_UNIX_HPP
+
+#include "kmipclient/NetClientSocket.hpp"
+
+#include <string>
+
+namespace kmipclient {
+
+  /**
+   * @brief Plaintext transport over a Unix domain stream socket.
+   *
+   * Intended for a KMIP-speaking proxy on the same host: no TLS handshake
+   * and no encryption, access is controlled by the socket file permissions.
+   *
+   * @code
+   *   NetClientUnix net_client("/run/kms-proxy/kmip.sock");
+   *   net_client.connect();
+   *   KmipClient client(net_client);
+   * @endcode
+   */
+  class NetClientUnix : public NetClientSocket {
+  public:
+    /** Default transport timeout (connect/read/write), in ms. */
+    static constexpr int DEFAULT_TIMEOUT_MS = 500;
+
+    /**
+     * @brief Constructs the transport.
+     * @param socket_path Filesystem path of the listening socket.
+     * @param timeout_ms Timeout applied to connect and to each read/write;
+     *        non-positive values disable it.
+     */
+    explicit NetClientUnix(
+        const std::string &socket_path, int timeout_ms = DEFAULT_TIMEOUT_MS
+    ) noexcept
+      : NetClientSocket(socket_path, {}, timeout_ms) {}
+
+    /**
+     * @brief Connects to the socket path given at construction.
+     * @return true on success.
+     * @throws KmipIOException when the path is too long or connect fails.
+     */
+    bool connect() override;
+
+    /** @brief Path of the Unix domain socket. */
+    [[nodiscard]] const std::string &socket_path() const noexcept {
+      return m_host;
+    }
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_NET_CLIENT_UNIX_HPP
@@ -0,0 +1,195 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_PIPELINED_KMIP_CLIENT_HPP
+#define KMIPCLIENT_PIPELINED_KMIP_CLIENT_HPP
+
+#include "kmipclient/NetClient.hpp"
+#include "kmipcore/kmip_logger.hpp"
+#include "kmipcore/kmip_protocol.hpp"
+#include "kmipcore/response_parser.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace kmipclient {
+
+  class IOUtils;
+
+  /**
+   * @brief Keeps several KMIP request messages in flight on one connection.
+   *
+   * KMIP servers answer the messages of one connection in order, so a client
+   * does not have to wait for each response before sending the next request.
+   * submit() writes a request immediately as long as fewer than window()
+   * requests are outstanding; wait() reads responses in arrival order until
+   * the requested one is available.
+   *
+   * Batch item ids are drawn from a connection-wide sequence (use
+   * make_request_message()), so each response is matched both by position
+   * and by its echoed Unique Batch Item Ids.  Any I/O error or correlation
+   * mismatch closes the transport and fails every outstanding request with
+   * the same exception.
+   *
+   * The class is not thread-safe; use one instance per thread or guard it
+   * externally.
+   *
+   * @code
+   *   PipelinedKmipClient pipe(net_client, logger, version, 16);
+   *   std::vector<std::pair<PipelinedKmipClient::Ticket, uint32_t>> sent;
+   *   for (const auto &id : ids) {
+   *     auto request = pipe.make_request_message();
+   *     const auto item =
+   *         request.add_batch_item(kmipcore::ActivateRequest(id));
+   *     sent.emplace_back(pipe.submit(std::move(request)), item);
+   *   }
+   *   for (const auto &[ticket, item] : sent) {
+   *     auto response = pipe.wait(ticket);
+   *     response.parser->getResponseByBatchItemId<
+   *         kmipcore::ActivateResponseBatchItem>(item);
+   *   }
+   * @endcode
+   */
+  class PipelinedKmipClient {
+  public:
+    /** Default number of request messages allowed in flight at once. */
+    static constexpr size_t DEFAULT_WINDOW = 8;
+
+    /** Number of batch item ids reserved for each created message. */
+    static constexpr uint32_t BATCH_ITEM_ID_BLOCK = 1024;
+
+    /** Handle identifying one submitted request message. */
+    using Ticket = std::uint64_t;
+
+    /** @brief Completed exchange returned by wait(). */
+    struct Response {
+      /** The request exactly as it was sent. */
+      kmipcore::RequestMessage request;
+      /** Parser over the response, primed with operation hints from
+       * @ref request. */
+      std::unique_ptr<kmipcore::ResponseParser> parser;
+    };
+
+    /**
+     * @brief Creates a pipeline over an existing transport.
+     * @param net_client Transport; must outlive the pipeline.  It is not
+     *        closed on destruction.
+     * @param logger Optional KMIP protocol logger.
+     * @param version KMIP protocol version used by make_request_message().
+     * @param window Maximum number of request messages in flight.
+     * @throws kmipcore::KmipException when @p window is zero.
+     */
+    explicit PipelinedKmipClient(
+        NetClient &net_client,
+        const std::shared_ptr<kmipcore::Logger> &logger = {},
+        kmipcore::ProtocolVersion version = kmipcore::KMIP_VERSION_1_4,
+        size_t window = DEFAULT_WINDOW
+    );
+    ~PipelinedKmipClient();
+
+    // Non-copyable, non-movable (tickets refer to this instance)
+    PipelinedKmipClient(const PipelinedKmipClient &) = delete;
+    PipelinedKmipClient &operator=(const PipelinedKmipClient &) = delete;
+    PipelinedKmipClient(PipelinedKmipClient &&) = delete;
+    PipelinedKmipClient &operator=(PipelinedKmipClient &&) = delete;
+
+    /**
+     * @brief Creates an empty request whose batch item ids come from the
+     * connection-wide sequence.
+     *
+     * Each message gets its own block of @ref BATCH_ITEM_ID_BLOCK ids, so
+     * several messages may be prepared before any of them is submitted.
+     */
+    [[nodiscard]] kmipcore::RequestMessage make_request_message();
+
+    /**
+     * @brief Sends one request message without waiting for its response.
+     *
+     * When the window is full, responses to the oldest outstanding requests
+     * are read first and kept until collected with wait().
+     *
+     * @return Ticket to pass to wait().
+     * @throws kmipcore::KmipException when the message reuses a batch item id
+     *         of a request still in flight.
+     * @throws KmipIOException on transport failure; all outstanding requests
+     *         fail with the same error.
+     */
+    Ticket submit(kmipcore::RequestMessage request);
+
+    /**
+     * @brief Returns the response for @p ticket, reading from the transport
+     * as needed.
+     * @throws KmipIOException when the exchange failed at the transport level
+     *         or the response could not be correlated with its request.
+     * @throws kmipcore::KmipException for an unknown or already collected
+     *         ticket, or when the response is not a valid KMIP message.
+     */
+    [[nodiscard]] Response wait(Ticket ticket);
+
+    /** @brief Reads responses for all requests currently in flight. */
+    void drain();
+
+    /** @brief Number of requests sent whose responses were not read yet. */
+    [[nodiscard]] size_t in_flight() const noexcept {
+      return in_flight_.size();
+    }
+
+    /** @brief Configured maximum number of requests in flight. */
+    [[nodiscard]] size_t window() const noexcept { return window_; }
+
+    /** @brief Returns the configured KMIP protocol version. */
+    [[nodiscard]] const kmipcore::ProtocolVersion &
+        protocol_version() const noexcept {
+      return version_;
+    }
+
+  private:
+    struct InFlight {
+      Ticket ticket = 0;
+      kmipcore::RequestMessage request;
+    };
+
+    struct Completed {
+      kmipcore::RequestMessage request;
+      std::vector<uint8_t> bytes;
+      std::exception_ptr error;
+    };
+
+    /// Reads the response of the oldest in-flight request.
+    void receive_one();
+    /// Moves every in-flight request to completed_ with @p error.
+    void fail_window(const std::exception_ptr &error);
+
+    NetClient &net_client_;
+    std::unique_ptr<IOUtils> io_;
+    kmipcore::ProtocolVersion version_;
+    size_t window_;
+
+    Ticket next_ticket_ = 1;
+    uint32_t next_batch_item_id_ = 1;
+    std::deque<InFlight> in_flight_;
+    std::unordered_set<uint32_t> in_flight_batch_item_ids_;
+    std::unordered_map<Ticket, Completed> completed_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_PIPELINED_KMIP_CLIENT_HPP
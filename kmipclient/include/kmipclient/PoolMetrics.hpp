@@ -0,0 +1,134 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_POOL_METRICS_HPP
+#define KMIPCLIENT_POOL_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace kmipclient {
+
+  /**
+   * @brief Latency histogram with power-of-two microsecond buckets.
+   *
+   * Recording is lock-free and cheap enough for every borrow and exchange.
+   * Bucket 0 counts samples below 1 us, bucket @c i samples in
+   * [2^(i-1), 2^i) us; the last bucket is open-ended (about 18 minutes and
+   * more).
+   */
+  class LatencyHistogram {
+  public:
+    /** Number of buckets. */
+    static constexpr size_t BUCKETS = 32;
+
+    /** @brief Point-in-time copy of a histogram. */
+    struct Snapshot {
+      std::array<std::uint64_t, BUCKETS> buckets{};
+      std::uint64_t count = 0;
+      std::chrono::microseconds sum{0};
+      std::chrono::microseconds max{0};
+
+      /** Exclusive upper bound of @p bucket; the last one is unbounded. */
+      [[nodiscard]] static std::chrono::microseconds
+          upper_bound(size_t bucket) noexcept;
+
+      /** Average sample, zero when empty. */
+      [[nodiscard]] std::chrono::microseconds mean() const noexcept;
+
+      /** Upper bound of the bucket holding the @p q quantile (capped at
+       * max), zero when empty. */
+      [[nodiscard]] std::chrono::microseconds
+          percentile(double q) const noexcept;
+    };
+
+    /** @brief Adds one sample. */
+    void record(std::chrono::steady_clock::duration latency) noexcept;
+
+    /** @brief Copies the current counts. */
+    [[nodiscard]] Snapshot snapshot() const noexcept;
+
+  private:
+    std::array<std::atomic<std::uint64_t>, BUCKETS> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_us_{0};
+    std::atomic<std::uint64_t> max_us_{0};
+  };
+
+  /**
+   * @brief Receives pool metrics one by one, e.g. to forward them to a
+   * monitoring system.  Names are stable identifiers such as
+   * "borrow_wait" or "in_use".
+   */
+  class PoolMetricsVisitor {
+  public:
+    virtual ~PoolMetricsVisitor() = default;
+    /** Monotonic event count. */
+    virtual void counter(std::string_view name, std::uint64_t value) = 0;
+    /** Current level. */
+    virtual void gauge(std::string_view name, std::uint64_t value) = 0;
+    /** Latency distribution. */
+    virtual void histogram(
+        std::string_view name, const LatencyHistogram::Snapshot &snapshot
+    ) = 0;
+  };
+
+  /** @brief Snapshot of @ref KmipClientPool telemetry. */
+  struct PoolMetrics {
+    // ---- Histograms
+    /** Time spent in borrow() / try_borrow(), including connecting. */
+    LatencyHistogram::Snapshot borrow_wait;
+    /** Establishment of new connections (connect() as a whole). */
+    LatencyHistogram::Snapshot connect;
+    /** TLS handshake part of connect, when the transport reports it. */
+    LatencyHistogram::Snapshot handshake;
+    /** Time connections were held by borrowers. */
+    LatencyHistogram::Snapshot hold;
+    /** Request/response round trips on pooled connections. */
+    LatencyHistogram::Snapshot exchange;
+
+    // ---- Counters
+    std::uint64_t borrows = 0;             ///< successful borrows
+    std::uint64_t borrow_timeouts = 0;     ///< borrow(timeout) gave up
+    std::uint64_t exhaustions = 0;         ///< borrows that found no capacity
+    std::uint64_t discards = 0;            ///< connections closed by the pool
+    std::uint64_t connects = 0;            ///< connections opened
+    std::uint64_t connect_failures = 0;    ///< failed connection attempts
+    std::uint64_t reconnects = 0;          ///< stale connections replaced
+    std::uint64_t exchange_errors = 0;     ///< exchanges failed by transport
+    std::uint64_t sheds = 0;               ///< borrows rejected by max_waiting
+    std::uint64_t circuit_opens = 0;       ///< times the breaker opened
+    std::uint64_t circuit_rejections = 0;  ///< borrows refused by the breaker
+
+    // ---- Gauges
+    std::uint64_t idle = 0;          ///< connections waiting in the pool
+    std::uint64_t in_use = 0;        ///< connections held by borrowers
+    std::uint64_t waiting = 0;       ///< borrowers queued for a connection
+    std::uint64_t max = 0;           ///< max_connections
+    std::uint64_t limit = 0;         ///< current concurrency limit
+    std::uint64_t circuit_open = 0;  ///< 1 while the breaker refuses calls
+
+    /** @brief Passes every metric to @p visitor. */
+    void visit(PoolMetricsVisitor &visitor) const;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_POOL_METRICS_HPP
@@ -0,0 +1,123 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_REACTOR_HPP
+#define KMIPCLIENT_REACTOR_HPP
+
+#include "kmipclient/NetClient.hpp"
+#include "kmipclient/Task.hpp"
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief Executor that also waits for socket readiness.
+   *
+   * @ref CoroKmipClient suspends a coroutine whenever a non-blocking send or
+   * receive cannot make progress and asks the reactor to resume it once the
+   * socket is ready.  Implement it on top of an application event loop, or
+   * use @ref PollReactor.
+   */
+  class Reactor : public Executor {
+  public:
+    /**
+     * @brief Calls @p fn once: with true when @p fd is ready for
+     * @p readiness (or has an error pending), with false when @p timeout
+     * expired first.
+     *
+     * Must be callable from any thread.  @p fn must not be called from
+     * within when_ready() itself, nor throw.
+     *
+     * @param timeout Non-positive values wait without a limit.
+     */
+    virtual void when_ready(
+        int fd,
+        NetClient::Readiness readiness,
+        std::chrono::milliseconds timeout,
+        std::function<void(bool ready)> fn
+    ) = 0;
+  };
+
+  /**
+   * @brief Reactor built on poll(2), run by one application thread.
+   *
+   * post() and when_ready() may be called from any thread; the callbacks run
+   * on the thread inside run().  Callbacks still pending when the reactor is
+   * destroyed are dropped, so finish the operations first.
+   *
+   * @code
+   *   PollReactor reactor;
+   *   std::thread loop([&reactor] { reactor.run(); });
+   *   CoroKmipClient kmip(reactor, config);
+   *   auto key = spawn(kmip.get_key(id)).get();
+   *   reactor.stop();
+   *   loop.join();
+   * @endcode
+   */
+  class PollReactor : public Reactor {
+  public:
+    /** @throws KmipIOException when the wake-up pipe cannot be created. */
+    PollReactor();
+    ~PollReactor() override;
+
+    PollReactor(const PollReactor &) = delete;
+    PollReactor &operator=(const PollReactor &) = delete;
+    PollReactor(PollReactor &&) = delete;
+    PollReactor &operator=(PollReactor &&) = delete;
+
+    void post(std::function<void()> fn) override;
+
+    void when_ready(
+        int fd,
+        NetClient::Readiness readiness,
+        std::chrono::milliseconds timeout,
+        std::function<void(bool ready)> fn
+    ) override;
+
+    /** @brief Runs callbacks until stop() is called. */
+    void run();
+
+    /** @brief Makes run() return; callbacks not run yet stay queued for
+     * the next run(). */
+    void stop() noexcept;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Watch {
+      int fd;
+      short events;
+      Clock::time_point deadline;
+      std::function<void(bool)> fn;
+    };
+
+    void wake() noexcept;
+
+    std::mutex mutex_;
+    std::vector<std::function<void()>> posted_;
+    std::vector<Watch> watches_;
+    bool stopping_ = false;
+    int wake_read_ = -1;
+    int wake_write_ = -1;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_REACTOR_HPP
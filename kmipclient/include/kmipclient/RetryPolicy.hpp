@@ -0,0 +1,86 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_RETRY_POLICY_HPP
+#define KMIPCLIENT_RETRY_POLICY_HPP
+
+#include "kmipclient/KmipIOException.hpp"
+#include "kmipcore/kmip_enums.hpp"
+#include "kmipcore/kmip_protocol.hpp"
+
+#include <chrono>
+
+namespace kmipclient {
+
+  /**
+   * @brief When KmipClient::exchange() resends a request after a transport
+   * failure.
+   *
+   * A failed exchange is retried on a new connection (the transport is
+   * reconnected) if the request may safely run twice, i.e. all its batch
+   * items are idempotent (Get, Get Attributes, Get Attribute List, Locate,
+   * Query, Discover Versions), or if no byte of it was sent
+   * (KmipIOException::bytes_sent()).  Create, Register and other
+   * state-changing requests whose bytes may have reached the server are
+   * never resent.
+   *
+   * The first retry is immediate, as the usual cause is a connection that
+   * the server closed while it was idle; later ones wait with jittered
+   * exponential backoff.  No retry starts once Config::budget is spent.
+   *
+   * The default policy makes a single attempt.
+   */
+  struct RetryPolicy {
+    /** Attempts per exchange, the first included; 1 disables retries. */
+    unsigned max_attempts = 1;
+    /** Wait before the second retry; it doubles with every further one. */
+    std::chrono::milliseconds initial_backoff{20};
+    /** Upper bound of the wait between retries. */
+    std::chrono::milliseconds max_backoff{1000};
+    /** Fraction of each wait chosen at random, in [0, 1]. */
+    double jitter = 0.5;
+    /** Time from the first attempt after which no retry is started; zero
+     * means no limit. */
+    std::chrono::milliseconds budget{0};
+
+    /** @brief True for operations that may be executed twice. */
+    [[nodiscard]] static bool is_idempotent(kmipcore::operation op) noexcept;
+
+    /**
+     * @brief True when every batch item of @p request is idempotent.
+     *
+     * A Locate for the Fresh member of a group is not: the server stops
+     * treating the object it returns as fresh.
+     */
+    [[nodiscard]] static bool
+        is_idempotent(const kmipcore::RequestMessage &request) noexcept;
+
+    /**
+     * @brief Whether a request that failed with @p error may be resent.
+     * @param idempotent Result of is_idempotent() for the request.
+     * @param attempt Number of attempts made so far.
+     */
+    [[nodiscard]] bool may_retry(
+        bool idempotent, const KmipIOException &error, unsigned attempt
+    ) const noexcept;
+
+    /** @brief Randomised wait after @p attempt failed attempts. */
+    [[nodiscard]] std::chrono::milliseconds backoff(unsigned attempt) const;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_RETRY_POLICY_HPP
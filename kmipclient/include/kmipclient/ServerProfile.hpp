@@ -0,0 +1,125 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_SERVER_PROFILE_HPP
+#define KMIPCLIENT_SERVER_PROFILE_HPP
+
+#include "kmipcore/kmip_enums.hpp"
+#include "kmipcore/kmip_protocol.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * @brief What the client has learned about one KMIP server endpoint.
+   *
+   * Several servers reject the KMIP 2.0 Attribute Reference encoding of
+   * Get Attributes selectors, or selectors altogether.  KmipClient falls
+   * back to the legacy encoding (and then to requesting all attributes) on
+   * such errors; the profile remembers which encoding worked so that later
+   * calls send it straight away instead of repeating the failed round
+   * trips.  Likewise it remembers a server that does not resolve the ID
+   * Placeholder in chained batch items.  It also keeps the outcome of
+   * KmipClient::negotiate_protocol_version(): the versions the server
+   * supports, the version chosen and the operations it reported via Query.
+   *
+   * A KmipClientPool shares one profile among all its connections.
+   * Thread-safe.
+   */
+  class ServerProfile {
+  public:
+    /** @brief Encoding of Get Attributes selectors for KMIP 2.0. */
+    enum class AttributeEncoding {
+      standard,        ///< Attribute Reference structures (KMIP 2.0)
+      legacy_names,    ///< Attribute Name text strings, as in KMIP 1.x
+      all_attributes,  ///< no selectors; filtered client-side
+    };
+
+    /** @brief Encoding to send first; @c standard until a fallback worked. */
+    [[nodiscard]] AttributeEncoding attribute_encoding() const noexcept {
+      return attribute_encoding_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Records the encoding that the server accepted. */
+    void set_attribute_encoding(AttributeEncoding encoding) noexcept {
+      attribute_encoding_.store(encoding, std::memory_order_relaxed);
+    }
+
+    /** @brief False once the server failed to resolve an ID Placeholder. */
+    [[nodiscard]] bool id_placeholders() const noexcept {
+      return id_placeholders_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Records whether chained batch items work with the server. */
+    void set_id_placeholders(bool supported) noexcept {
+      id_placeholders_.store(supported, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records the result of version negotiation.
+     * @param server_versions Versions reported by Discover Versions.
+     * @param chosen Version used from now on.
+     * @param operations Operations reported by Query; empty if unknown.
+     */
+    void set_discovery(
+        std::vector<kmipcore::ProtocolVersion> server_versions,
+        kmipcore::ProtocolVersion chosen,
+        std::vector<kmipcore::operation> operations
+    );
+
+    /** @brief Negotiated protocol version; std::nullopt before that. */
+    [[nodiscard]] std::optional<kmipcore::ProtocolVersion>
+        protocol_version() const;
+
+    /** @brief Versions the server reported, in its order of preference. */
+    [[nodiscard]] std::vector<kmipcore::ProtocolVersion>
+        server_versions() const;
+
+    /**
+     * @brief False only when the server's Query response omitted @p op;
+     * true while its operations are unknown.
+     */
+    [[nodiscard]] bool supports(kmipcore::operation op) const;
+
+    /**
+     * @brief Highest of @p server_versions not above @p preferred.
+     * @return std::nullopt when the server supports none of them.
+     */
+    [[nodiscard]] static std::optional<kmipcore::ProtocolVersion>
+        choose_version(
+            const std::vector<kmipcore::ProtocolVersion> &server_versions,
+            const kmipcore::ProtocolVersion &preferred
+        );
+
+  private:
+    std::atomic<AttributeEncoding> attribute_encoding_{
+        AttributeEncoding::standard
+    };
+    std::atomic<bool> id_placeholders_{true};
+
+    mutable std::mutex mutex_;
+    std::optional<kmipcore::ProtocolVersion> protocol_version_;
+    std::vector<kmipcore::ProtocolVersion> server_versions_;
+    std::vector<kmipcore::operation> operations_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_SERVER_PROFILE_HPP
@@ -0,0 +1,234 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef KMIPCLIENT_TASK_HPP
+#define KMIPCLIENT_TASK_HPP
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace kmipclient {
+
+  /**
+   * @brief Destination for coroutine continuations.
+   *
+   * Implement post() to hand work over to an application event loop or thread
+   * pool.  post() may run @p fn inline, but must not throw.
+   */
+  class Executor {
+  public:
+    virtual ~Executor() = default;
+    /** @brief Schedules @p fn for execution. */
+    virtual void post(std::function<void()> fn) = 0;
+  };
+
+  template <typename T = void> class Task;
+
+  namespace detail {
+
+    /// Resumes the awaiting coroutine (if any) when a Task completes.
+    struct TaskFinalAwaiter {
+      [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+      template <typename Promise>
+      std::coroutine_handle<>
+          await_suspend(std::coroutine_handle<Promise> h) noexcept {
+        if (auto continuation = h.promise().continuation) {
+          return continuation;
+        }
+        return std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    struct TaskPromiseBase {
+      std::coroutine_handle<> continuation;
+      std::exception_ptr error;
+
+      std::suspend_always initial_suspend() const noexcept { return {}; }
+      TaskFinalAwaiter final_suspend() const noexcept { return {}; }
+      void unhandled_exception() noexcept { error = std::current_exception(); }
+    };
+
+    template <typename T> struct TaskPromise : TaskPromiseBase {
+      std::optional<T> value;
+
+      Task<T> get_return_object() noexcept;
+      void return_value(T v) { value.emplace(std::move(v)); }
+
+      T result() {
+        if (error) {
+          std::rethrow_exception(error);
+        }
+        return std::move(*value);
+      }
+    };
+
+    template <> struct TaskPromise<void> : TaskPromiseBase {
+      Task<void> get_return_object() noexcept;
+      void return_void() noexcept {}
+
+      void result() {
+        if (error) {
+          std::rethrow_exception(error);
+        }
+      }
+    };
+
+    /// Fire-and-forget coroutine used to start a Task from regular code.
+    struct DetachedTask {
+      struct promise_type {
+        DetachedTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+      };
+    };
+
+  }  // namespace detail
+
+  /**
+   * @brief Lazily started coroutine producing a value of type @p T.
+   *
+   * A Task does not run until it is awaited (from another coroutine) or
+   * started with spawn().  Completion resumes the awaiting coroutine
+   * directly, so chains of nested tasks do not grow the stack.  Exceptions
+   * thrown inside the task are rethrown from co_await.
+   */
+  template <typename T> class [[nodiscard]] Task {
+  public:
+    using promise_type = detail::TaskPromise<T>;
+
+    Task(Task &&other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task &operator=(Task &&other) noexcept {
+      if (this != &other) {
+        if (handle_) {
+          handle_.destroy();
+        }
+        handle_ = std::exchange(other.handle_, nullptr);
+      }
+      return *this;
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    ~Task() {
+      if (handle_) {
+        handle_.destroy();
+      }
+    }
+
+    /** @brief Starts the task and suspends the caller until it completes. */
+    auto operator co_await() && noexcept {
+      struct Awaiter {
+        std::coroutine_handle<promise_type> handle;
+
+        [[nodiscard]] bool await_ready() const noexcept {
+          return !handle || handle.done();
+        }
+
+        std::coroutine_handle<>
+            await_suspend(std::coroutine_handle<> awaiting) noexcept {
+          handle.promise().continuation = awaiting;
+          return handle;
+        }
+
+        T await_resume() { return handle.promise().result(); }
+      };
+      return Awaiter{handle_};
+    }
+
+  private:
+    friend promise_type;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+      : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+  };
+
+  namespace detail {
+
+    template <typename T>
+    Task<T> TaskPromise<T>::get_return_object() noexcept {
+      return Task<T>(
+          std::coroutine_handle<TaskPromise<T>>::from_promise(*this)
+      );
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+      return Task<void>(
+          std::coroutine_handle<TaskPromise<void>>::from_promise(*this)
+      );
+    }
+
+    template <typename T>
+    DetachedTask
+        run_detached(Task<T> task, std::shared_ptr<std::promise<T>> result) {
+      try {
+        if constexpr (std::is_void_v<T>) {
+          co_await std::move(task);
+          result->set_value();
+        } else {
+          result->set_value(co_await std::move(task));
+        }
+      } catch (...) {
+        result->set_exception(std::current_exception());
+      }
+    }
+
+  }  // namespace detail
+
+  /**
+   * @brief Starts @p task on the calling thread.
+   *
+   * The task runs until its first suspension point before spawn() returns.
+   * @return Future receiving the task's result or exception.
+   */
+  template <typename T> std::future<T> spawn(Task<T> task) {
+    auto result = std::make_shared<std::promise<T>>();
+    auto future = result->get_future();
+    detail::run_detached(std::move(task), std::move(result));
+    return future;
+  }
+
+  /**
+   * @brief Starts @p task from within @p executor.
+   * @return Future receiving the task's result or exception.
+   */
+  template <typename T> std::future<T> spawn(Executor &executor, Task<T> task) {
+    auto result = std::make_shared<std::promise<T>>();
+    auto future = result->get_future();
+    auto pending = std::make_shared<Task<T>>(std::move(task));
+    executor.post([pending, result] {
+      detail::run_detached(std::move(*pending), result);
+    });
+    return future;
+  }
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_TASK_HPP
@@ -4,6 +4,7 @@
 #include "kmipcore/key.hpp"
 #include "kmipcore/kmip_attribute_names.hpp"
 #include "kmipcore/kmip_attributes.hpp"
+#include "kmipcore/kmip_requests.hpp"
 #include "kmipcore/secret.hpp"
 
 #include <cstdint>
@@ -25,6 +26,12 @@ namespace kmipclient {
   using kmipcore::cryptographic_usage_mask;
   /** @brief Alias for KMIP lifecycle state enum. */
   using kmipcore::state;
+  /** @brief Alias for KMIP Object Group Member (Locate) enum. */
+  using kmipcore::object_group_member;
+  /** @brief Alias for KMIP Storage Status Mask (Locate) bits. */
+  using kmipcore::storage_status_mask;
+  /** @brief Alias for the typed server-side Locate filter. */
+  using kmipcore::LocateQuery;
   /** @brief Alias for KMIP secret object representation. */
   using kmipcore::Secret;
 
@@ -0,0 +1,123 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/AdaptiveLimiter.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace kmipclient {
+
+  AdaptiveLimiter::AdaptiveLimiter() : AdaptiveLimiter(Config{}) {}
+
+  AdaptiveLimiter::AdaptiveLimiter(const Config &config) : config_(config) {
+    if (config_.min_limit == 0 || config_.min_limit > config_.max_limit) {
+      throw kmipcore::KmipException(
+          -1,
+          "AdaptiveLimiter: min_limit must be greater than zero and not "
+          "exceed max_limit"
+      );
+    }
+    if (!(config_.tolerance > 1.0)) {
+      throw kmipcore::KmipException(
+          -1, "AdaptiveLimiter: tolerance must be greater than one"
+      );
+    }
+    if (!(config_.backoff > 0.0 && config_.backoff < 1.0)) {
+      throw kmipcore::KmipException(
+          -1, "AdaptiveLimiter: backoff must be in (0, 1)"
+      );
+    }
+    if (config_.baseline_window == 0) {
+      throw kmipcore::KmipException(
+          -1, "AdaptiveLimiter: baseline_window must be greater than zero"
+      );
+    }
+    estimate_ = static_cast<double>(std::clamp(
+        config_.initial_limit, config_.min_limit, config_.max_limit
+    ));
+    limit_ = static_cast<size_t>(estimate_);
+  }
+
+  void AdaptiveLimiter::on_success(
+      std::chrono::steady_clock::duration latency, size_t in_flight
+  ) {
+    const auto us = std::max(
+        std::chrono::duration_cast<std::chrono::microseconds>(latency),
+        std::chrono::microseconds(1)
+    );
+    std::lock_guard<std::mutex> lk(mutex_);
+
+    if (window_samples_ == 0 || us < window_min_) {
+      window_min_ = us;
+    }
+    if (++window_samples_ >= config_.baseline_window) {
+      baseline_ = window_min_;
+      window_samples_ = 0;
+    } else if (baseline_.count() == 0 || us < baseline_) {
+      baseline_ = us;
+    }
+
+    const auto threshold = std::chrono::duration<double, std::micro>(
+        static_cast<double>(baseline_.count()) * config_.tolerance
+    );
+    if (us > threshold) {
+      decrease();
+      return;
+    }
+    if (cooldown_ > 0) {
+      --cooldown_;
+    }
+    // Growing a limit the callers do not reach would only admit a burst
+    // later.
+    if (static_cast<double>(in_flight) * 2.0 >= estimate_) {
+      estimate_ = std::min(
+          estimate_ + 1.0 / estimate_, static_cast<double>(config_.max_limit)
+      );
+      publish();
+    }
+  }
+
+  void AdaptiveLimiter::on_failure() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    decrease();
+  }
+
+  std::chrono::microseconds AdaptiveLimiter::baseline() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return baseline_;
+  }
+
+  void AdaptiveLimiter::decrease() {
+    if (cooldown_ > 0) {
+      --cooldown_;
+      return;
+    }
+    estimate_ = std::max(
+        estimate_ * config_.backoff, static_cast<double>(config_.min_limit)
+    );
+    cooldown_ = static_cast<size_t>(std::ceil(estimate_));
+    publish();
+  }
+
+  void AdaptiveLimiter::publish() {
+    limit_.store(static_cast<size_t>(estimate_), std::memory_order_relaxed);
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,382 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/AsyncKmipClient.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+namespace kmipclient {
+
+  // ============================================================================
+  // Worker management
+  // ============================================================================
+
+  AsyncKmipClient::AsyncKmipClient(KmipClientPool &pool, size_t worker_threads)
+    : pool_(pool) {
+    const size_t count =
+        worker_threads != 0 ? worker_threads : pool_.max_connections();
+    workers_.reserve(count);
+    try {
+      for (size_t i = 0; i < count; ++i) {
+        workers_.emplace_back([this] { run_worker(); });
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lk(mutex_);
+        stopping_ = true;
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+      throw;
+    }
+  }
+
+  AsyncKmipClient::~AsyncKmipClient() {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void AsyncKmipClient::enqueue(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (stopping_) {
+        throw kmipcore::KmipException(
+            -1, "AsyncKmipClient: client is shutting down"
+        );
+      }
+      queue_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+  }
+
+  void AsyncKmipClient::run_worker() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lk(mutex_);
+        cv_.wait(lk, [this] { return stopping_ || !queue_.empty(); });
+        // Queued work is still completed during shutdown so that no future
+        // is left without a value.
+        if (queue_.empty()) {
+          return;
+        }
+        task = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      task();
+    }
+  }
+
+  size_t AsyncKmipClient::pending_count() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return queue_.size();
+  }
+
+  // ============================================================================
+  // KMIP operations
+  // ============================================================================
+
+  std::future<std::string> AsyncKmipClient::register_key_async(
+      const std::string &name, const std::string &group, const Key &k
+  ) {
+    std::shared_ptr<const Key> key = k.clone();
+    return submit([name, group, key](KmipClient &c) {
+      return c.op_register_key(name, group, *key);
+    });
+  }
+
+  void AsyncKmipClient::register_key_async(
+      const std::string &name,
+      const std::string &group,
+      const Key &k,
+      Callback<std::string> done
+  ) {
+    std::shared_ptr<const Key> key = k.clone();
+    submit(
+        [name, group, key](KmipClient &c) {
+          return c.op_register_key(name, group, *key);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::string> AsyncKmipClient::register_secret_async(
+      const std::string &name, const std::string &group, const Secret &secret
+  ) {
+    return submit([name, group, secret](KmipClient &c) {
+      return c.op_register_secret(name, group, secret);
+    });
+  }
+
+  void AsyncKmipClient::register_secret_async(
+      const std::string &name,
+      const std::string &group,
+      const Secret &secret,
+      Callback<std::string> done
+  ) {
+    submit(
+        [name, group, secret](KmipClient &c) {
+          return c.op_register_secret(name, group, secret);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::string> AsyncKmipClient::create_aes_key_async(
+      const std::string &name,
+      const std::string &group,
+      aes_key_size key_size,
+      cryptographic_usage_mask usage_mask
+  ) {
+    return submit([name, group, key_size, usage_mask](KmipClient &c) {
+      return c.op_create_aes_key(name, group, key_size, usage_mask);
+    });
+  }
+
+  void AsyncKmipClient::create_aes_key_async(
+      const std::string &name,
+      const std::string &group,
+      aes_key_size key_size,
+      cryptographic_usage_mask usage_mask,
+      Callback<std::string> done
+  ) {
+    submit(
+        [name, group, key_size, usage_mask](KmipClient &c) {
+          return c.op_create_aes_key(name, group, key_size, usage_mask);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::unique_ptr<Key>> AsyncKmipClient::get_key_async(
+      const std::string &id, bool all_attributes
+  ) {
+    return submit([id, all_attributes](KmipClient &c) {
+      return c.op_get_key(id, all_attributes);
+    });
+  }
+
+  void AsyncKmipClient::get_key_async(
+      const std::string &id,
+      bool all_attributes,
+      Callback<std::unique_ptr<Key>> done
+  ) {
+    submit(
+        [id, all_attributes](KmipClient &c) {
+          return c.op_get_key(id, all_attributes);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<Secret> AsyncKmipClient::get_secret_async(
+      const std::string &id, bool all_attributes
+  ) {
+    return submit([id, all_attributes](KmipClient &c) {
+      return c.op_get_secret(id, all_attributes);
+    });
+  }
+
+  void AsyncKmipClient::get_secret_async(
+      const std::string &id, bool all_attributes, Callback<Secret> done
+  ) {
+    submit(
+        [id, all_attributes](KmipClient &c) {
+          return c.op_get_secret(id, all_attributes);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::string>
+      AsyncKmipClient::activate_async(const std::string &id) {
+    return submit([id](KmipClient &c) { return c.op_activate(id); });
+  }
+
+  void AsyncKmipClient::activate_async(
+      const std::string &id, Callback<std::string> done
+  ) {
+    submit(
+        [id](KmipClient &c) { return c.op_activate(id); }, std::move(done)
+    );
+  }
+
+  std::future<std::vector<std::string>>
+      AsyncKmipClient::get_attribute_list_async(const std::string &id) {
+    return submit([id](KmipClient &c) { return c.op_get_attribute_list(id); });
+  }
+
+  void AsyncKmipClient::get_attribute_list_async(
+      const std::string &id, Callback<std::vector<std::string>> done
+  ) {
+    submit(
+        [id](KmipClient &c) { return c.op_get_attribute_list(id); },
+        std::move(done)
+    );
+  }
+
+  std::future<kmipcore::Attributes> AsyncKmipClient::get_attributes_async(
+      const std::string &id, const std::vector<std::string> &attr_names
+  ) {
+    return submit([id, attr_names](KmipClient &c) {
+      return c.op_get_attributes(id, attr_names);
+    });
+  }
+
+  void AsyncKmipClient::get_attributes_async(
+      const std::string &id,
+      const std::vector<std::string> &attr_names,
+      Callback<kmipcore::Attributes> done
+  ) {
+    submit(
+        [id, attr_names](KmipClient &c) {
+          return c.op_get_attributes(id, attr_names);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::vector<std::string>> AsyncKmipClient::locate_by_name_async(
+      const std::string &name, object_type o_type
+  ) {
+    return submit([name, o_type](KmipClient &c) {
+      return c.op_locate_by_name(name, o_type);
+    });
+  }
+
+  void AsyncKmipClient::locate_by_name_async(
+      const std::string &name,
+      object_type o_type,
+      Callback<std::vector<std::string>> done
+  ) {
+    submit(
+        [name, o_type](KmipClient &c) {
+          return c.op_locate_by_name(name, o_type);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::vector<std::string>> AsyncKmipClient::locate_by_group_async(
+      const std::string &group, object_type o_type, std::size_t max_ids
+  ) {
+    return submit([group, o_type, max_ids](KmipClient &c) {
+      return c.op_locate_by_group(group, o_type, max_ids);
+    });
+  }
+
+  void AsyncKmipClient::locate_by_group_async(
+      const std::string &group,
+      object_type o_type,
+      std::size_t max_ids,
+      Callback<std::vector<std::string>> done
+  ) {
+    submit(
+        [group, o_type, max_ids](KmipClient &c) {
+          return c.op_locate_by_group(group, o_type, max_ids);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::vector<std::string>>
+      AsyncKmipClient::all_async(object_type o_type, std::size_t max_ids) {
+    return submit([o_type, max_ids](KmipClient &c) {
+      return c.op_all(o_type, max_ids);
+    });
+  }
+
+  void AsyncKmipClient::all_async(
+      object_type o_type,
+      std::size_t max_ids,
+      Callback<std::vector<std::string>> done
+  ) {
+    submit(
+        [o_type, max_ids](KmipClient &c) { return c.op_all(o_type, max_ids); },
+        std::move(done)
+    );
+  }
+
+  std::future<std::string> AsyncKmipClient::revoke_async(
+      const std::string &id,
+      revocation_reason_type reason,
+      const std::string &message,
+      time_t occurrence_time
+  ) {
+    return submit([id, reason, message, occurrence_time](KmipClient &c) {
+      return c.op_revoke(id, reason, message, occurrence_time);
+    });
+  }
+
+  void AsyncKmipClient::revoke_async(
+      const std::string &id,
+      revocation_reason_type reason,
+      const std::string &message,
+      time_t occurrence_time,
+      Callback<std::string> done
+  ) {
+    submit(
+        [id, reason, message, occurrence_time](KmipClient &c) {
+          return c.op_revoke(id, reason, message, occurrence_time);
+        },
+        std::move(done)
+    );
+  }
+
+  std::future<std::string>
+      AsyncKmipClient::destroy_async(const std::string &id) {
+    return submit([id](KmipClient &c) { return c.op_destroy(id); });
+  }
+
+  void AsyncKmipClient::destroy_async(
+      const std::string &id, Callback<std::string> done
+  ) {
+    submit([id](KmipClient &c) { return c.op_destroy(id); }, std::move(done));
+  }
+
+  std::future<std::vector<kmipcore::ProtocolVersion>>
+      AsyncKmipClient::discover_versions_async() {
+    return submit([](KmipClient &c) { return c.op_discover_versions(); });
+  }
+
+  void AsyncKmipClient::discover_versions_async(
+      Callback<std::vector<kmipcore::ProtocolVersion>> done
+  ) {
+    submit(
+        [](KmipClient &c) { return c.op_discover_versions(); }, std::move(done)
+    );
+  }
+
+  std::future<KmipClient::QueryServerInfo> AsyncKmipClient::query_async() {
+    return submit([](KmipClient &c) { return c.op_query(); });
+  }
+
+  void AsyncKmipClient::query_async(
+      Callback<KmipClient::QueryServerInfo> done
+  ) {
+    submit([](KmipClient &c) { return c.op_query(); }, std::move(done));
+  }
+
+}  // namespace kmipclient
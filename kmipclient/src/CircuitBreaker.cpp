@@ -0,0 +1,147 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CircuitBreaker.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <algorithm>
+
+namespace kmipclient {
+
+  CircuitBreaker::CircuitBreaker() : CircuitBreaker(Config{}) {}
+
+  CircuitBreaker::CircuitBreaker(Config config)
+    : config_(std::move(config)), random_(std::random_device{}()) {
+    if (config_.failure_threshold == 0) {
+      throw kmipcore::KmipException(
+          -1, "CircuitBreaker: failure_threshold must be greater than zero"
+      );
+    }
+    if (config_.open_duration.count() <= 0 ||
+        config_.max_backoff < config_.open_duration) {
+      throw kmipcore::KmipException(
+          -1,
+          "CircuitBreaker: open_duration must be positive and not exceed "
+          "max_backoff"
+      );
+    }
+    if (!(config_.jitter >= 0.0 && config_.jitter < 1.0)) {
+      throw kmipcore::KmipException(
+          -1, "CircuitBreaker: jitter must be in [0, 1)"
+      );
+    }
+  }
+
+  void CircuitBreaker::on_success() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (state() == State::closed) {
+      failures_ = 0;
+    }
+  }
+
+  void CircuitBreaker::on_failure() {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      // Failures while open stem from calls admitted before it opened.
+      if (state() != State::closed ||
+          ++failures_ < config_.failure_threshold) {
+        return;
+      }
+      backoff_ = config_.open_duration;
+      open(backoff_);
+    }
+    notify(State::closed, State::open);
+  }
+
+  std::optional<std::chrono::steady_clock::time_point>
+      CircuitBreaker::probe_due() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (state() != State::open) {
+      return std::nullopt;
+    }
+    return probe_at_;
+  }
+
+  bool CircuitBreaker::begin_probe(std::chrono::steady_clock::time_point now) {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (state() != State::open || now < probe_at_) {
+        return false;
+      }
+      set_state(State::half_open);
+    }
+    notify(State::open, State::half_open);
+    return true;
+  }
+
+  void CircuitBreaker::end_probe(bool success) {
+    State to = State::closed;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (state() != State::half_open) {
+        return;
+      }
+      if (success) {
+        failures_ = 0;
+        set_state(State::closed);
+      } else {
+        backoff_ = std::min(backoff_ * 2, config_.max_backoff);
+        open(backoff_);
+        to = State::open;
+      }
+    }
+    notify(State::half_open, to);
+  }
+
+  const char *CircuitBreaker::to_string(State state) noexcept {
+    switch (state) {
+      case State::closed:
+        return "closed";
+      case State::open:
+        return "open";
+      case State::half_open:
+        return "half_open";
+    }
+    return "unknown";
+  }
+
+  void CircuitBreaker::open(std::chrono::milliseconds wait) {
+    std::uniform_real_distribution<double> spread(
+        1.0 - config_.jitter, 1.0 + config_.jitter
+    );
+    const auto jittered = std::chrono::duration<double, std::milli>(
+        static_cast<double>(wait.count()) * spread(random_)
+    );
+    probe_at_ = std::chrono::steady_clock::now() +
+                std::chrono::duration_cast<std::chrono::milliseconds>(jittered);
+    if (set_state(State::open) == State::closed) {
+      opens_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  CircuitBreaker::State CircuitBreaker::set_state(State state) noexcept {
+    return state_.exchange(state, std::memory_order_acq_rel);
+  }
+
+  void CircuitBreaker::notify(State from, State to) const {
+    if (config_.listener) {
+      config_.listener(from, to);
+    }
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,418 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CoalescingDispatcher.hpp"
+
+#include "GetResponseDecoder.hpp"
+#include "kmipclient/KmipIOException.hpp"
+#include "kmipcore/kmip_errors.hpp"
+#include "kmipcore/kmip_requests.hpp"
+#include "kmipcore/kmip_responses.hpp"
+#include "kmipcore/response_parser.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace kmipclient {
+
+  // ============================================================================
+  // Operations
+  // ============================================================================
+
+  /// One caller operation: a group of batch items plus the caller's promise.
+  struct CoalescingDispatcher::Operation {
+    virtual ~Operation() = default;
+
+    /// Appends this operation's batch items to @p request.
+    virtual void add_to(kmipcore::RequestMessage &request) = 0;
+
+    /// Decodes the result and fulfils the promise.  Returns false when a
+    /// fallback exchange on @p client failed at the transport level.
+    virtual bool
+        complete(kmipcore::ResponseParser &rf, KmipClient &client) noexcept = 0;
+
+    /// Fails the promise with @p error.
+    virtual void fail(const std::exception_ptr &error) noexcept = 0;
+
+    std::chrono::steady_clock::time_point enqueued =
+        std::chrono::steady_clock::now();
+  };
+
+  template <typename T>
+  struct CoalescingDispatcher::TypedOperation
+    : CoalescingDispatcher::Operation {
+    using Add =
+        std::function<std::vector<uint32_t>(kmipcore::RequestMessage &)>;
+    using Decode = std::function<T(
+        kmipcore::ResponseParser &, const std::vector<uint32_t> &, KmipClient &
+    )>;
+
+    TypedOperation(Add add_items, Decode decode_items)
+      : add(std::move(add_items)), decode(std::move(decode_items)) {}
+
+    void add_to(kmipcore::RequestMessage &request) override {
+      batch_item_ids = add(request);
+    }
+
+    bool complete(
+        kmipcore::ResponseParser &rf, KmipClient &client
+    ) noexcept override {
+      try {
+        promise.set_value(decode(rf, batch_item_ids, client));
+      } catch (const KmipIOException &) {
+        promise.set_exception(std::current_exception());
+        return false;
+      } catch (...) {
+        promise.set_exception(std::current_exception());
+      }
+      return true;
+    }
+
+    void fail(const std::exception_ptr &error) noexcept override {
+      promise.set_exception(error);
+    }
+
+    Add add;
+    Decode decode;
+    std::vector<uint32_t> batch_item_ids;
+    std::promise<T> promise;
+  };
+
+  namespace {
+
+    /// Get + Get Attributes pair, as sent by KmipClient::op_get_key(), in
+    /// the attribute encoding recorded in @p profile.
+    std::vector<uint32_t> add_get_with_attributes(
+        kmipcore::RequestMessage &request,
+        const std::string &id,
+        const std::vector<std::string> &selectors,
+        const ServerProfile &profile
+    ) {
+      using Encoding = ServerProfile::AttributeEncoding;
+      const auto version = request.getHeader().getProtocolVersion();
+      const auto encoding = version.is_at_least(2, 0)
+                                ? profile.attribute_encoding()
+                                : Encoding::standard;
+      const auto get_item_id = request.add_batch_item(kmipcore::GetRequest(id));
+      const auto attributes_item_id = request.add_batch_item(
+          kmipcore::GetAttributesRequest(
+              id,
+              encoding == Encoding::all_attributes
+                  ? std::vector<std::string>{}
+                  : selectors,
+              version,
+              encoding != Encoding::standard
+          )
+      );
+      return {get_item_id, attributes_item_id};
+    }
+
+    /// True when the single-request path may still succeed with the KMIP
+    /// 2.0 legacy attribute encoding.
+    bool should_fall_back(
+        const kmipcore::KmipException &e, const KmipClient &client
+    ) {
+      return client.protocol_version().is_at_least(2, 0) &&
+             detail::should_retry_get_attributes_with_legacy_v2_encoding(e);
+    }
+
+  }  // namespace
+
+  // ============================================================================
+  // Worker management
+  // ============================================================================
+
+  CoalescingDispatcher::CoalescingDispatcher(KmipClientPool &pool)
+    : CoalescingDispatcher(pool, Config{}) {}
+
+  CoalescingDispatcher::CoalescingDispatcher(
+      KmipClientPool &pool, const Config &config
+  )
+    : pool_(pool), config_(config) {
+    if (config_.max_operations == 0) {
+      throw kmipcore::KmipException(
+          -1, "CoalescingDispatcher: max_operations must be greater than zero"
+      );
+    }
+    const size_t count =
+        config_.workers != 0 ? config_.workers : pool_.max_connections();
+    workers_.reserve(count);
+    try {
+      for (size_t i = 0; i < count; ++i) {
+        workers_.emplace_back([this] { run_worker(); });
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lk(mutex_);
+        stopping_ = true;
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+      throw;
+    }
+  }
+
+  CoalescingDispatcher::~CoalescingDispatcher() {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void CoalescingDispatcher::enqueue(std::unique_ptr<Operation> op) {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (stopping_) {
+        throw kmipcore::KmipException(
+            -1, "CoalescingDispatcher: dispatcher is shutting down"
+        );
+      }
+      pending_.push_back(std::move(op));
+      if (pending_.size() < config_.max_operations && pending_.size() > 1) {
+        // A worker is already waiting for this batch to fill up.
+        return;
+      }
+    }
+    // Either a new batch was started or the current one is full: one
+    // worker is enough to send it.
+    cv_.notify_one();
+  }
+
+  void CoalescingDispatcher::run_worker() {
+    std::unique_lock<std::mutex> lk(mutex_);
+    for (;;) {
+      cv_.wait(lk, [this] { return stopping_ || !pending_.empty(); });
+      if (pending_.empty()) {
+        return;  // stopping and nothing left to send
+      }
+
+      // Give concurrent callers until the window closes to join the batch.
+      // When another worker takes it meanwhile, the window of the next batch
+      // applies.
+      const auto batch_ready = [this] {
+        return stopping_ || pending_.empty() ||
+               pending_.size() >= config_.max_operations;
+      };
+      auto deadline = pending_.front()->enqueued + config_.window;
+      while (cv_.wait_until(
+                 lk,
+                 deadline,
+                 [&] {
+                   return batch_ready() ||
+                          pending_.front()->enqueued + config_.window !=
+                              deadline;
+                 }
+             ) &&
+             !batch_ready()) {
+        deadline = pending_.front()->enqueued + config_.window;
+      }
+      if (pending_.empty()) {
+        continue;  // another worker took the batch
+      }
+
+      const size_t count = std::min(pending_.size(), config_.max_operations);
+      std::vector<std::unique_ptr<Operation>> batch;
+      batch.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        batch.push_back(std::move(pending_.front()));
+        pending_.pop_front();
+      }
+      const bool more_pending = !pending_.empty();
+
+      lk.unlock();
+      if (more_pending) {
+        cv_.notify_one();
+      }
+      execute(std::move(batch));
+      lk.lock();
+    }
+  }
+
+  void CoalescingDispatcher::execute(
+      std::vector<std::unique_ptr<Operation>> batch
+  ) noexcept {
+    const size_t count = batch.size();
+    try {
+      auto conn = pool_.borrow();
+      try {
+        auto request = conn->make_request_message();
+        // Operations are independent; one failing must not abort the rest.
+        request.getHeader().setBatchErrorContinuationOption(
+            kmipcore::KMIP_BATCH_CONTINUE
+        );
+        for (auto &op : batch) {
+          op->add_to(request);
+        }
+
+        const auto response_bytes = conn->exchange(request);
+        messages_sent_.fetch_add(1, std::memory_order_relaxed);
+
+        kmipcore::ResponseParser rf(response_bytes, request);
+        bool transport_ok = true;
+        for (auto &op : batch) {
+          transport_ok = op->complete(rf, *conn) && transport_ok;
+        }
+        if (!transport_ok) {
+          conn.markUnhealthy();
+        }
+      } catch (const KmipIOException &) {
+        conn.markUnhealthy();
+        throw;
+      }
+    } catch (...) {
+      // Operations only complete after a successful exchange, so none of
+      // them has a result yet.
+      const auto error = std::current_exception();
+      for (auto &op : batch) {
+        op->fail(error);
+      }
+    }
+    operations_completed_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  size_t CoalescingDispatcher::pending_count() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return pending_.size();
+  }
+
+  // ============================================================================
+  // KMIP operations
+  // ============================================================================
+
+  std::future<std::unique_ptr<Key>> CoalescingDispatcher::get_key(
+      const std::string &id, bool all_attributes
+  ) {
+    auto op = std::make_unique<TypedOperation<std::unique_ptr<Key>>>(
+        [id, all_attributes, profile = pool_.server_profile()](
+            kmipcore::RequestMessage &request
+        ) {
+          return add_get_with_attributes(
+              request,
+              id,
+              detail::default_get_key_attrs(all_attributes),
+              *profile
+          );
+        },
+        [id, all_attributes](
+            kmipcore::ResponseParser &rf,
+            const std::vector<uint32_t> &ids,
+            KmipClient &client
+        ) {
+          try {
+            return detail::decode_get_key(rf, ids[0], ids[1]);
+          } catch (const kmipcore::KmipException &e) {
+            if (!should_fall_back(e, client)) {
+              throw;
+            }
+          }
+          return client.op_get_key(id, all_attributes);
+        }
+    );
+    auto future = op->promise.get_future();
+    enqueue(std::move(op));
+    return future;
+  }
+
+  std::future<Secret> CoalescingDispatcher::get_secret(
+      const std::string &id, bool all_attributes
+  ) {
+    auto op = std::make_unique<TypedOperation<Secret>>(
+        [id, all_attributes, profile = pool_.server_profile()](
+            kmipcore::RequestMessage &request
+        ) {
+          return add_get_with_attributes(
+              request,
+              id,
+              detail::default_get_secret_attrs(all_attributes),
+              *profile
+          );
+        },
+        [id, all_attributes](
+            kmipcore::ResponseParser &rf,
+            const std::vector<uint32_t> &ids,
+            KmipClient &client
+        ) {
+          try {
+            return detail::decode_get_secret(
+                rf, ids[0], ids[1], all_attributes
+            );
+          } catch (const kmipcore::KmipException &e) {
+            if (!should_fall_back(e, client)) {
+              throw;
+            }
+          }
+          return client.op_get_secret(id, all_attributes);
+        }
+    );
+    auto future = op->promise.get_future();
+    enqueue(std::move(op));
+    return future;
+  }
+
+  std::future<std::string>
+      CoalescingDispatcher::activate(const std::string &id) {
+    auto op = std::make_unique<TypedOperation<std::string>>(
+        [id](kmipcore::RequestMessage &request) {
+          return std::vector<uint32_t>{
+              request.add_batch_item(kmipcore::ActivateRequest(id))
+          };
+        },
+        [](kmipcore::ResponseParser &rf,
+           const std::vector<uint32_t> &ids,
+           KmipClient &) {
+          return rf
+              .getResponseByBatchItemId<kmipcore::ActivateResponseBatchItem>(
+                  ids[0]
+              )
+              .getUniqueIdentifier();
+        }
+    );
+    auto future = op->promise.get_future();
+    enqueue(std::move(op));
+    return future;
+  }
+
+  std::future<std::string>
+      CoalescingDispatcher::destroy(const std::string &id) {
+    auto op = std::make_unique<TypedOperation<std::string>>(
+        [id](kmipcore::RequestMessage &request) {
+          return std::vector<uint32_t>{
+              request.add_batch_item(kmipcore::DestroyRequest(id))
+          };
+        },
+        [](kmipcore::ResponseParser &rf,
+           const std::vector<uint32_t> &ids,
+           KmipClient &) {
+          return rf
+              .getResponseByBatchItemId<kmipcore::DestroyResponseBatchItem>(
+                  ids[0]
+              )
+              .getUniqueIdentifier();
+        }
+    );
+    auto future = op->promise.get_future();
+    enqueue(std::move(op));
+    return future;
+  }
+
+}  // namespace kmipclient
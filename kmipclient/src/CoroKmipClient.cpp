@@ -0,0 +1,579 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CoroKmipClient.hpp"
+
+#include "GetResponseDecoder.hpp"
+#include "MessageFramer.hpp"
+#include "kmipclient/KmipIOException.hpp"
+#include "kmipcore/kmip_errors.hpp"
+#include "kmipcore/kmip_requests.hpp"
+
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <sstream>
+
+namespace kmipclient {
+
+  // ============================================================================
+  // Connections
+  // ============================================================================
+
+  struct CoroKmipClient::Connection {
+    std::unique_ptr<NetClient> transport;
+    MessageFramer framer;
+  };
+
+  /// Takes an idle connection, suspending until one is released.
+  class CoroKmipClient::Acquire {
+  public:
+    explicit Acquire(CoroKmipClient &client) noexcept : client_(client) {}
+
+    [[nodiscard]] bool await_ready() {
+      std::lock_guard<std::mutex> lk(client_.mutex_);
+      return take();
+    }
+
+    bool await_suspend(std::coroutine_handle<> awaiting) {
+      std::lock_guard<std::mutex> lk(client_.mutex_);
+      if (take()) {
+        return false;
+      }
+      awaiting_ = awaiting;
+      client_.waiters_.push_back(this);
+      return true;
+    }
+
+    [[nodiscard]] Connection *await_resume() const noexcept {
+      return connection_;
+    }
+
+  private:
+    friend class CoroKmipClient;
+
+    bool take() noexcept {
+      if (client_.idle_.empty()) {
+        return false;
+      }
+      connection_ = client_.idle_.back();
+      client_.idle_.pop_back();
+      return true;
+    }
+
+    CoroKmipClient &client_;
+    Connection *connection_ = nullptr;
+    std::coroutine_handle<> awaiting_;
+  };
+
+  /// Releases an acquired connection when the operation ends.
+  class CoroKmipClient::Lease {
+  public:
+    Lease(CoroKmipClient &client, Connection *connection) noexcept
+      : client_(client), connection_(connection) {}
+    ~Lease() { client_.release(connection_); }
+
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+
+    Connection *operator->() const noexcept { return connection_; }
+
+  private:
+    CoroKmipClient &client_;
+    Connection *connection_;
+  };
+
+  /// Suspends until the reactor reports the socket ready; yields false on
+  /// timeout.
+  class CoroKmipClient::Ready {
+  public:
+    Ready(
+        Reactor &reactor,
+        int fd,
+        NetClient::Readiness readiness,
+        std::chrono::milliseconds timeout
+    ) noexcept
+      : reactor_(reactor), fd_(fd), readiness_(readiness), timeout_(timeout) {}
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> awaiting) {
+      reactor_.when_ready(
+          fd_,
+          readiness_,
+          timeout_,
+          [this, awaiting](bool ready) {
+            ready_ = ready;
+            awaiting.resume();
+          }
+      );
+    }
+
+    [[nodiscard]] bool await_resume() const noexcept { return ready_; }
+
+  private:
+    Reactor &reactor_;
+    int fd_;
+    NetClient::Readiness readiness_;
+    std::chrono::milliseconds timeout_;
+    bool ready_ = false;
+  };
+
+  namespace {
+
+    KmipIOException timeout_error(
+        const char *op, std::chrono::milliseconds timeout, bool bytes_sent
+    ) {
+      return KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          std::string("KMIP ") + op + " timed out after " +
+              std::to_string(timeout.count()) + "ms",
+          bytes_sent
+      );
+    }
+
+  }  // namespace
+
+  CoroKmipClient::CoroKmipClient(Reactor &reactor, Config config)
+    : reactor_(reactor), config_(std::move(config)) {
+    if (!config_.transport_factory) {
+      throw kmipcore::KmipException(
+          -1, "CoroKmipClient: transport_factory is required"
+      );
+    }
+    if (config_.max_connections == 0) {
+      throw kmipcore::KmipException(
+          -1, "CoroKmipClient: max_connections must be greater than zero"
+      );
+    }
+
+    connections_.reserve(config_.max_connections);
+    idle_.reserve(config_.max_connections);
+    for (std::size_t i = 0; i < config_.max_connections; ++i) {
+      auto transport = config_.transport_factory();
+      if (!transport) {
+        throw kmipcore::KmipException(
+            -1, "CoroKmipClient: transport_factory returned no transport"
+        );
+      }
+      connections_.push_back(std::make_unique<Connection>());
+      connections_.back()->transport = std::move(transport);
+    }
+    // Hand out the first connection first.
+    for (auto it = connections_.rbegin(); it != connections_.rend(); ++it) {
+      idle_.push_back(it->get());
+    }
+  }
+
+  CoroKmipClient::~CoroKmipClient() = default;
+
+  void CoroKmipClient::release(Connection *connection) noexcept {
+    Acquire *waiter = nullptr;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (waiters_.empty()) {
+        // Never reallocates: reserved for every connection.
+        idle_.push_back(connection);
+        return;
+      }
+      waiter = waiters_.front();
+      waiters_.pop_front();
+      waiter->connection_ = connection;
+    }
+    // Resume the waiter from the reactor rather than inside the operation
+    // that is finishing.
+    const auto awaiting = waiter->awaiting_;
+    try {
+      reactor_.post([awaiting] { awaiting.resume(); });
+    } catch (...) {
+      awaiting.resume();
+    }
+  }
+
+  // ============================================================================
+  // Exchange
+  // ============================================================================
+
+  Task<std::vector<uint8_t>>
+      CoroKmipClient::exchange(kmipcore::RequestMessage request) {
+    const auto request_bytes = request.serialize();
+    const auto max_response_size = request.getMaxResponseSize();
+
+    Acquire acquire(*this);
+    Connection *const acquired = co_await acquire;
+    const Lease lease(*this, acquired);
+    NetClient &transport = *lease->transport;
+    MessageFramer &framer = lease->framer;
+
+    std::vector<uint8_t> response;
+    std::exception_ptr error;
+    try {
+      if (!transport.is_connected()) {
+        // Bytes read ahead on a previous connection never belong to it.
+        framer.reset();
+        if (!transport.connect()) {
+          throw KmipIOException(
+              kmipcore::KMIP_IO_FAILURE, "Unable to connect", false
+          );
+        }
+      }
+      const int fd = transport.native_handle();
+      if (fd < 0) {
+        throw KmipIOException(
+            kmipcore::KMIP_IO_FAILURE,
+            "CoroKmipClient: transport does not support non-blocking I/O",
+            false
+        );
+      }
+
+      std::size_t sent = 0;
+      while (sent < request_bytes.size()) {
+        auto wait = NetClient::Readiness::none;
+        const int n = transport.send_nonblocking(
+            std::span<const uint8_t>(request_bytes).subspan(sent), wait
+        );
+        if (n > 0) {
+          sent += static_cast<std::size_t>(n);
+          continue;
+        }
+        if (wait == NetClient::Readiness::none) {
+          std::ostringstream oss;
+          oss << "Can not send request. Bytes total: " << request_bytes.size()
+              << ", bytes sent: " << sent;
+          throw KmipIOException(
+              kmipcore::KMIP_IO_FAILURE, oss.str(), sent > 0
+          );
+        }
+        Ready ready(reactor_, fd, wait, config_.io_timeout);
+        if (!co_await ready) {
+          throw timeout_error("send", config_.io_timeout, sent > 0);
+        }
+      }
+
+      for (;;) {
+        if (auto message = framer.next_message(max_response_size)) {
+          response = std::move(*message);
+          break;
+        }
+        auto wait = NetClient::Readiness::none;
+        const int n = transport.recv_nonblocking(framer.write_window(), wait);
+        if (n > 0) {
+          framer.commit(static_cast<std::size_t>(n));
+          continue;
+        }
+        if (wait == NetClient::Readiness::none) {
+          std::ostringstream oss;
+          oss << "Connection closed or error while reading. Buffered "
+              << framer.buffered() << " bytes of an incomplete message";
+          throw KmipIOException(kmipcore::KMIP_IO_FAILURE, oss.str());
+        }
+        Ready ready(reactor_, fd, wait, config_.io_timeout);
+        if (!co_await ready) {
+          throw timeout_error("receive", config_.io_timeout, true);
+        }
+      }
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    if (error) {
+      // The stream position is unknown after a failure.
+      transport.close();
+      framer.reset();
+      std::rethrow_exception(error);
+    }
+    co_return response;
+  }
+
+  // ============================================================================
+  // KMIP operations
+  // ============================================================================
+
+  template <typename Decode>
+  Task<std::invoke_result_t<
+      Decode &,
+      kmipcore::ResponseParser &,
+      uint32_t,
+      uint32_t>>
+      CoroKmipClient::get_with_attributes(
+          std::string id, std::vector<std::string> selectors, Decode decode
+      ) {
+    using Encoding = ServerProfile::AttributeEncoding;
+    ServerProfile *const profile = config_.server_profile.get();
+    const bool v2 = config_.version.is_at_least(2, 0);
+    auto encoding = v2 && profile != nullptr ? profile->attribute_encoding()
+                                             : Encoding::standard;
+    for (;;) {
+      auto request = make_request_message();
+      const auto get_item_id = request.add_batch_item(kmipcore::GetRequest(id));
+      const auto attributes_item_id = request.add_batch_item(
+          kmipcore::GetAttributesRequest(
+              id,
+              encoding == Encoding::all_attributes ? std::vector<std::string>{}
+                                                   : selectors,
+              request.getHeader().getProtocolVersion(),
+              encoding != Encoding::standard
+          )
+      );
+
+      const auto response_bytes = co_await exchange(request);
+
+      std::optional<Encoding> next;
+      try {
+        kmipcore::ResponseParser rf(response_bytes, request);
+        auto result = decode(rf, get_item_id, attributes_item_id);
+        if (profile != nullptr && encoding != Encoding::standard) {
+          profile->set_attribute_encoding(encoding);
+        }
+        co_return std::move(result);
+      } catch (const kmipcore::KmipException &e) {
+        if (v2) {
+          next = detail::next_attribute_encoding(
+              encoding, !selectors.empty(), e
+          );
+        }
+        if (!next) {
+          throw;
+        }
+      }
+      encoding = *next;
+    }
+  }
+
+  Task<std::string> CoroKmipClient::create_aes_key(
+      std::string name,
+      std::string group,
+      aes_key_size key_size,
+      cryptographic_usage_mask usage_mask
+  ) {
+    auto request = make_request_message();
+    const auto batch_item_id = request.add_batch_item(
+        kmipcore::CreateSymmetricKeyRequest(
+            name,
+            group,
+            static_cast<int32_t>(key_size),
+            usage_mask,
+            request.getHeader().getProtocolVersion()
+        )
+    );
+
+    const auto response_bytes = co_await exchange(request);
+
+    kmipcore::ResponseParser rf(response_bytes, request);
+    co_return rf
+        .getResponseByBatchItemId<kmipcore::CreateResponseBatchItem>(
+            batch_item_id
+        )
+        .getUniqueIdentifier();
+  }
+
+  Task<std::unique_ptr<Key>>
+      CoroKmipClient::get_key(std::string id, bool all_attributes) {
+    auto selectors = detail::default_get_key_attrs(all_attributes);
+    auto key = co_await get_with_attributes(
+        std::move(id), std::move(selectors), &detail::decode_get_key
+    );
+    co_return std::move(key);
+  }
+
+  Task<Secret> CoroKmipClient::get_secret(std::string id, bool all_attributes) {
+    auto selectors = detail::default_get_secret_attrs(all_attributes);
+    const auto decode = [all_attributes](
+                            kmipcore::ResponseParser &rf,
+                            uint32_t get_item_id,
+                            uint32_t attributes_item_id
+                        ) {
+      return detail::decode_get_secret(
+          rf, get_item_id, attributes_item_id, all_attributes
+      );
+    };
+    auto secret = co_await get_with_attributes(
+        std::move(id), std::move(selectors), decode
+    );
+    co_return std::move(secret);
+  }
+
+  Task<std::string> CoroKmipClient::activate(std::string id) {
+    auto request = make_request_message();
+    const auto batch_item_id =
+        request.add_batch_item(kmipcore::ActivateRequest(id));
+
+    const auto response_bytes = co_await exchange(request);
+
+    kmipcore::ResponseParser rf(response_bytes, request);
+    co_return rf
+        .getResponseByBatchItemId<kmipcore::ActivateResponseBatchItem>(
+            batch_item_id
+        )
+        .getUniqueIdentifier();
+  }
+
+  Task<std::vector<std::string>>
+      CoroKmipClient::get_attribute_list(std::string id) {
+    auto request = make_request_message();
+    const auto batch_item_id =
+        request.add_batch_item(kmipcore::GetAttributeListRequest(id));
+
+    const auto response_bytes = co_await exchange(request);
+
+    kmipcore::ResponseParser rf(response_bytes, request);
+    auto response = rf.getResponseByBatchItemId<
+        kmipcore::GetAttributeListResponseBatchItem>(batch_item_id);
+    co_return std::vector<std::string>{
+        response.getAttributeNames().begin(), response.getAttributeNames().end()
+    };
+  }
+
+  Task<CoroKmipClient::Page> CoroKmipClient::locate_page(
+      std::string group,
+      object_type o_type,
+      std::size_t offset,
+      std::size_t page_size
+  ) {
+    auto request = make_request_message();
+    const auto batch_item_id = request.add_batch_item(
+        kmipcore::LocateRequest(
+            LocateQuery(o_type).in_group(group),
+            page_size,
+            offset,
+            request.getHeader().getProtocolVersion()
+        )
+    );
+
+    const auto response_bytes = co_await exchange(request);
+
+    kmipcore::ResponseParser rf(response_bytes, request);
+    auto response =
+        rf.getResponseByBatchItemId<kmipcore::LocateResponseBatchItem>(
+            batch_item_id
+        );
+    Page page{
+        std::vector<std::string>(
+            response.getUniqueIdentifiers().begin(),
+            response.getUniqueIdentifiers().end()
+        ),
+        std::nullopt,
+    };
+    const auto total_items = response.getLocatePayload().getLocatedItems();
+    if (total_items.has_value() && *total_items >= 0) {
+      page.located_items = static_cast<std::size_t>(*total_items);
+    }
+    co_return std::move(page);
+  }
+
+  Task<std::vector<std::string>> CoroKmipClient::locate_by_group(
+      std::string group, object_type o_type, std::size_t max_ids
+  ) {
+    std::vector<std::string> result;
+    auto pages =
+        locate_pages(std::move(group), o_type, MAX_ITEMS_IN_BATCH, max_ids);
+    while (auto page = co_await pages.next()) {
+      std::move(page->begin(), page->end(), std::back_inserter(result));
+    }
+    co_return std::move(result);
+  }
+
+  CoroKmipClient::LocatePages CoroKmipClient::locate_pages(
+      std::string group,
+      object_type o_type,
+      std::size_t page_size,
+      std::size_t max_ids
+  ) {
+    return LocatePages(*this, std::move(group), o_type, page_size, max_ids);
+  }
+
+  Task<std::string> CoroKmipClient::revoke(
+      std::string id,
+      revocation_reason_type reason,
+      std::string message,
+      time_t occurrence_time
+  ) {
+    auto request = make_request_message();
+    const auto batch_item_id = request.add_batch_item(
+        kmipcore::RevokeRequest(id, reason, message, occurrence_time)
+    );
+
+    const auto response_bytes = co_await exchange(request);
+
+    kmipcore::ResponseParser rf(response_bytes, request);
+    co_return rf
+        .getResponseByBatchItemId<kmipcore::RevokeResponseBatchItem>(
+            batch_item_id
+        )
+        .getUniqueIdentifier();
+  }
+
+  Task<std::string> CoroKmipClient::destroy(std::string id) {
+    auto request = make_request_message();
+    const auto batch_item_id =
+        request.add_batch_item(kmipcore::DestroyRequest(id));
+
+    const auto response_bytes = co_await exchange(request);
+
+    kmipcore::ResponseParser rf(response_bytes, request);
+    co_return rf
+        .getResponseByBatchItemId<kmipcore::DestroyResponseBatchItem>(
+            batch_item_id
+        )
+        .getUniqueIdentifier();
+  }
+
+  // ============================================================================
+  // LocatePages
+  // ============================================================================
+
+  CoroKmipClient::LocatePages::LocatePages(
+      CoroKmipClient &client,
+      std::string group,
+      object_type o_type,
+      std::size_t page_size,
+      std::size_t max_ids
+  )
+    : client_(&client),
+      group_(std::move(group)),
+      o_type_(o_type),
+      page_size_(page_size),
+      max_ids_(max_ids),
+      finished_(page_size == 0 || max_ids == 0) {}
+
+  Task<std::optional<std::vector<std::string>>>
+      CoroKmipClient::LocatePages::next() {
+    if (finished_) {
+      co_return std::nullopt;
+    }
+
+    const std::size_t wanted = std::min(page_size_, max_ids_ - offset_);
+    auto page = co_await client_->locate_page(group_, o_type_, offset_, wanted);
+
+    if (page.located_items) {
+      located_items_ = page.located_items;
+    }
+    if (page.ids.size() > wanted) {
+      page.ids.resize(wanted);
+    }
+    offset_ += page.ids.size();
+    if (page.ids.empty() || offset_ >= max_ids_ ||
+        (located_items_ && offset_ >= *located_items_)) {
+      finished_ = true;
+    }
+    if (page.ids.empty()) {
+      co_return std::nullopt;
+    }
+    co_return std::move(page.ids);
+  }
+
+}  // namespace kmipclient
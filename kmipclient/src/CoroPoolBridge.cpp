@@ -0,0 +1,198 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CoroPoolBridge.hpp"
+
+#include <algorithm>
+
+namespace kmipclient {
+
+  // ============================================================================
+  // LocatePages
+  // ============================================================================
+
+  CoroPoolBridge::LocatePages::LocatePages(
+      CoroPoolBridge &client,
+      std::string group,
+      object_type o_type,
+      std::size_t page_size,
+      std::size_t max_ids
+  )
+    : client_(&client),
+      group_(std::move(group)),
+      o_type_(o_type),
+      page_size_(page_size),
+      max_ids_(max_ids),
+      finished_(page_size == 0 || max_ids == 0) {}
+
+  Task<std::optional<std::vector<std::string>>>
+      CoroPoolBridge::LocatePages::next() {
+    if (finished_) {
+      co_return std::nullopt;
+    }
+
+    const std::size_t wanted = std::min(page_size_, max_ids_ - offset_);
+    // Named rather than passed as a temporary: GCC 12 frees the captures of
+    // a lambda temporary in a co_await expression twice.
+    auto fetch = [group = group_, o_type = o_type_, offset = offset_, wanted](
+                     KmipClient &c
+                 ) {
+      std::optional<std::size_t> located_items;
+      auto ids = c.op_locate_page_by_group(
+          group, o_type, offset, wanted, &located_items
+      );
+      return std::make_pair(std::move(ids), located_items);
+    };
+    auto fetched = co_await client_->run(std::move(fetch));
+    auto &page = fetched.first;
+
+    if (fetched.second) {
+      located_items_ = fetched.second;
+    }
+    if (page.size() > wanted) {
+      page.resize(wanted);
+    }
+    offset_ += page.size();
+    if (page.empty() || offset_ >= max_ids_ ||
+        (located_items_ && offset_ >= *located_items_)) {
+      finished_ = true;
+    }
+    if (page.empty()) {
+      co_return std::nullopt;
+    }
+    co_return std::move(page);
+  }
+
+  // ============================================================================
+  // KMIP operations
+  // ============================================================================
+
+  CoroPoolBridge::Operation<std::string> CoroPoolBridge::register_key(
+      const std::string &name, const std::string &group, const Key &k
+  ) {
+    std::shared_ptr<const Key> key = k.clone();
+    return run([name, group, key](KmipClient &c) {
+      return c.op_register_key(name, group, *key);
+    });
+  }
+
+  CoroPoolBridge::Operation<std::string> CoroPoolBridge::register_secret(
+      const std::string &name, const std::string &group, const Secret &secret
+  ) {
+    return run([name, group, secret](KmipClient &c) {
+      return c.op_register_secret(name, group, secret);
+    });
+  }
+
+  CoroPoolBridge::Operation<std::string> CoroPoolBridge::create_aes_key(
+      const std::string &name,
+      const std::string &group,
+      aes_key_size key_size,
+      cryptographic_usage_mask usage_mask
+  ) {
+    return run([name, group, key_size, usage_mask](KmipClient &c) {
+      return c.op_create_aes_key(name, group, key_size, usage_mask);
+    });
+  }
+
+  CoroPoolBridge::Operation<std::unique_ptr<Key>>
+      CoroPoolBridge::get_key(const std::string &id, bool all_attributes) {
+    return run([id, all_attributes](KmipClient &c) {
+      return c.op_get_key(id, all_attributes);
+    });
+  }
+
+  CoroPoolBridge::Operation<Secret>
+      CoroPoolBridge::get_secret(const std::string &id, bool all_attributes) {
+    return run([id, all_attributes](KmipClient &c) {
+      return c.op_get_secret(id, all_attributes);
+    });
+  }
+
+  CoroPoolBridge::Operation<std::string>
+      CoroPoolBridge::activate(const std::string &id) {
+    return run([id](KmipClient &c) { return c.op_activate(id); });
+  }
+
+  CoroPoolBridge::Operation<std::vector<std::string>>
+      CoroPoolBridge::get_attribute_list(const std::string &id) {
+    return run([id](KmipClient &c) { return c.op_get_attribute_list(id); });
+  }
+
+  CoroPoolBridge::Operation<kmipcore::Attributes>
+      CoroPoolBridge::get_attributes(
+          const std::string &id, const std::vector<std::string> &attr_names
+      ) {
+    return run([id, attr_names](KmipClient &c) {
+      return c.op_get_attributes(id, attr_names);
+    });
+  }
+
+  CoroPoolBridge::Operation<std::vector<std::string>>
+      CoroPoolBridge::locate_by_name(
+          const std::string &name, object_type o_type
+      ) {
+    return run([name, o_type](KmipClient &c) {
+      return c.op_locate_by_name(name, o_type);
+    });
+  }
+
+  CoroPoolBridge::Operation<std::vector<std::string>>
+      CoroPoolBridge::locate_by_group(
+          const std::string &group, object_type o_type, std::size_t max_ids
+      ) {
+    return run([group, o_type, max_ids](KmipClient &c) {
+      return c.op_locate_by_group(group, o_type, max_ids);
+    });
+  }
+
+  CoroPoolBridge::LocatePages CoroPoolBridge::locate_pages(
+      const std::string &group,
+      object_type o_type,
+      std::size_t page_size,
+      std::size_t max_ids
+  ) {
+    return LocatePages(*this, group, o_type, page_size, max_ids);
+  }
+
+  CoroPoolBridge::Operation<std::string> CoroPoolBridge::revoke(
+      const std::string &id,
+      revocation_reason_type reason,
+      const std::string &message,
+      time_t occurrence_time
+  ) {
+    return run([id, reason, message, occurrence_time](KmipClient &c) {
+      return c.op_revoke(id, reason, message, occurrence_time);
+    });
+  }
+
+  CoroPoolBridge::Operation<std::string>
+      CoroPoolBridge::destroy(const std::string &id) {
+    return run([id](KmipClient &c) { return c.op_destroy(id); });
+  }
+
+  CoroPoolBridge::Operation<std::vector<kmipcore::ProtocolVersion>>
+      CoroPoolBridge::discover_versions() {
+    return run([](KmipClient &c) { return c.op_discover_versions(); });
+  }
+
+  CoroPoolBridge::Operation<KmipClient::QueryServerInfo>
+      CoroPoolBridge::query() {
+    return run([](KmipClient &c) { return c.op_query(); });
+  }
+
+}  // namespace kmipclient
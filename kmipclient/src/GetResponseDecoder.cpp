@@ -0,0 +1,149 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "GetResponseDecoder.hpp"
+
+#include "kmipcore/attributes_parser.hpp"
+#include "kmipcore/key_parser.hpp"
+#include "kmipcore/kmip_responses.hpp"
+
+namespace kmipclient::detail {
+
+  namespace {
+
+    kmipcore::Attributes parse_attributes(
+        kmipcore::ResponseParser &rf, uint32_t attributes_item_id
+    ) {
+      auto attrs_response =
+          rf.getResponseByBatchItemId<kmipcore::GetAttributesResponseBatchItem>(
+              attributes_item_id
+          );
+      return kmipcore::AttributesParser::parse(attrs_response.getAttributes());
+    }
+
+    void require_state(const kmipcore::Attributes &server_attrs) {
+      if (!server_attrs.has_attribute(KMIP_ATTR_NAME_STATE)) {
+        throw kmipcore::KmipException(
+            "Required attribute 'State' missing from server response"
+        );
+      }
+    }
+
+  }  // namespace
+
+  std::vector<std::string> default_get_key_attrs(bool all_attributes) {
+    if (all_attributes) {
+      return {};
+    }
+    return {
+        KMIP_ATTR_NAME_STATE,
+        KMIP_ATTR_NAME_NAME,
+        KMIP_ATTR_NAME_OPERATION_POLICY_NAME,
+        KMIP_ATTR_NAME_CRYPTO_ALG,
+        KMIP_ATTR_NAME_CRYPTO_LEN,
+        KMIP_ATTR_NAME_CRYPTO_USAGE_MASK
+    };
+  }
+
+  std::vector<std::string> default_get_secret_attrs(bool all_attributes) {
+    if (all_attributes) {
+      return {};
+    }
+    return {
+        KMIP_ATTR_NAME_STATE,
+        KMIP_ATTR_NAME_NAME,
+        KMIP_ATTR_NAME_OPERATION_POLICY_NAME
+    };
+  }
+
+  bool should_retry_get_attributes_with_legacy_v2_encoding(
+      const kmipcore::KmipException &e
+  ) {
+    switch (e.code().value()) {
+      case kmipcore::KMIP_REASON_INVALID_MESSAGE:
+      case kmipcore::KMIP_REASON_INVALID_FIELD:
+      case kmipcore::KMIP_REASON_FEATURE_NOT_SUPPORTED:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  std::optional<ServerProfile::AttributeEncoding> next_attribute_encoding(
+      ServerProfile::AttributeEncoding failed,
+      bool has_selectors,
+      const kmipcore::KmipException &e
+  ) {
+    using Encoding = ServerProfile::AttributeEncoding;
+    const bool can_fall_back =
+        failed == Encoding::standard ||
+        (failed == Encoding::legacy_names && has_selectors);
+    if (!can_fall_back ||
+        !should_retry_get_attributes_with_legacy_v2_encoding(e)) {
+      return std::nullopt;
+    }
+    return failed == Encoding::standard ? Encoding::legacy_names
+                                        : Encoding::all_attributes;
+  }
+
+  std::unique_ptr<Key> decode_get_key(
+      kmipcore::ResponseParser &rf,
+      uint32_t get_item_id,
+      uint32_t attributes_item_id
+  ) {
+    auto get_response =
+        rf.getResponseByBatchItemId<kmipcore::GetResponseBatchItem>(get_item_id);
+    auto core_key = kmipcore::KeyParser::parseGetKeyResponse(get_response);
+    auto key = Key::from_core_key(core_key);
+
+    const auto server_attrs = parse_attributes(rf, attributes_item_id);
+    // Verify required attributes are present in the server response.
+    require_state(server_attrs);
+    // Merge server-provided metadata (state, name, dates, …) into the key.
+    key->attributes().merge(server_attrs);
+    return key;
+  }
+
+  Secret decode_get_secret(
+      kmipcore::ResponseParser &rf,
+      uint32_t get_item_id,
+      uint32_t attributes_item_id,
+      bool all_attributes
+  ) {
+    auto get_response =
+        rf.getResponseByBatchItemId<kmipcore::GetResponseBatchItem>(get_item_id);
+    Secret secret = kmipcore::KeyParser::parseGetSecretResponse(get_response);
+
+    const auto server_attrs = parse_attributes(rf, attributes_item_id);
+    if (all_attributes) {
+      // Merge all server-provided attributes into the secret.
+      secret.attributes().merge(server_attrs);
+      return secret;
+    }
+
+    require_state(server_attrs);
+    // Copy only the minimal set: state (typed) + optional name (generic).
+    secret.set_state(server_attrs.object_state());
+    if (server_attrs.has_attribute(KMIP_ATTR_NAME_NAME)) {
+      secret.set_attribute(
+          KMIP_ATTR_NAME_NAME, std::string(server_attrs.get(KMIP_ATTR_NAME_NAME))
+      );
+    }
+    return secret;
+  }
+
+}  // namespace kmipclient::detail
@@ -0,0 +1,75 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef KMIPCLIENT_GET_RESPONSE_DECODER_HPP
+#define KMIPCLIENT_GET_RESPONSE_DECODER_HPP
+
+#include "kmipclient/Key.hpp"
+#include "kmipclient/ServerProfile.hpp"
+#include "kmipclient/types.hpp"
+#include "kmipcore/kmip_errors.hpp"
+#include "kmipcore/response_parser.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace kmipclient::detail {
+
+  /// Attribute selectors sent with Get when fetching a key.
+  std::vector<std::string> default_get_key_attrs(bool all_attributes);
+
+  /// Attribute selectors sent with Get when fetching a secret.
+  std::vector<std::string> default_get_secret_attrs(bool all_attributes);
+
+  /// True when a failed Get Attributes may succeed with the KMIP 2.0 legacy
+  /// attribute-name encoding.
+  bool should_retry_get_attributes_with_legacy_v2_encoding(
+      const kmipcore::KmipException &e
+  );
+
+  /// Get Attributes encoding to try after @p failed was rejected with @p e:
+  /// legacy attribute names after KMIP 2.0 Attribute References, then no
+  /// selectors at all when there were any.  std::nullopt when none is left.
+  std::optional<ServerProfile::AttributeEncoding> next_attribute_encoding(
+      ServerProfile::AttributeEncoding failed,
+      bool has_selectors,
+      const kmipcore::KmipException &e
+  );
+
+  /// Decodes a Get + Get Attributes item pair into a key with merged
+  /// server attributes.
+  std::unique_ptr<Key> decode_get_key(
+      kmipcore::ResponseParser &rf,
+      uint32_t get_item_id,
+      uint32_t attributes_item_id
+  );
+
+  /// Decodes a Get + Get Attributes item pair into a secret.  Without
+  /// @p all_attributes only the state and name are kept.
+  Secret decode_get_secret(
+      kmipcore::ResponseParser &rf,
+      uint32_t get_item_id,
+      uint32_t attributes_item_id,
+      bool all_attributes
+  );
+
+}  // namespace kmipclient::detail
+
+#endif  // KMIPCLIENT_GET_RESPONSE_DECODER_HPP
@@ -0,0 +1,208 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/HedgedKmipClient.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <algorithm>
+
+namespace kmipclient {
+
+  // ============================================================================
+  // Worker management
+  // ============================================================================
+
+  HedgedKmipClient::HedgedKmipClient(KmipClusterPool &cluster)
+    : HedgedKmipClient(cluster, Config{}) {}
+
+  HedgedKmipClient::HedgedKmipClient(
+      KmipClusterPool &cluster, const Config &config
+  )
+    : cluster_(cluster),
+      config_(config),
+      hedge_delay_us_(
+          std::max(
+              std::chrono::microseconds(config_.initial_delay),
+              std::chrono::microseconds(config_.min_delay)
+          )
+              .count()
+      ) {
+    if (config_.percentile < 0.0 || config_.percentile > 1.0) {
+      throw kmipcore::KmipException(
+          -1, "HedgedKmipClient: percentile must be in [0, 1]"
+      );
+    }
+    if (config_.max_hedge_ratio < 0.0) {
+      throw kmipcore::KmipException(
+          -1, "HedgedKmipClient: max_hedge_ratio must not be negative"
+      );
+    }
+    if (config_.refresh_samples == 0) {
+      throw kmipcore::KmipException(
+          -1, "HedgedKmipClient: refresh_samples must be greater than zero"
+      );
+    }
+
+    // Two attempts per call may be running at once.
+    const size_t count = config_.workers != 0
+                             ? config_.workers
+                             : std::max<size_t>(2, cluster_.max_connections());
+    workers_.reserve(count);
+    try {
+      for (size_t i = 0; i < count; ++i) {
+        workers_.emplace_back([this] { run_worker(); });
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lk(mutex_);
+        stopping_ = true;
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+      throw;
+    }
+  }
+
+  HedgedKmipClient::~HedgedKmipClient() {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void HedgedKmipClient::post(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (stopping_) {
+        throw kmipcore::KmipException(
+            -1, "HedgedKmipClient: client is shutting down"
+        );
+      }
+      queue_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+  }
+
+  void HedgedKmipClient::run_worker() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lk(mutex_);
+        cv_.wait(lk, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return;  // stopping and drained
+        }
+        task = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      task();
+    }
+  }
+
+  // ============================================================================
+  // Hedging policy
+  // ============================================================================
+
+  void HedgedKmipClient::record_latency(
+      std::chrono::steady_clock::duration latency
+  ) {
+    latencies_.record(latency);
+    const auto samples = samples_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (samples < config_.min_samples ||
+        (samples != config_.min_samples &&
+         samples % config_.refresh_samples != 0)) {
+      return;
+    }
+    // Only the attempt that completed the interval sorts the samples.
+    if (const auto observed =
+            latencies_.percentile(config_.percentile, config_.min_samples)) {
+      hedge_delay_us_.store(
+          std::max(*observed, std::chrono::microseconds(config_.min_delay))
+              .count(),
+          std::memory_order_relaxed
+      );
+    }
+  }
+
+  bool HedgedKmipClient::take_hedge_budget() noexcept {
+    if (config_.max_hedge_ratio <= 0.0) {
+      return false;
+    }
+    // One hedge is always allowed so a cold client can hedge its first call.
+    const auto calls = requests_.load(std::memory_order_relaxed);
+    const auto hedges = hedges_sent_.load(std::memory_order_relaxed);
+    const double allowed =
+        1.0 + config_.max_hedge_ratio * static_cast<double>(calls);
+    if (static_cast<double>(hedges) >= allowed) {
+      return false;
+    }
+    hedges_sent_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // ============================================================================
+  // KMIP operations
+  // ============================================================================
+  // Arguments are captured by value: a losing attempt may still be running
+  // after the call returned.
+
+  std::unique_ptr<Key>
+      HedgedKmipClient::get_key(const std::string &id, bool all_attributes) {
+    return execute([id, all_attributes](KmipClient &c) {
+      return c.op_get_key(id, all_attributes);
+    });
+  }
+
+  Secret
+      HedgedKmipClient::get_secret(const std::string &id, bool all_attributes) {
+    return execute([id, all_attributes](KmipClient &c) {
+      return c.op_get_secret(id, all_attributes);
+    });
+  }
+
+  kmipcore::Attributes HedgedKmipClient::get_attributes(
+      const std::string &id, const std::vector<std::string> &attr_names
+  ) {
+    return execute([id, attr_names](KmipClient &c) {
+      return c.op_get_attributes(id, attr_names);
+    });
+  }
+
+  std::vector<std::string> HedgedKmipClient::locate_by_name(
+      const std::string &name, object_type o_type
+  ) {
+    return execute([name, o_type](KmipClient &c) {
+      return c.op_locate_by_name(name, o_type);
+    });
+  }
+
+  std::vector<std::string> HedgedKmipClient::locate_by_group(
+      const std::string &group, object_type o_type, std::size_t max_ids
+  ) {
+    return execute([group, o_type, max_ids](KmipClient &c) {
+      return c.op_locate_by_group(group, o_type, max_ids);
+    });
+  }
+
+}  // namespace kmipclient
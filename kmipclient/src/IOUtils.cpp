@@ -21,24 +21,9 @@
 #include "kmipcore/kmip_formatter.hpp"
 #include "kmipcore/kmip_logger.hpp"
 
-#include <algorithm>
-#include <array>
-#include <cstring>
 #include <sstream>
 
 namespace kmipclient {
-#define KMIP_MSG_LENGTH_BYTES 8
-
-  namespace {
-
-    [[nodiscard]] int32_t read_int32_be(std::span<const uint8_t> bytes) {
-      return (static_cast<int32_t>(bytes[0]) << 24) |
-             (static_cast<int32_t>(bytes[1]) << 16) |
-             (static_cast<int32_t>(bytes[2]) << 8) |
-             static_cast<int32_t>(bytes[3]);
-    }
-
-  }  // namespace
 
   void IOUtils::log_debug(
       const char *event, std::span<const uint8_t> ttlv
@@ -66,79 +51,84 @@ namespace kmipclient {
     const int dlen = static_cast<int>(request_bytes.size());
     if (dlen <= 0) {
       throw KmipIOException(
-          kmipcore::KMIP_IO_FAILURE, "Can not send empty KMIP request."
+          kmipcore::KMIP_IO_FAILURE, "Can not send empty KMIP request.", false
       );
     }
 
     int total_sent = 0;
     while (total_sent < dlen) {
-      const int sent = net_client.send(
-          std::span<const uint8_t>(request_bytes)
-              .subspan(static_cast<size_t>(total_sent))
-      );
+      int sent = 0;
+      try {
+        sent = net_client.send(
+            std::span<const uint8_t>(request_bytes)
+                .subspan(static_cast<size_t>(total_sent))
+        );
+      } catch (KmipIOException &e) {
+        e.set_bytes_sent(total_sent > 0);
+        throw;
+      }
       if (sent <= 0) {
         std::ostringstream oss;
         oss << "Can not send request. Bytes total: " << dlen
             << ", bytes sent: " << total_sent;
         throw KmipIOException(
-            kmipcore::KMIP_IO_FAILURE,
-            oss.str()
+            kmipcore::KMIP_IO_FAILURE, oss.str(), total_sent > 0
         );
       }
       total_sent += sent;
     }
   }
 
-  void IOUtils::read_exact(std::span<uint8_t> buf) {
-    int total_read = 0;
-    const int n = static_cast<int>(buf.size());
-    while (total_read < n) {
-      const int received =
-          net_client.recv(buf.subspan(static_cast<size_t>(total_read)));
+  std::vector<uint8_t> IOUtils::read_message(size_t max_message_size) {
+    for (;;) {
+      if (auto message = framer_.next_message(max_message_size)) {
+        return std::move(*message);
+      }
+
+      const auto window = framer_.write_window();
+      const int received = net_client.recv(window);
       if (received <= 0) {
         std::ostringstream oss;
-        oss << "Connection closed or error while reading. Expected " << n
-            << ", got " << total_read;
-        throw KmipIOException(
-            kmipcore::KMIP_IO_FAILURE,
-            oss.str()
-        );
+        oss << "Connection closed or error while reading. Buffered "
+            << framer_.buffered() << " bytes of an incomplete message";
+        throw KmipIOException(kmipcore::KMIP_IO_FAILURE, oss.str());
       }
-      total_read += received;
+      framer_.commit(static_cast<size_t>(received));
     }
   }
 
-  std::vector<uint8_t> IOUtils::receive_message(size_t max_message_size) {
-    std::array<uint8_t, KMIP_MSG_LENGTH_BYTES> msg_len_buf{};
-
-    read_exact(msg_len_buf);
+  void IOUtils::abort_connection() noexcept {
+    // Mark the underlying connection as dead so the pool (via
+    // return_slot → is_connected() check) discards this slot
+    // automatically — no need for the caller to call markUnhealthy().
+    net_client.close();
+    framer_.reset();
+  }
 
-    const int32_t length = read_int32_be(std::span(msg_len_buf).subspan(4, 4));
-    const std::size_t effective_limit =
-        std::min(max_message_size, kmipcore::KMIP_MAX_MESSAGE_HARD_LIMIT);
-    if (length < 0 || static_cast<size_t>(length) > effective_limit) {
-      std::ostringstream oss;
-      oss << "Message too long. Length: " << length
-          << ", allowed: " << effective_limit;
-      throw KmipIOException(
-          kmipcore::KMIP_EXCEED_MAX_MESSAGE_SIZE,
-          oss.str()
-      );
+  void IOUtils::send_message(const std::vector<uint8_t> &request_bytes) {
+    if (!net_client.is_connected()) {
+      // Bytes read ahead from a previous connection can never belong to a
+      // response on the next one.
+      framer_.reset();
     }
+    try {
+      log_debug("request", request_bytes);
+      send(request_bytes);
+    } catch (const KmipIOException &) {
+      abort_connection();
+      throw;
+    }
+  }
 
-    std::vector<uint8_t> response(
-        KMIP_MSG_LENGTH_BYTES + static_cast<size_t>(length)
-    );
-    memcpy(response.data(), msg_len_buf.data(), KMIP_MSG_LENGTH_BYTES);
-
-    read_exact(
-        std::span(response).subspan(
-            KMIP_MSG_LENGTH_BYTES, static_cast<size_t>(length)
-        )
-    );
-
-
-    return response;
+  std::vector<uint8_t> IOUtils::receive_message(size_t max_message_size) {
+    try {
+      auto response_bytes = read_message(max_message_size);
+      log_debug("response", response_bytes);
+      return response_bytes;
+    } catch (const KmipIOException &) {
+      abort_connection();
+      throw;
+    }
   }
 
   void IOUtils::do_exchange(
@@ -146,18 +136,8 @@ namespace kmipclient {
       std::vector<uint8_t> &response_bytes,
       size_t max_message_size
   ) {
-    try {
-      log_debug("request", request_bytes);
-      send(request_bytes);
-      response_bytes = receive_message(max_message_size);
-      log_debug("response", response_bytes);
-    } catch (const KmipIOException &) {
-      // Mark the underlying connection as dead so the pool (via
-      // return_slot → is_connected() check) discards this slot
-      // automatically — no need for the caller to call markUnhealthy().
-      net_client.close();
-      throw;
-    }
+    send_message(request_bytes);
+    response_bytes = receive_message(max_message_size);
   }
 
 }  // namespace kmipclient
@@ -18,6 +18,7 @@
 #ifndef IOUTILS_HPP
 #define IOUTILS_HPP
 
+#include "MessageFramer.hpp"
 #include "kmipclient/NetClient.hpp"
 #include "kmipclient/types.hpp"
 #include "kmipcore/kmip_logger.hpp"
@@ -42,19 +43,36 @@ namespace kmipclient {
         size_t max_message_size
     );
 
+    /**
+     * Sends one complete request message without waiting for its response.
+     * Closes the transport and rethrows on KmipIOException.
+     */
+    void send_message(const std::vector<uint8_t> &request_bytes);
+
+    /**
+     * Receives the next complete response message.  Responses arrive in the
+     * order their requests were sent.  Closes the transport and rethrows on
+     * KmipIOException.
+     */
+    std::vector<uint8_t> receive_message(size_t max_message_size);
+
   private:
     void log_debug(const char *event, std::span<const uint8_t> ttlv) const;
     void send(const std::vector<uint8_t> &request_bytes) const;
-    std::vector<uint8_t> receive_message(size_t max_message_size);
 
     /**
-     * Reads exactly n bytes from the network into the buffer.
-     * Throws KmipException on error or prematureEOF.
+     * Returns the next complete message from the read-ahead buffer, pulling
+     * more bytes from the transport only when the buffered data is short.
+     * Throws KmipIOException on error or premature EOF.
      */
-    void read_exact(std::span<uint8_t> buf);
+    std::vector<uint8_t> read_message(size_t max_message_size);
+
+    /** Closes the transport and drops read-ahead bytes after an I/O error. */
+    void abort_connection() noexcept;
 
     NetClient &net_client;
     std::shared_ptr<kmipcore::Logger> logger_;
+    MessageFramer framer_;
   };
 
 }  // namespace kmipclient
@@ -17,9 +17,10 @@
 
 #include "kmipclient/KmipClient.hpp"
 
+#include "GetResponseDecoder.hpp"
 #include "IOUtils.hpp"
+#include "kmipclient/KmipIOException.hpp"
 #include "kmipcore/attributes_parser.hpp"
-#include "kmipcore/key_parser.hpp"
 #include "kmipcore/kmip_errors.hpp"
 #include "kmipcore/kmip_requests.hpp"
 #include "kmipcore/response_parser.hpp"
@@ -28,48 +29,54 @@
 #include <array>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <unordered_set>
 
 namespace kmipclient {
 
-  static std::vector<std::string> default_get_key_attrs(bool all_attributes) {
-    if (all_attributes) {
-      return {};
-    }
-    return {
-        KMIP_ATTR_NAME_STATE,
-        KMIP_ATTR_NAME_NAME,
-        KMIP_ATTR_NAME_OPERATION_POLICY_NAME,
-        KMIP_ATTR_NAME_CRYPTO_ALG,
-        KMIP_ATTR_NAME_CRYPTO_LEN,
-        KMIP_ATTR_NAME_CRYPTO_USAGE_MASK
-    };
-  }
+  namespace {
+
+    /// Runs @p execute(selectors, legacy attribute names) with the Get
+    /// Attributes encoding the server accepts.  Starting from the one
+    /// recorded in @p profile, it falls back from KMIP 2.0 Attribute
+    /// References to legacy names and then to requesting all attributes on
+    /// compatibility errors, and records the encoding that worked.
+    template <typename Execute>
+    auto with_attribute_encoding(
+        const kmipcore::ProtocolVersion &version,
+        ServerProfile *profile,
+        const std::vector<std::string> &selectors,
+        const Execute &execute
+    ) -> decltype(execute(selectors, false)) {
+      using Encoding = ServerProfile::AttributeEncoding;
+      if (!version.is_at_least(2, 0)) {
+        return execute(selectors, false);
+      }
 
-  static std::vector<std::string>
-      default_get_secret_attrs(bool all_attributes) {
-    if (all_attributes) {
-      return {};
+      auto encoding = profile != nullptr ? profile->attribute_encoding()
+                                         : Encoding::standard;
+      for (;;) {
+        try {
+          const bool legacy_names = encoding != Encoding::standard;
+          auto result = encoding == Encoding::all_attributes
+                            ? execute({}, legacy_names)
+                            : execute(selectors, legacy_names);
+          if (profile != nullptr && encoding != Encoding::standard) {
+            profile->set_attribute_encoding(encoding);
+          }
+          return result;
+        } catch (const kmipcore::KmipException &e) {
+          const auto next =
+              detail::next_attribute_encoding(encoding, !selectors.empty(), e);
+          if (!next) {
+            throw;
+          }
+          encoding = *next;
+        }
+      }
     }
-    return {
-        KMIP_ATTR_NAME_STATE,
-        KMIP_ATTR_NAME_NAME,
-        KMIP_ATTR_NAME_OPERATION_POLICY_NAME
-    };
-  }
 
-  static bool should_retry_get_attributes_with_legacy_v2_encoding(
-      const kmipcore::KmipException &e
-  ) {
-    switch (e.code().value()) {
-      case kmipcore::KMIP_REASON_INVALID_MESSAGE:
-      case kmipcore::KMIP_REASON_INVALID_FIELD:
-      case kmipcore::KMIP_REASON_FEATURE_NOT_SUPPORTED:
-        return true;
-      default:
-        return false;
-    }
-  }
+  }  // namespace
 
   KmipClient::KmipClient(
       NetClient &net_client,
@@ -104,7 +111,10 @@ namespace kmipclient {
       net_client_owner_(std::move(other.net_client_owner_)),
       io(std::move(other.io)),
       version_(other.version_),
-      close_on_destroy_(other.close_on_destroy_) {
+      close_on_destroy_(other.close_on_destroy_),
+      exchange_observer_(std::move(other.exchange_observer_)),
+      retry_policy_(other.retry_policy_),
+      server_profile_(std::move(other.server_profile_)) {
     other.net_client = nullptr;
     other.close_on_destroy_ = false;
   }
@@ -116,6 +126,9 @@ namespace kmipclient {
       io = std::move(other.io);
       version_ = other.version_;
       close_on_destroy_ = other.close_on_destroy_;
+      exchange_observer_ = std::move(other.exchange_observer_);
+      retry_policy_ = other.retry_policy_;
+      server_profile_ = std::move(other.server_profile_);
 
       other.net_client = nullptr;
       other.close_on_destroy_ = false;
@@ -149,6 +162,67 @@ namespace kmipclient {
     }
   };
 
+  std::vector<uint8_t>
+      KmipClient::exchange(const kmipcore::RequestMessage &request) const {
+    const auto request_bytes = request.serialize();
+    if (retry_policy_.max_attempts <= 1) {
+      return exchange_once(request_bytes, request.getMaxResponseSize());
+    }
+
+    const bool idempotent = RetryPolicy::is_idempotent(request);
+    const auto started = std::chrono::steady_clock::now();
+    for (unsigned attempt = 1;; ++attempt) {
+      std::chrono::milliseconds wait{0};
+      try {
+        if (attempt > 1) {
+          reconnect();
+        }
+        return exchange_once(request_bytes, request.getMaxResponseSize());
+      } catch (const KmipIOException &e) {
+        if (!retry_policy_.may_retry(idempotent, e, attempt)) {
+          throw;
+        }
+        wait = retry_policy_.backoff(attempt);
+        const auto budget = retry_policy_.budget;
+        if (budget.count() > 0 &&
+            std::chrono::steady_clock::now() - started + wait >= budget) {
+          throw;
+        }
+      }
+      std::this_thread::sleep_for(wait);
+    }
+  }
+
+  std::vector<uint8_t> KmipClient::exchange_once(
+      const std::vector<uint8_t> &request_bytes, size_t max_response_size
+  ) const {
+    std::vector<uint8_t> response_bytes;
+    if (!exchange_observer_) {
+      io->do_exchange(request_bytes, response_bytes, max_response_size);
+      return response_bytes;
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    try {
+      io->do_exchange(request_bytes, response_bytes, max_response_size);
+    } catch (...) {
+      exchange_observer_(std::chrono::steady_clock::now() - started, false);
+      throw;
+    }
+    exchange_observer_(std::chrono::steady_clock::now() - started, true);
+    return response_bytes;
+  }
+
+  void KmipClient::reconnect() const {
+    net_client->close();
+    try {
+      net_client->connect();
+    } catch (KmipIOException &e) {
+      e.set_bytes_sent(false);  // the request was not sent on this attempt
+      throw;
+    }
+  }
+
   std::string KmipClient::op_register_key(
       const std::string &name, const std::string &group, const Key &k
   ) const {
@@ -162,10 +236,7 @@ namespace kmipclient {
         )
     );
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     return rf
@@ -189,10 +260,7 @@ namespace kmipclient {
         )
     );
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     return rf
@@ -220,10 +288,7 @@ namespace kmipclient {
         )
     );
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     return rf
@@ -233,220 +298,222 @@ namespace kmipclient {
         .getUniqueIdentifier();
   }
 
+  std::string KmipClient::op_create_and_activate(
+      const std::string &name,
+      const std::string &group,
+      aes_key_size key_size,
+      cryptographic_usage_mask usage_mask
+  ) const {
+    return activate_created(
+        kmipcore::CreateSymmetricKeyRequest(
+            name,
+            group,
+            static_cast<int32_t>(key_size),
+            usage_mask,
+            make_request_message().getHeader().getProtocolVersion()
+        )
+    );
+  }
+
+  std::string KmipClient::op_register_and_activate(
+      const std::string &name, const std::string &group, const Key &k
+  ) const {
+    return activate_created(
+        kmipcore::RegisterKeyRequest(
+            name,
+            group,
+            k.to_core_key(),
+            make_request_message().getHeader().getProtocolVersion()
+        )
+    );
+  }
+
+  std::string
+      KmipClient::activate_created(kmipcore::RequestBatchItem item) const {
+    const bool chain =
+        server_profile_ == nullptr || server_profile_->id_placeholders();
+    auto request = make_request_message();
+    const auto operation = item.getOperation();
+    const auto created_item_id = request.add_batch_item(std::move(item));
+    std::optional<uint32_t> activate_item_id;
+    if (chain) {
+      activate_item_id = request.add_chained_batch_item(
+          kmipcore::ActivateRequest(kmipcore::ID_PLACEHOLDER)
+      );
+    }
+
+    const auto response_bytes = exchange(request);
+
+    kmipcore::ResponseParser rf(response_bytes, request);
+    const auto id =
+        operation == kmipcore::KMIP_OP_CREATE
+            ? rf.getResponseByBatchItemId<kmipcore::CreateResponseBatchItem>(
+                    created_item_id
+                )
+                  .getUniqueIdentifier()
+            : rf.getResponseByBatchItemId<kmipcore::RegisterResponseBatchItem>(
+                    created_item_id
+                )
+                  .getUniqueIdentifier();
+    if (activate_item_id) {
+      try {
+        (void) rf.getResponseByBatchItemId<kmipcore::ActivateResponseBatchItem>(
+            *activate_item_id
+        );
+        return id;
+      } catch (const kmipcore::KmipException &) {
+        // Retried below with the identifier, which also reports any
+        // genuine Activate error.
+      }
+    }
+    (void) op_activate(id);
+    if (activate_item_id && server_profile_ != nullptr) {
+      server_profile_->set_id_placeholders(false);
+    }
+    return id;
+  }
+
   std::unique_ptr<Key>
       KmipClient::op_get_key(const std::string &id, bool all_attributes) const {
-    const auto requested_attrs = default_get_key_attrs(all_attributes);
-    const auto execute = [&](bool legacy_attribute_names_for_v2) {
-      auto request = make_request_message();
-      const auto get_item_id = request.add_batch_item(kmipcore::GetRequest(id));
+    const auto requested_attrs = detail::default_get_key_attrs(all_attributes);
+    const auto execute = [&](const std::vector<std::string> &selectors,
+                             bool legacy_attribute_names_for_v2) {
+      return get_key_once(id, selectors, legacy_attribute_names_for_v2);
+    };
 
-      const auto attributes_item_id = request.add_batch_item(
+    // The last fallback, for servers that reject explicit selectors in Get
+    // Attributes requests, requests all attributes and filters client-side.
+    return with_attribute_encoding(
+        version_, server_profile_.get(), requested_attrs, execute
+    );
+  }
+
+  std::unique_ptr<Key> KmipClient::op_get_latest_in_group(
+      const std::string &group,
+      object_type o_type,
+      object_group_member member,
+      bool all_attributes
+  ) const {
+    const auto query = LocateQuery(o_type).in_group(group).group_member(member);
+    if (server_profile_ != nullptr && !server_profile_->id_placeholders()) {
+      const auto ids = op_locate(query, 1);
+      return ids.empty() ? nullptr : op_get_key(ids.front(), all_attributes);
+    }
+
+    std::string located;
+    bool resent = false;
+    const auto requested_attrs = detail::default_get_key_attrs(all_attributes);
+    const auto execute = [&](const std::vector<std::string> &selectors,
+                             bool legacy_attribute_names_for_v2)
+        -> std::unique_ptr<Key> {
+      if (!located.empty()) {
+        // An attribute encoding fallback.  The Locate is not sent again: it
+        // may have used up a Fresh group member and would find another.
+        resent = true;
+        return get_key_once(located, selectors, legacy_attribute_names_for_v2);
+      }
+      auto request = make_request_message();
+      const auto version = request.getHeader().getProtocolVersion();
+      const auto locate_item_id =
+          request.add_batch_item(kmipcore::LocateRequest(query, 1, 0, version));
+      // Get and Get Attributes read the placeholder Locate sets.
+      const auto get_item_id = request.add_chained_batch_item(
+          kmipcore::GetRequest(kmipcore::ID_PLACEHOLDER)
+      );
+      const auto attributes_item_id = request.add_chained_batch_item(
           kmipcore::GetAttributesRequest(
-              id,
-              requested_attrs,
-              request.getHeader().getProtocolVersion(),
+              kmipcore::ID_PLACEHOLDER,
+              selectors,
+              version,
               legacy_attribute_names_for_v2
           )
       );
 
-      std::vector<uint8_t> response_bytes;
-      io->do_exchange(
-          request.serialize(), response_bytes, request.getMaxResponseSize()
-      );
+      const auto response_bytes = exchange(request);
 
       kmipcore::ResponseParser rf(response_bytes, request);
-      auto get_response =
-          rf.getResponseByBatchItemId<kmipcore::GetResponseBatchItem>(
-              get_item_id
-          );
-      auto core_key = kmipcore::KeyParser::parseGetKeyResponse(get_response);
-      auto key = Key::from_core_key(core_key);
-
-      auto attrs_response =
-          rf.getResponseByBatchItemId<kmipcore::GetAttributesResponseBatchItem>(
-              attributes_item_id
-          );
-      kmipcore::Attributes server_attrs =
-          kmipcore::AttributesParser::parse(attrs_response.getAttributes());
-
-      // Verify required attributes are present in the server response.
-      if (!server_attrs.has_attribute(KMIP_ATTR_NAME_STATE)) {
-        throw kmipcore::KmipException(
-            "Required attribute 'State' missing from server response"
-        );
+      const auto ids =
+          rf.getResponseByBatchItemId<kmipcore::LocateResponseBatchItem>(
+                locate_item_id
+            )
+              .getUniqueIdentifiers();
+      if (ids.empty()) {
+        return nullptr;
       }
-      // Merge server-provided metadata (state, name, dates, …) into the key.
-      key->attributes().merge(server_attrs);
-      return key;
+      located = ids.front();
+      return detail::decode_get_key(rf, get_item_id, attributes_item_id);
     };
 
     try {
-      return execute(false);
-    } catch (const kmipcore::KmipException &first_error) {
-      if (!version_.is_at_least(2, 0) ||
-          !should_retry_get_attributes_with_legacy_v2_encoding(first_error)) {
+      return with_attribute_encoding(
+          version_, server_profile_.get(), requested_attrs, execute
+      );
+    } catch (const kmipcore::KmipException &) {
+      if (located.empty() || resent) {
         throw;
       }
     }
-    try {
-      return execute(true);
-    } catch (const kmipcore::KmipException &second_error) {
-      if (requested_attrs.empty() ||
-          !should_retry_get_attributes_with_legacy_v2_encoding(second_error)) {
-        throw;
-      }
+    // The key was located but the chained items failed: retry them with
+    // its identifier, which also reports any genuine Get error.
+    auto key = op_get_key(located, all_attributes);
+    if (server_profile_ != nullptr) {
+      server_profile_->set_id_placeholders(false);
     }
+    return key;
+  }
 
-    // Compatibility fallback for servers that reject explicit selectors in
-    // Get Attributes requests: request all attributes and filter client-side.
+  std::unique_ptr<Key> KmipClient::get_key_once(
+      const std::string &id,
+      const std::vector<std::string> &selectors,
+      bool legacy_attribute_names_for_v2
+  ) const {
     auto request = make_request_message();
     const auto get_item_id = request.add_batch_item(kmipcore::GetRequest(id));
     const auto attributes_item_id = request.add_batch_item(
         kmipcore::GetAttributesRequest(
-            id, {}, request.getHeader().getProtocolVersion(), true
+            id,
+            selectors,
+            request.getHeader().getProtocolVersion(),
+            legacy_attribute_names_for_v2
         )
     );
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+
+    const auto response_bytes = exchange(request);
+
     kmipcore::ResponseParser rf(response_bytes, request);
-    auto get_response =
-        rf.getResponseByBatchItemId<kmipcore::GetResponseBatchItem>(
-            get_item_id
-        );
-    auto core_key = kmipcore::KeyParser::parseGetKeyResponse(get_response);
-    auto key = Key::from_core_key(core_key);
-    auto attrs_response =
-        rf.getResponseByBatchItemId<kmipcore::GetAttributesResponseBatchItem>(
-            attributes_item_id
-        );
-    kmipcore::Attributes server_attrs =
-        kmipcore::AttributesParser::parse(attrs_response.getAttributes());
-    if (!server_attrs.has_attribute(KMIP_ATTR_NAME_STATE)) {
-      throw kmipcore::KmipException(
-          "Required attribute 'State' missing from server response"
-      );
-    }
-    key->attributes().merge(server_attrs);
-    return key;
+    return detail::decode_get_key(rf, get_item_id, attributes_item_id);
   }
 
   Secret KmipClient::op_get_secret(
       const std::string &id, bool all_attributes
   ) const {
-    const auto requested_attrs = default_get_secret_attrs(all_attributes);
-    const auto execute = [&](bool legacy_attribute_names_for_v2) {
+    const auto requested_attrs =
+        detail::default_get_secret_attrs(all_attributes);
+    const auto execute = [&](const std::vector<std::string> &selectors,
+                             bool legacy_attribute_names_for_v2) {
       auto request = make_request_message();
       const auto get_item_id = request.add_batch_item(kmipcore::GetRequest(id));
-
       const auto attributes_item_id = request.add_batch_item(
           kmipcore::GetAttributesRequest(
               id,
-              requested_attrs,
+              selectors,
               request.getHeader().getProtocolVersion(),
               legacy_attribute_names_for_v2
           )
       );
 
-      std::vector<uint8_t> response_bytes;
-      io->do_exchange(
-          request.serialize(), response_bytes, request.getMaxResponseSize()
-      );
+      const auto response_bytes = exchange(request);
 
       kmipcore::ResponseParser rf(response_bytes, request);
-      auto get_response =
-          rf.getResponseByBatchItemId<kmipcore::GetResponseBatchItem>(
-              get_item_id
-          );
-      Secret secret = kmipcore::KeyParser::parseGetSecretResponse(get_response);
-
-      auto attrs_response =
-          rf.getResponseByBatchItemId<kmipcore::GetAttributesResponseBatchItem>(
-              attributes_item_id
-          );
-      kmipcore::Attributes server_attrs =
-          kmipcore::AttributesParser::parse(attrs_response.getAttributes());
-
-      if (all_attributes) {
-        // Merge all server-provided attributes into the secret.
-        secret.attributes().merge(server_attrs);
-      } else {
-        if (!server_attrs.has_attribute(KMIP_ATTR_NAME_STATE)) {
-          throw kmipcore::KmipException(
-              "Required attribute 'State' missing from server response"
-          );
-        }
-        // Copy only the minimal set: state (typed) + optional name (generic).
-        secret.set_state(server_attrs.object_state());
-        if (server_attrs.has_attribute(KMIP_ATTR_NAME_NAME)) {
-          secret.set_attribute(
-              KMIP_ATTR_NAME_NAME,
-              std::string(server_attrs.get(KMIP_ATTR_NAME_NAME))
-          );
-        }
-      }
-
-      return secret;
+      return detail::decode_get_secret(
+          rf, get_item_id, attributes_item_id, all_attributes
+      );
     };
 
-    try {
-      return execute(false);
-    } catch (const kmipcore::KmipException &first_error) {
-      if (!version_.is_at_least(2, 0) ||
-          !should_retry_get_attributes_with_legacy_v2_encoding(first_error)) {
-        throw;
-      }
-    }
-    try {
-      return execute(true);
-    } catch (const kmipcore::KmipException &second_error) {
-      if (requested_attrs.empty() ||
-          !should_retry_get_attributes_with_legacy_v2_encoding(second_error)) {
-        throw;
-      }
-    }
-
-    auto request = make_request_message();
-    const auto get_item_id = request.add_batch_item(kmipcore::GetRequest(id));
-    const auto attributes_item_id = request.add_batch_item(
-        kmipcore::GetAttributesRequest(
-            id, {}, request.getHeader().getProtocolVersion(), true
-        )
+    // Same compatibility fallbacks as op_get_key().
+    return with_attribute_encoding(
+        version_, server_profile_.get(), requested_attrs, execute
     );
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
-    kmipcore::ResponseParser rf(response_bytes, request);
-    auto get_response =
-        rf.getResponseByBatchItemId<kmipcore::GetResponseBatchItem>(
-            get_item_id
-        );
-    Secret secret = kmipcore::KeyParser::parseGetSecretResponse(get_response);
-    auto attrs_response =
-        rf.getResponseByBatchItemId<kmipcore::GetAttributesResponseBatchItem>(
-            attributes_item_id
-        );
-    kmipcore::Attributes server_attrs =
-        kmipcore::AttributesParser::parse(attrs_response.getAttributes());
-    if (all_attributes) {
-      secret.attributes().merge(server_attrs);
-    } else {
-      if (!server_attrs.has_attribute(KMIP_ATTR_NAME_STATE)) {
-        throw kmipcore::KmipException(
-            "Required attribute 'State' missing from server response"
-        );
-      }
-      secret.set_state(server_attrs.object_state());
-      if (server_attrs.has_attribute(KMIP_ATTR_NAME_NAME)) {
-        secret.set_attribute(
-            KMIP_ATTR_NAME_NAME,
-            std::string(server_attrs.get(KMIP_ATTR_NAME_NAME))
-        );
-      }
-    }
-    return secret;
   }
 
   std::string KmipClient::op_activate(const std::string &id) const {
@@ -454,10 +521,7 @@ namespace kmipclient {
     const auto batch_item_id =
         request.add_batch_item(kmipcore::ActivateRequest(id));
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     return rf
@@ -473,10 +537,7 @@ namespace kmipclient {
     const auto batch_item_id =
         request.add_batch_item(kmipcore::GetAttributeListRequest(id));
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     auto response = rf.getResponseByBatchItemId<
@@ -501,10 +562,7 @@ namespace kmipclient {
           )
       );
 
-      std::vector<uint8_t> response_bytes;
-      io->do_exchange(
-          request.serialize(), response_bytes, request.getMaxResponseSize()
-      );
+      const auto response_bytes = exchange(request);
 
       kmipcore::ResponseParser rf(response_bytes, request);
       auto response =
@@ -514,23 +572,9 @@ namespace kmipclient {
       return kmipcore::AttributesParser::parse(response.getAttributes());
     };
 
-    try {
-      return execute(attr_names, false);
-    } catch (const kmipcore::KmipException &first_error) {
-      if (!version_.is_at_least(2, 0) ||
-          !should_retry_get_attributes_with_legacy_v2_encoding(first_error)) {
-        throw;
-      }
-    }
-    try {
-      return execute(attr_names, true);
-    } catch (const kmipcore::KmipException &second_error) {
-      if (attr_names.empty() ||
-          !should_retry_get_attributes_with_legacy_v2_encoding(second_error)) {
-        throw;
-      }
-    }
-    return execute({}, true);
+    return with_attribute_encoding(
+        version_, server_profile_.get(), attr_names, execute
+    );
   }
 
   std::vector<std::string> KmipClient::op_locate_by_name(
@@ -552,10 +596,7 @@ namespace kmipclient {
           )
       );
 
-      std::vector<uint8_t> response_bytes;
-      io->do_exchange(
-          request.serialize(), response_bytes, request.getMaxResponseSize()
-      );
+      const auto response_bytes = exchange(request);
 
       kmipcore::ResponseParser rf(response_bytes, request);
       auto response =
@@ -633,12 +674,52 @@ namespace kmipclient {
     return result;
   }
 
+  std::vector<std::string> KmipClient::op_locate(
+      const LocateQuery &query, std::size_t max_ids
+  ) const {
+    std::vector<std::string> result;
+    std::size_t offset = 0;
+
+    for (std::size_t batch = 0;
+         batch < MAX_BATCHES_IN_SEARCH && result.size() < max_ids;
+         ++batch) {
+      const std::size_t page_size =
+          std::min(max_ids - result.size(), MAX_ITEMS_IN_BATCH);
+      std::optional<std::size_t> located_items;
+      auto got = locate_page(query, offset, page_size, &located_items);
+
+      offset += got.size();
+      std::move(got.begin(), got.end(), std::back_inserter(result));
+
+      if ((located_items.has_value() && offset >= *located_items) ||
+          got.size() < page_size) {
+        break;
+      }
+    }
+
+    return result;
+  }
+
   std::vector<std::string> KmipClient::op_locate_page_by_group(
       const std::string &group,
       object_type o_type,
       std::size_t offset,
       std::size_t page_size,
       std::optional<std::size_t> *located_items
+  ) const {
+    return locate_page(
+        LocateQuery(o_type).in_group(group),
+        offset,
+        page_size,
+        located_items
+    );
+  }
+
+  std::vector<std::string> KmipClient::locate_page(
+      const LocateQuery &query,
+      std::size_t offset,
+      std::size_t page_size,
+      std::optional<std::size_t> *located_items
   ) const {
     if (located_items != nullptr) {
       *located_items = std::nullopt;
@@ -650,19 +731,14 @@ namespace kmipclient {
     auto request = make_request_message();
     const auto batch_item_id = request.add_batch_item(
         kmipcore::LocateRequest(
-            !group.empty(),
-            group,
-            o_type,
+            query,
             page_size,
             offset,
             request.getHeader().getProtocolVersion()
         )
     );
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     auto response = rf.getResponseByBatchItemId<kmipcore::LocateResponseBatchItem>(
@@ -760,6 +836,63 @@ namespace kmipclient {
     );
   }
 
+  LocateCursor KmipClient::locate_cursor_by_group(
+      const std::string &group,
+      object_type o_type,
+      LocateCursor::Options options
+  ) const {
+    return LocateCursor(
+        [this, group, o_type](
+            std::size_t offset,
+            std::size_t page_size,
+            std::optional<std::size_t> *located_items
+        ) {
+          return locate_page(
+              LocateQuery(o_type).in_group(group),
+              offset,
+              page_size,
+              located_items
+          );
+        },
+        options
+    );
+  }
+
+  LocateCursor KmipClient::locate_cursor_by_name(
+      const std::string &name,
+      object_type o_type,
+      LocateCursor::Options options
+  ) const {
+    return LocateCursor(
+        [this, name, o_type](
+            std::size_t offset,
+            std::size_t page_size,
+            std::optional<std::size_t> *located_items
+        ) {
+          return locate_page(
+              LocateQuery(o_type).named(name),
+              offset,
+              page_size,
+              located_items
+          );
+        },
+        options
+    );
+  }
+
+  LocateCursor KmipClient::locate_cursor(
+      LocateQuery query, LocateCursor::Options options
+  ) const {
+    return LocateCursor(
+        [this, query = std::move(query)](
+            std::size_t offset,
+            std::size_t page_size,
+            std::optional<std::size_t> *located_items
+        ) { return locate_page(query, offset, page_size, located_items); },
+        options
+    );
+  }
+
   std::vector<kmipcore::ProtocolVersion>
       KmipClient::op_discover_versions() const {
     auto request = make_request_message();
@@ -773,10 +906,7 @@ namespace kmipclient {
     );
     const auto batch_item_id = request.add_batch_item(std::move(item));
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     auto response = rf.getResponseByBatchItemId<
@@ -787,6 +917,37 @@ namespace kmipclient {
     };
   }
 
+  kmipcore::ProtocolVersion KmipClient::negotiate_protocol_version() {
+    std::vector<kmipcore::ProtocolVersion> server_versions;
+    std::vector<kmipcore::operation> operations;
+    try {
+      server_versions = op_discover_versions();
+    } catch (const KmipIOException &) {
+      throw;
+    } catch (const kmipcore::KmipException &) {
+      // Discover Versions is optional before KMIP 1.1.
+    }
+    if (const auto chosen =
+            ServerProfile::choose_version(server_versions, version_)) {
+      version_ = *chosen;
+    }
+    try {
+      operations = op_query().supported_operations;
+    } catch (const KmipIOException &) {
+      throw;
+    } catch (const kmipcore::KmipException &) {
+      // Operations stay unknown.
+    }
+
+    if (!server_profile_) {
+      server_profile_ = std::make_shared<ServerProfile>();
+    }
+    server_profile_->set_discovery(
+        std::move(server_versions), version_, std::move(operations)
+    );
+    return version_;
+  }
+
   KmipClient::QueryServerInfo KmipClient::op_query() const {
     auto request = make_request_message();
 
@@ -821,10 +982,7 @@ namespace kmipclient {
     item.setRequestPayload(payload);
     const auto batch_item_id = request.add_batch_item(std::move(item));
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     const auto response =
@@ -868,10 +1026,7 @@ namespace kmipclient {
         kmipcore::RevokeRequest(id, reason, message, occurrence_time)
     );
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     return rf
@@ -886,10 +1041,7 @@ namespace kmipclient {
     const auto batch_item_id =
         request.add_batch_item(kmipcore::DestroyRequest(id));
 
-    std::vector<uint8_t> response_bytes;
-    io->do_exchange(
-        request.serialize(), response_bytes, request.getMaxResponseSize()
-    );
+    const auto response_bytes = exchange(request);
 
     kmipcore::ResponseParser rf(response_bytes, request);
     return rf
@@ -19,8 +19,12 @@
 
 #include "kmipcore/kmip_errors.hpp"
 
+#include <algorithm>
+#include <future>
+#include <iterator>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace kmipclient {
 
@@ -31,7 +35,9 @@ namespace kmipclient {
   KmipClientPool::BorrowedClient::BorrowedClient(
       KmipClientPool &pool, std::unique_ptr<Slot> slot
   ) noexcept
-    : pool_(&pool), slot_(std::move(slot)) {}
+    : pool_(&pool), slot_(std::move(slot)) {
+    slot_->borrowed_at = std::chrono::steady_clock::now();
+  }
 
   KmipClientPool::BorrowedClient::BorrowedClient(
       BorrowedClient &&other
@@ -76,13 +82,122 @@ namespace kmipclient {
   // KmipClientPool
   // ============================================================================
 
-  KmipClientPool::KmipClientPool(const Config &config) : config_(config) {
+  static size_t class_index(KmipClientPool::Priority priority) noexcept {
+    return priority == KmipClientPool::Priority::bulk ? 1 : 0;
+  }
+
+  static std::uint64_t next_pool_id() noexcept {
+    static std::atomic<std::uint64_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  KmipClientPool::KmipClientPool(const Config &config)
+    : config_(config), id_(next_pool_id()) {
     if (config_.max_connections == 0) {
       throw kmipcore::KmipException(
           -1, "KmipClientPool: max_connections must be greater than zero"
       );
     }
-    available_.reserve(config_.max_connections);
+    shard_count_ = config_.shards;
+    if (shard_count_ == 0) {
+      shard_count_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (config_.min_connections > config_.max_connections ||
+        config_.min_idle_connections > config_.max_connections) {
+      throw kmipcore::KmipException(
+          -1,
+          "KmipClientPool: min_connections and min_idle_connections must not "
+          "exceed max_connections"
+      );
+    }
+    if (config_.reserved_interactive + config_.reserved_bulk >
+        config_.max_connections) {
+      throw kmipcore::KmipException(
+          -1,
+          "KmipClientPool: reserved_interactive + reserved_bulk must not "
+          "exceed max_connections"
+      );
+    }
+    shard_count_ = std::min(shard_count_, config_.max_connections);
+    shards_ = std::make_unique<Shard[]>(shard_count_);
+    if (config_.adaptive_limit) {
+      auto limits = *config_.adaptive_limit;
+      limits.max_limit = std::min(limits.max_limit, config_.max_connections);
+      limits.min_limit = std::min(limits.min_limit, limits.max_limit);
+      limiter_ = std::make_unique<AdaptiveLimiter>(limits);
+    }
+    class_accounting_ = config_.reserved_interactive > 0 ||
+                        config_.reserved_bulk > 0 || limiter_;
+    if (config_.circuit_breaker) {
+      auto breaker = *config_.circuit_breaker;
+      breaker.listener = [this, listener = std::move(breaker.listener)](
+                             CircuitBreaker::State from,
+                             CircuitBreaker::State to
+                         ) {
+        if (to == CircuitBreaker::State::open) {
+          std::lock_guard<std::mutex> lk(mutex_);
+          breaker_opened_ = true;
+          maintenance_cv_.notify_one();
+        }
+        if (listener) {
+          listener(from, to);
+        }
+      };
+      breaker_ = std::make_unique<CircuitBreaker>(std::move(breaker));
+    }
+
+    const bool keeps_minimum =
+        config_.min_connections > 0 || config_.min_idle_connections > 0;
+    replenish_pending_ = keeps_minimum;  // warm up in the background
+    if (config_.health_check_interval.count() > 0 || keeps_minimum ||
+        breaker_) {
+      maintenance_thread_ = std::thread([this] { run_maintenance(); });
+    }
+  }
+
+  KmipClientPool::~KmipClientPool() {
+    {
+      // Exiting threads leave their cached connections to us from now on.
+      std::lock_guard<std::mutex> lk(affinity_registry_->mutex);
+      affinity_registry_->pool = nullptr;
+    }
+    // Requests that no connection can serve any more, e.g. bulk ones when
+    // every connection is reserved for interactive borrowers.
+    Waiter *abandoned = nullptr;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      stopping_ = true;
+      for (auto &queue : waiters_) {
+        while (Waiter *waiter = queue.front()) {
+          queue.erase(waiter);
+          waiting_[class_index(waiter->priority)].fetch_sub(1);
+          waiter->next = abandoned;
+          abandoned = waiter;
+        }
+      }
+    }
+    while (abandoned != nullptr) {
+      std::unique_ptr<Waiter> waiter(abandoned);
+      abandoned = waiter->next;
+      try {
+        waiter->callback(
+            std::nullopt,
+            std::make_exception_ptr(kmipcore::KmipException(
+                -1, "KmipClientPool: pool destroyed while borrowing"
+            ))
+        );
+      } catch (...) {
+        // Ignored, see borrow_async().
+      }
+    }
+    maintenance_cv_.notify_all();
+    if (maintenance_thread_.joinable()) {
+      maintenance_thread_.join();
+    }
+    // Connections still cached for a thread are owned by the pool.
+    for (const auto &cache : affinity_caches_) {
+      delete cache->slot.exchange(nullptr);
+    }
   }
 
   // ----------------------------------------------------------------------------
@@ -92,111 +207,1088 @@ namespace kmipclient {
   std::unique_ptr<KmipClientPool::Slot> KmipClientPool::create_slot() {
     auto slot = std::make_unique<Slot>();
 
-    slot->net_client = std::make_unique<NetClientOpenSSL>(
-        config_.host,
-        config_.port,
-        config_.client_cert,
-        config_.client_key,
-        config_.server_ca_cert,
-        config_.timeout_ms
-    );
+    if (config_.transport_factory) {
+      slot->net_client = config_.transport_factory(config_);
+      if (!slot->net_client) {
+        throw kmipcore::KmipException(
+            -1, "KmipClientPool: transport factory returned no transport"
+        );
+      }
+    } else {
+      slot->net_client = std::make_unique<NetClientOpenSSL>(
+          config_.host,
+          config_.port,
+          config_.client_cert,
+          config_.client_key,
+          config_.server_ca_cert,
+          config_.timeout_ms
+      );
+    }
     slot->net_client->set_tls_verification(config_.tls_verification);
-    slot->net_client->connect();  // throws KmipException on failure
+    slot->net_client->set_connect_options(config_.connect_options);
+
+    const auto started = std::chrono::steady_clock::now();
+    try {
+      slot->net_client->connect();  // throws KmipException on failure
+    } catch (...) {
+      telemetry_.connect_failures.fetch_add(1, std::memory_order_relaxed);
+      if (breaker_) {
+        breaker_->on_failure();
+      }
+      throw;
+    }
+    if (breaker_) {
+      breaker_->on_success();
+    }
+    telemetry_.connect.record(std::chrono::steady_clock::now() - started);
+    const auto handshake = slot->net_client->last_connect_timing().handshake;
+    if (handshake.count() > 0) {
+      telemetry_.handshake.record(handshake);
+    }
+    telemetry_.connects.fetch_add(1, std::memory_order_relaxed);
 
     slot->kmip_client = std::make_unique<KmipClient>(
         *slot->net_client, config_.logger, config_.version
     );
+    slot->kmip_client->set_retry_policy(config_.retry);
+    slot->kmip_client->set_server_profile(profile_);
+    // The pool outlives its connections.
+    slot->kmip_client->set_exchange_observer(
+        [this](std::chrono::steady_clock::duration elapsed, bool completed) {
+          observe_exchange(elapsed, completed);
+        }
+    );
+    if (config_.negotiate_version) {
+      // Concurrent first connections wait for the version; a failed attempt
+      // is repeated by the next connection.
+      std::call_once(negotiate_once_, [&] {
+        (void) slot->kmip_client->negotiate_protocol_version();
+      });
+      if (const auto version = profile_->protocol_version()) {
+        slot->kmip_client->set_protocol_version(*version);
+      }
+    }
+    slot->created_at = std::chrono::steady_clock::now();
+    slot->last_used = slot->created_at;
 
     return slot;
   }
 
-  void KmipClientPool::return_slot(
-      std::unique_ptr<Slot> slot, bool healthy
-  ) noexcept {
-    // Decide under the lock what to do with the slot.
-    bool discard = !healthy || !slot->net_client->is_connected();
+  size_t KmipClientPool::home_shard() const noexcept {
+    // Consecutive thread ids spread better than hashed std::thread::id.
+    static std::atomic<size_t> next_thread{0};
+    thread_local const size_t thread_index =
+        next_thread.fetch_add(1, std::memory_order_relaxed);
+    return thread_index % shard_count_;
+  }
 
+  std::unique_ptr<KmipClientPool::Slot> KmipClientPool::take_idle() {
+    const size_t home = home_shard();
+    std::unique_ptr<Slot> slot;
+    for (size_t i = 0; i < shard_count_ && !slot; ++i) {
+      Shard &shard = shards_[(home + i) % shard_count_];
+      if (shard.count.load() == 0) {
+        continue;
+      }
+      std::lock_guard<std::mutex> lk(shard.mutex);
+      if (!shard.idle.empty()) {
+        slot = std::move(shard.idle.back());
+        shard.idle.pop_back();
+        shard.count.store(shard.idle.size());
+      }
+    }
+    return slot;
+  }
+
+  void KmipClientPool::put_idle(
+      size_t shard_index, std::unique_ptr<Slot> slot, bool front
+  ) {
+    Shard &shard = shards_[shard_index];
     {
+      std::lock_guard<std::mutex> lk(shard.mutex);
+      if (front) {
+        shard.idle.insert(shard.idle.begin(), std::move(slot));
+      } else {
+        shard.idle.push_back(std::move(slot));
+      }
+      shard.count.store(shard.idle.size());
+    }
+    wake_waiter();
+  }
+
+  // ----------------------------------------------------------------------------
+  // Thread affinity
+  // ----------------------------------------------------------------------------
+
+  KmipClientPool::AffinityCache &KmipClientPool::affinity_cache() {
+    // Hands the cache back to a still alive pool when the thread exits.
+    class Entry {
+    public:
+      Entry(std::weak_ptr<AffinityRegistry> registry, AffinityCache *cache)
+        : registry_(std::move(registry)), cache_(cache) {}
+      Entry(const Entry &) = delete;
+      Entry &operator=(const Entry &) = delete;
+      ~Entry() {
+        if (const auto registry = registry_.lock()) {
+          std::lock_guard<std::mutex> lk(registry->mutex);
+          if (registry->pool != nullptr) {
+            registry->pool->release_affinity_cache(cache_);
+          }
+        }
+      }
+
+      [[nodiscard]] bool expired() const noexcept {
+        return registry_.expired();
+      }
+      [[nodiscard]] AffinityCache &cache() const noexcept { return *cache_; }
+
+    private:
+      std::weak_ptr<AffinityRegistry> registry_;  ///< expires with the pool
+      AffinityCache *cache_;
+    };
+    // Keyed by pool id rather than address, which a later pool may reuse.
+    thread_local std::unordered_map<std::uint64_t, Entry> caches;
+    if (const auto it = caches.find(id_); it != caches.end()) {
+      return it->second.cache();
+    }
+
+    std::erase_if(caches, [](const auto &entry) {
+      return entry.second.expired();
+    });
+    auto cache = std::make_shared<AffinityCache>();
+    {
+      std::lock_guard<std::mutex> lk(affinity_mutex_);
+      affinity_caches_.push_back(cache);
+    }
+    caches.try_emplace(id_, affinity_registry_, cache.get());
+    return *cache;
+  }
+
+  void KmipClientPool::release_affinity_cache(AffinityCache *cache) noexcept {
+    std::unique_ptr<Slot> slot;
+    {
+      // Holding mutex_ keeps borrowers from queueing between the cache and
+      // the idle shard, so nobody needs waking.
       std::lock_guard<std::mutex> lk(mutex_);
-      if (!discard) {
-        available_.push_back(std::move(slot));
+      {
+        std::lock_guard<std::mutex> affinity_lk(affinity_mutex_);
+        slot.reset(cache->slot.exchange(nullptr));
+        std::erase_if(affinity_caches_, [cache](const auto &registered) {
+          return registered.get() == cache;
+        });
+      }
+      if (!slot) {
+        return;
+      }
+      try {
+        Shard &shard = shards_[home_shard()];
+        std::lock_guard<std::mutex> shard_lk(shard.mutex);
+        shard.idle.push_back(std::move(slot));
+        shard.count.store(shard.idle.size());
+        return;
+      } catch (...) {
+        // Out of memory: drop the connection below, outside mutex_.
+      }
+    }
+    telemetry_.discards.fetch_add(1, std::memory_order_relaxed);
+    slot.reset();
+    release_connection();
+  }
+
+  std::unique_ptr<KmipClientPool::Slot> KmipClientPool::take_cached() {
+    AffinityCache &cache = affinity_cache();
+    if (cache.slot.load(std::memory_order_relaxed) == nullptr) {
+      return nullptr;
+    }
+    return std::unique_ptr<Slot>(cache.slot.exchange(nullptr));
+  }
+
+  bool KmipClientPool::put_cached(std::unique_ptr<Slot> &slot) {
+    AffinityCache &cache = affinity_cache();
+    Slot *empty = nullptr;
+    if (!cache.slot.compare_exchange_strong(empty, slot.get())) {
+      return false;  // the thread returns a second connection
+    }
+    slot.release();
+    // A borrower that queued meanwhile reclaims the cached connection.
+    wake_waiter();
+    return true;
+  }
+
+  std::unique_ptr<KmipClientPool::Slot> KmipClientPool::reclaim_cached() {
+    std::lock_guard<std::mutex> lk(affinity_mutex_);
+    for (const auto &cache : affinity_caches_) {
+      if (cache->slot.load(std::memory_order_relaxed) == nullptr) {
+        continue;
+      }
+      if (Slot *slot = cache->slot.exchange(nullptr)) {
+        return std::unique_ptr<Slot>(slot);
+      }
+    }
+    return nullptr;
+  }
+
+  // ----------------------------------------------------------------------------
+  // Capacity
+  // ----------------------------------------------------------------------------
+
+  bool KmipClientPool::reserve_connection() noexcept {
+    size_t current = total_count_.load();
+    while (current < config_.max_connections) {
+      if (total_count_.compare_exchange_weak(current, current + 1)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void KmipClientPool::release_connection() noexcept {
+    total_count_.fetch_sub(1);
+    wake_waiter();
+    if (config_.min_connections > 0 || config_.min_idle_connections > 0) {
+      request_replenish();
+    }
+  }
+
+  // ----------------------------------------------------------------------------
+  // Priority classes and the waiter queue
+  // ----------------------------------------------------------------------------
+
+  size_t KmipClientPool::class_limit(Priority priority) const noexcept {
+    return config_.max_connections - (priority == Priority::bulk
+                                          ? config_.reserved_interactive
+                                          : config_.reserved_bulk);
+  }
+
+  bool KmipClientPool::reserve_class(Priority priority) noexcept {
+    if (!class_accounting_) {
+      return true;  // total_count_ alone bounds the connections
+    }
+    auto &in_use = class_in_use_[class_index(priority)];
+    const size_t limit = class_limit(priority);
+    size_t current = in_use.load();
+    while (current < limit) {
+      if (in_use.compare_exchange_weak(current, current + 1)) {
+        break;
+      }
+    }
+    if (current >= limit) {
+      return false;
+    }
+    if (!limiter_) {
+      return true;
+    }
+
+    const size_t adaptive = limiter_->limit();
+    size_t total = in_use_.load();
+    while (total < adaptive) {
+      if (in_use_.compare_exchange_weak(total, total + 1)) {
+        return true;
+      }
+    }
+    in_use.fetch_sub(1);
+    return false;
+  }
+
+  void KmipClientPool::release_class(Priority priority) noexcept {
+    if (!class_accounting_) {
+      return;
+    }
+    class_in_use_[class_index(priority)].fetch_sub(1);
+    if (limiter_) {
+      in_use_.fetch_sub(1);
+    }
+  }
+
+  void KmipClientPool::observe_exchange(
+      std::chrono::steady_clock::duration elapsed, bool completed
+  ) noexcept {
+    if (config_.exchange_observer) {
+      try {
+        config_.exchange_observer(elapsed, completed);
+      } catch (...) {
+        // The observer must not fail the exchange.
+      }
+    }
+    telemetry_.exchange.record(elapsed);
+    if (!completed) {
+      telemetry_.exchange_errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (breaker_) {
+      completed ? breaker_->on_success() : breaker_->on_failure();
+    }
+    if (!limiter_) {
+      return;
+    }
+    const size_t before = limiter_->limit();
+    try {
+      if (completed) {
+        limiter_->on_success(elapsed, in_use_.load());
       } else {
-        --total_count_;  // one fewer live connection
+        limiter_->on_failure();
       }
-      cv_.notify_one();
+    } catch (...) {
+      return;  // std::mutex failure; keep the current limit
+    }
+    if (limiter_->limit() > before) {
+      wake_waiter();  // room for queued borrowers
     }
-    // If slot was not moved into available_, its destructor runs here –
-    // outside the lock – which calls KmipClient::~KmipClient() →
-    // net_client.close().
   }
 
-  KmipClientPool::BorrowedClient
-      KmipClientPool::acquire_locked(std::unique_lock<std::mutex> lk) {
-    if (!available_.empty()) {
-      // Re-use an idle connection.
-      auto slot = std::move(available_.back());
-      available_.pop_back();
-      lk.unlock();
-      return BorrowedClient(*this, std::move(slot));
+  void KmipClientPool::WaiterQueue::push_back(Waiter *waiter) noexcept {
+    waiter->prev = tail_;
+    waiter->next = nullptr;
+    (tail_ != nullptr ? tail_->next : head_) = waiter;
+    tail_ = waiter;
+  }
+
+  void KmipClientPool::WaiterQueue::erase(Waiter *waiter) noexcept {
+    (waiter->prev != nullptr ? waiter->prev->next : head_) = waiter->next;
+    (waiter->next != nullptr ? waiter->next->prev : tail_) = waiter->prev;
+    waiter->prev = waiter->next = nullptr;
+  }
+
+  KmipClientPool::Waiter *KmipClientPool::serve_waiters() noexcept {
+    Waiter *ready = nullptr;
+    Waiter *ready_tail = nullptr;
+    for (;;) {
+      // The first queue head that may take one more connection.
+      Waiter *waiter = nullptr;
+      for (auto &queue : waiters_) {
+        if (!queue.empty() && reserve_class(queue.front()->priority)) {
+          waiter = queue.front();
+          break;
+        }
+      }
+      if (waiter == nullptr) {
+        return ready;
+      }
+
+      auto slot = take_idle();
+      if (!slot && config_.thread_affinity) {
+        slot = reclaim_cached();
+      }
+      if (slot) {
+        waiter->slot = std::move(slot);
+      } else if (reserve_connection()) {
+        waiter->granted = true;
+      } else {
+        release_class(waiter->priority);
+        return ready;  // exhausted: wait for the next return
+      }
+      waiters_[class_index(waiter->priority)].erase(waiter);
+      waiting_[class_index(waiter->priority)].fetch_sub(1);
+      if (!waiter->callback) {
+        waiter->cv.notify_one();
+      } else {
+        // Connecting and the callback must not run under mutex_.
+        (ready_tail != nullptr ? ready_tail->next : ready) = waiter;
+        ready_tail = waiter;
+      }
     }
+  }
 
-    // total_count_ < max_connections is guaranteed by the caller.
-    // Reserve the slot under the lock, then release before the slow TLS
-    // connect.
-    ++total_count_;
-    lk.unlock();
+  void KmipClientPool::complete_async(Waiter *ready) noexcept {
+    while (ready != nullptr) {
+      std::unique_ptr<Waiter> waiter(ready);
+      ready = waiter->next;
+
+      std::optional<BorrowedClient> client;
+      std::exception_ptr error;
+      try {
+        client = finish_acquire(waiter->priority, std::move(waiter->slot));
+        record_borrow(waiter->started);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      try {
+        waiter->callback(std::move(client), error);
+      } catch (...) {
+        // Ignored, see borrow_async().
+      }
+    }
+  }
+
+  void KmipClientPool::wake_waiter() noexcept {
+    // Pairs with the increment of waiting_ in acquire(): either the queued
+    // borrower sees the released slot or capacity, or we see the borrower.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_[0].load() == 0 && waiting_[1].load() == 0) {
+      return;
+    }
+    Waiter *ready = nullptr;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      ready = serve_waiters();
+    }
+    complete_async(ready);
+  }
+
+  void KmipClientPool::check_queue_limit() {
+    const size_t queued = waiting_[0].load() + waiting_[1].load();
+    if (config_.max_waiting > 0 && queued >= config_.max_waiting) {
+      telemetry_.sheds.fetch_add(1, std::memory_order_relaxed);
+      throw KmipOverloadException(
+          "KmipClientPool: request shed, " + std::to_string(queued) +
+          " borrowers already waiting (concurrency limit " +
+          std::to_string(concurrency_limit()) + ")"
+      );
+    }
+  }
+
+  void KmipClientPool::return_slot(
+      std::unique_ptr<Slot> slot, bool healthy
+  ) noexcept {
+    const auto now = std::chrono::steady_clock::now();
+    telemetry_.hold.record(now - slot->borrowed_at);
+    slot->last_used = now;
+    release_class(slot->bulk ? Priority::bulk : Priority::interactive);
+    const bool discard =
+        !healthy || !slot->net_client->is_connected() || expired(*slot, now);
+
+    if (discard) {
+      telemetry_.discards.fetch_add(1, std::memory_order_relaxed);
+      // Destroying the slot disconnects it; only then is its capacity freed.
+      slot.reset();
+      release_connection();
+      return;
+    }
+    try {
+      if (config_.thread_affinity && put_cached(slot)) {
+        return;
+      }
+      put_idle(home_shard(), std::move(slot), false);
+    } catch (...) {
+      // Out of memory while growing the idle list: drop the connection.
+      telemetry_.discards.fetch_add(1, std::memory_order_relaxed);
+      slot.reset();
+      release_connection();
+    }
+  }
+
+  void KmipClientPool::check_circuit() {
+    if (breaker_ && !breaker_->allows()) {
+      telemetry_.circuit_rejections.fetch_add(1, std::memory_order_relaxed);
+      throw KmipCircuitOpenException(
+          "KmipClientPool: circuit breaker for " + config_.host + ":" +
+          config_.port + " is " + CircuitBreaker::to_string(circuit_state()) +
+          ", not connecting"
+      );
+    }
+  }
+
+  std::optional<KmipClientPool::BorrowedClient>
+      KmipClientPool::try_acquire(Priority priority) {
+    // Do not overtake queued borrowers of the same or a higher class.
+    if (waiting_[0].load() != 0 ||
+        (priority == Priority::bulk && waiting_[1].load() != 0)) {
+      return std::nullopt;
+    }
+    if (!reserve_class(priority)) {
+      return std::nullopt;
+    }
+    std::unique_ptr<Slot> slot;
+    if (config_.thread_affinity) {
+      slot = take_cached();
+    }
+    if (!slot) {
+      slot = take_idle();
+    }
+    if (!slot && config_.thread_affinity) {
+      slot = reclaim_cached();
+    }
+    if (!slot && !reserve_connection()) {
+      release_class(priority);
+      return std::nullopt;
+    }
+    return finish_acquire(priority, std::move(slot));
+  }
+
+  KmipClientPool::BorrowedClient KmipClientPool::finish_acquire(
+      Priority priority, std::unique_ptr<Slot> slot
+  ) {
+    if (config_.min_idle_connections > 0 &&
+        available_count() < config_.min_idle_connections) {
+      request_replenish();
+    }
+
+    if (slot) {
+      // Re-use an idle connection unless the server has closed it meanwhile;
+      // a stale one is replaced under its existing reservation.  With the
+      // background check running, one returned moments ago is not probed.
+      const auto now = std::chrono::steady_clock::now();
+      const bool probe = config_.health_check_interval.count() <= 0 ||
+                         now - slot->last_used >= config_.probe_idle_after;
+      if (!expired(*slot, now) &&
+          (!probe || slot->net_client->is_idle_usable())) {
+        slot->bulk = priority == Priority::bulk;
+        return BorrowedClient(*this, std::move(slot));
+      }
+      telemetry_.discards.fetch_add(1, std::memory_order_relaxed);
+      telemetry_.reconnects.fetch_add(1, std::memory_order_relaxed);
+      slot.reset();
+    }
 
     try {
-      return BorrowedClient(*this, create_slot());
+      // Queued borrowers may have been granted capacity before the breaker
+      // opened.
+      check_circuit();
+      slot = create_slot();
     } catch (...) {
-      // Connection failed: give the reserved slot back.
-      std::lock_guard<std::mutex> guard(mutex_);
-      --total_count_;
-      cv_.notify_one();
+      // Connection failed: give the reservations back.
+      release_class(priority);
+      release_connection();
       throw;
     }
+    slot->bulk = priority == Priority::bulk;
+    return BorrowedClient(*this, std::move(slot));
+  }
+
+  std::optional<KmipClientPool::BorrowedClient> KmipClientPool::acquire(
+      Priority priority,
+      std::optional<std::chrono::steady_clock::time_point> deadline
+  ) {
+    check_circuit();
+    if (auto client = try_acquire(priority)) {
+      return client;
+    }
+    telemetry_.exhaustions.fetch_add(1, std::memory_order_relaxed);
+
+    Waiter waiter{priority};
+    auto &queue = waiters_[class_index(priority)];
+    std::unique_lock<std::mutex> lk(mutex_);
+    check_queue_limit();
+    queue.push_back(&waiter);
+    waiting_[class_index(priority)].fetch_add(1);
+    // Serve whatever was released before we were visible in the queue.
+    if (Waiter *ready = serve_waiters()) {
+      lk.unlock();
+      complete_async(ready);
+      lk.lock();
+    }
+
+    const auto served = [&] { return waiter.served(); };
+    if (!deadline) {
+      waiter.cv.wait(lk, served);
+    } else if (!waiter.cv.wait_until(lk, *deadline, served)) {
+      queue.erase(&waiter);
+      waiting_[class_index(priority)].fetch_sub(1);
+      // Our leaving may unblock the next borrower in line.
+      Waiter *ready = serve_waiters();
+      lk.unlock();
+      complete_async(ready);
+      return std::nullopt;
+    }
+    lk.unlock();
+    return finish_acquire(priority, std::move(waiter.slot));
+  }
+
+  bool KmipClientPool::expired(
+      const Slot &slot, std::chrono::steady_clock::time_point now
+  ) const noexcept {
+    return config_.max_lifetime.count() > 0 &&
+           now - slot.created_at >= config_.max_lifetime;
   }
 
   // ----------------------------------------------------------------------------
-  // Public borrow methods
+  // Background maintenance
   // ----------------------------------------------------------------------------
 
-  KmipClientPool::BorrowedClient KmipClientPool::borrow() {
+  /// Pause before replenishing again after a connection attempt failed.
+  static constexpr std::chrono::seconds REPLENISH_RETRY_DELAY{1};
+
+  void KmipClientPool::run_maintenance() {
+    using clock = std::chrono::steady_clock;
+    const auto interval = config_.health_check_interval;
+    auto next_check = clock::now() + interval;
+    auto retry_at = clock::time_point::min();
+
+    // Replenishing is pointless while the breaker is open.
+    const auto reachable = [this] { return !breaker_ || breaker_->allows(); };
+
     std::unique_lock<std::mutex> lk(mutex_);
-    cv_.wait(lk, [this] {
-      return !available_.empty() || total_count_ < config_.max_connections;
-    });
-    return acquire_locked(std::move(lk));
+    for (;;) {
+      // Sleep until the next health check, a replenishment request (not
+      // before retry_at after a failure), a breaker probe or shutdown.
+      const bool retry_due = clock::now() >= retry_at;
+      const auto wake = [&] {
+        return stopping_ || breaker_opened_ ||
+               (retry_due && replenish_pending_.load() && reachable());
+      };
+      std::optional<clock::time_point> until;
+      if (interval.count() > 0) {
+        until = next_check;
+      }
+      if (!retry_due && (!until || retry_at < *until)) {
+        until = retry_at;
+      }
+      if (const auto probe = breaker_ ? breaker_->probe_due() : std::nullopt;
+          probe && (!until || *probe < *until)) {
+        until = probe;
+      }
+      if (until) {
+        maintenance_cv_.wait_until(lk, *until, wake);
+      } else {
+        maintenance_cv_.wait(lk, wake);
+      }
+      if (stopping_) {
+        return;
+      }
+      breaker_opened_ = false;
+      lk.unlock();
+
+      if (breaker_ && breaker_->begin_probe(clock::now())) {
+        probe_server();
+      }
+      if (interval.count() > 0 && clock::now() >= next_check) {
+        check_idle_slots();
+        next_check = clock::now() + interval;
+      }
+      if (clock::now() >= retry_at && reachable() &&
+          replenish_pending_.exchange(false) && !replenish()) {
+        replenish_pending_ = true;
+        retry_at = clock::now() + REPLENISH_RETRY_DELAY;
+      }
+      lk.lock();
+    }
   }
 
-  KmipClientPool::BorrowedClient
-      KmipClientPool::borrow(std::chrono::milliseconds timeout) {
-    std::unique_lock<std::mutex> lk(mutex_);
+  void KmipClientPool::probe_server() {
+    bool reachable = false;
+    try {
+      auto slot = create_slot();
+      reachable = true;
+      if (reserve_connection()) {
+        try {
+          put_idle(0, std::move(slot), false);
+        } catch (...) {
+          release_connection();
+        }
+      }
+    } catch (...) {
+      // Still unreachable; the breaker schedules the next probe.
+    }
+    breaker_->end_probe(reachable);
+  }
 
-    const bool slot_available = cv_.wait_for(lk, timeout, [this] {
-      return !available_.empty() || total_count_ < config_.max_connections;
-    });
+  void KmipClientPool::request_replenish() noexcept {
+    if (replenish_pending_.exchange(true)) {
+      return;  // already requested
+    }
+    // Notify under the lock so the request cannot slip in between the
+    // thread's check of the flag and its wait.
+    std::lock_guard<std::mutex> lk(mutex_);
+    maintenance_cv_.notify_one();
+  }
+
+  bool KmipClientPool::replenish() {
+    std::lock_guard<std::mutex> lk(replenish_mutex_);
+    const size_t total = total_count();
+    const size_t idle = available_count();
+    size_t missing = 0;
+    if (total < config_.min_connections) {
+      missing = config_.min_connections - total;
+    }
+    if (idle < config_.min_idle_connections) {
+      missing = std::max(missing, config_.min_idle_connections - idle);
+    }
+    if (missing == 0) {
+      return true;
+    }
+    std::exception_ptr error;
+    open_idle_connections(missing, error);
+    return !error;
+  }
+
+  size_t KmipClientPool::open_idle_connections(
+      size_t count, std::exception_ptr &error
+  ) {
+    std::atomic<size_t> opened{0};
+    std::mutex error_mutex;
+    const auto record_error = [&] {
+      std::lock_guard<std::mutex> lk(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    };
+
+    // Connect in parallel: each handshake mostly waits on the network.
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count && reserve_connection(); ++i) {
+      const auto open = [&, i] {
+        try {
+          put_idle(i % shard_count_, create_slot(), false);
+          opened.fetch_add(1);
+        } catch (...) {
+          release_connection();
+          record_error();
+        }
+      };
+      try {
+        threads.emplace_back(open);
+      } catch (...) {
+        release_connection();
+        record_error();
+        break;
+      }
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    return opened.load();
+  }
+
+  void KmipClientPool::check_idle_slots() {
+    const auto now = std::chrono::steady_clock::now();
+    size_t replace = 0;
+    // Idle-timeout evictions must not go below min_connections.
+    const size_t total = total_count();
+    size_t evictable =
+        total > config_.min_connections ? total - config_.min_connections : 0;
+
+    for (size_t i = 0; i < shard_count_; ++i) {
+      Shard &shard = shards_[i];
+
+      // Take the idle slots out so that nobody borrows one while it is
+      // probed.
+      std::vector<std::unique_ptr<Slot>> idle;
+      {
+        std::lock_guard<std::mutex> lk(shard.mutex);
+        idle.swap(shard.idle);
+        shard.count.store(0);
+      }
+
+      std::vector<std::unique_ptr<Slot>> keep;
+      size_t stale = 0;
+      for (auto &slot : idle) {
+        if (config_.idle_timeout.count() > 0 && evictable > 0 &&
+            now - slot->last_used >= config_.idle_timeout) {
+          slot.reset();
+          ++stale;
+          --evictable;
+        } else if (expired(*slot, now) ||
+                   !slot->net_client->is_idle_usable()) {
+          slot.reset();
+          ++stale;
+          ++replace;
+        } else {
+          keep.push_back(std::move(slot));
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lk(shard.mutex);
+        // Slots returned meanwhile were used more recently; keep them last.
+        shard.idle.insert(
+            shard.idle.begin(),
+            std::make_move_iterator(keep.begin()),
+            std::make_move_iterator(keep.end())
+        );
+        shard.count.store(shard.idle.size());
+      }
+      if (!keep.empty()) {
+        wake_waiter();
+      }
+      telemetry_.discards.fetch_add(stale, std::memory_order_relaxed);
+      for (size_t n = 0; n < stale; ++n) {
+        release_connection();
+      }
+    }
+
+    // Connections cached for a thread are checked like idle ones; those that
+    // pass go to the shared idle lists, as their thread has not been back
+    // within a whole health-check interval.
+    if (config_.thread_affinity) {
+      size_t n = 0;
+      while (auto slot = reclaim_cached()) {
+        if (config_.idle_timeout.count() > 0 && evictable > 0 &&
+            now - slot->last_used >= config_.idle_timeout) {
+          --evictable;
+        } else if (expired(*slot, now) ||
+                   !slot->net_client->is_idle_usable()) {
+          ++replace;
+        } else {
+          put_idle(n++ % shard_count_, std::move(slot), true);
+          continue;
+        }
+        slot.reset();
+        telemetry_.discards.fetch_add(1, std::memory_order_relaxed);
+        release_connection();
+      }
+    }
+
+    // Reconnect dead or expired slots, unless borrowers took the capacity
+    // or the server is known to be unreachable.
+    for (size_t i = 0; i < replace; ++i) {
+      {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (stopping_) {
+          return;
+        }
+      }
+      if (breaker_ && !breaker_->allows()) {
+        return;
+      }
+      if (!reserve_connection()) {
+        return;
+      }
+      try {
+        put_idle(i % shard_count_, create_slot(), true);
+        telemetry_.reconnects.fetch_add(1, std::memory_order_relaxed);
+      } catch (...) {
+        // The server is unreachable; borrowers will retry on demand.
+        release_connection();
+        return;
+      }
+    }
+  }
+
+  // ----------------------------------------------------------------------------
+  // Public borrow methods
+  // ----------------------------------------------------------------------------
+
+  void KmipClientPool::record_borrow(
+      std::chrono::steady_clock::time_point started
+  ) noexcept {
+    telemetry_.borrow_wait.record(std::chrono::steady_clock::now() - started);
+    telemetry_.borrows.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  KmipClientPool::BorrowedClient KmipClientPool::borrow(Priority priority) {
+    const auto started = std::chrono::steady_clock::now();
+    auto client = std::move(*acquire(priority, std::nullopt));
+    record_borrow(started);
+    return client;
+  }
 
-    if (!slot_available) {
+  KmipClientPool::BorrowedClient KmipClientPool::borrow(
+      std::chrono::milliseconds timeout, Priority priority
+  ) {
+    const auto started = std::chrono::steady_clock::now();
+    auto client = acquire(priority, started + timeout);
+    if (!client) {
+      telemetry_.borrow_timeouts.fetch_add(1, std::memory_order_relaxed);
       std::ostringstream oss;
       oss << "KmipClientPool: no connection available after " << timeout.count()
           << "ms (pool size: " << config_.max_connections
-          << ", all " << total_count_ << " connections in use)";
+          << ", concurrency limit: " << concurrency_limit()
+          << ", " << total_count() << " connections open)";
+      throw KmipOverloadException(oss.str());
+    }
+    record_borrow(started);
+    return std::move(*client);
+  }
+
+  std::optional<KmipClientPool::BorrowedClient>
+      KmipClientPool::try_borrow(Priority priority) {
+    const auto started = std::chrono::steady_clock::now();
+    check_circuit();
+    auto client = try_acquire(priority);
+    if (client) {
+      record_borrow(started);
+    } else {
+      telemetry_.exhaustions.fetch_add(1, std::memory_order_relaxed);
+    }
+    return client;
+  }
+
+  void KmipClientPool::borrow_async(
+      BorrowCallback callback, Priority priority
+  ) {
+    auto waiter = std::make_unique<Waiter>(priority);
+    waiter->callback = std::move(callback);
+    waiter->started = std::chrono::steady_clock::now();
+
+    std::optional<BorrowedClient> client;
+    std::exception_ptr error;
+    try {
+      check_circuit();
+      client = try_acquire(priority);
+      if (!client) {
+        telemetry_.exhaustions.fetch_add(1, std::memory_order_relaxed);
+        Waiter *ready = nullptr;
+        {
+          std::lock_guard<std::mutex> lk(mutex_);
+          check_queue_limit();
+          waiters_[class_index(priority)].push_back(waiter.release());
+          waiting_[class_index(priority)].fetch_add(1);
+          ready = serve_waiters();
+        }
+        complete_async(ready);
+        return;
+      }
+      record_borrow(waiter->started);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    try {
+      waiter->callback(std::move(client), error);
+    } catch (...) {
+      // Ignored, as for callbacks run by other threads.
+    }
+  }
+
+  std::future<KmipClientPool::BorrowedClient>
+      KmipClientPool::borrow_async(Priority priority) {
+    auto promise = std::make_shared<std::promise<BorrowedClient>>();
+    auto future = promise->get_future();
+    borrow_async(
+        [promise](
+            std::optional<BorrowedClient> client, std::exception_ptr error
+        ) {
+          if (error) {
+            promise->set_exception(error);
+          } else {
+            promise->set_value(std::move(*client));
+          }
+        },
+        priority
+    );
+    return future;
+  }
+
+  size_t KmipClientPool::warm_up() {
+    std::lock_guard<std::mutex> lk(replenish_mutex_);
+    const size_t total = total_count();
+    if (total >= config_.min_connections) {
+      return 0;
+    }
+    std::exception_ptr error;
+    const size_t opened =
+        open_idle_connections(config_.min_connections - total, error);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return opened;
+  }
+
+  // ----------------------------------------------------------------------------
+  // Bulk operations
+  // ----------------------------------------------------------------------------
+
+  std::vector<std::string> KmipClientPool::parallel_locate(
+      const std::string &group,
+      object_type o_type,
+      size_t parallelism,
+      size_t page_size,
+      size_t max_ids
+  ) {
+    if (parallelism == 0 || page_size == 0 || max_ids == 0) {
       throw kmipcore::KmipException(
           -1,
-          oss.str()
+          "KmipClientPool: parallel_locate parallelism, page_size and "
+          "max_ids must be greater than zero"
       );
     }
-    return acquire_locked(std::move(lk));
-  }
 
-  std::optional<KmipClientPool::BorrowedClient> KmipClientPool::try_borrow() {
-    std::unique_lock<std::mutex> lk(mutex_);
+    std::vector<std::vector<std::string>> pages(1);
+    std::optional<size_t> located_items;
+    {
+      auto conn = borrow(Priority::bulk);
+      const size_t wanted = std::min(page_size, max_ids);
+      pages[0] = conn->op_locate_page_by_group(
+          group, o_type, 0, wanted, &located_items
+      );
+      if (pages[0].size() > wanted) {
+        pages[0].resize(wanted);
+      }
+    }
+    // The reported count is trusted only up to max_ids.
+    const size_t limit =
+        located_items ? std::min(*located_items, max_ids) : max_ids;
 
-    if (available_.empty() && total_count_ >= config_.max_connections) {
-      return std::nullopt;
+    // Servers may cap Maximum Items below page_size: the first page's size
+    // is the stride the server actually serves.
+    const size_t stride = pages[0].size();
+    size_t offset = stride;  // end of the contiguous prefix fetched
+    if (located_items && stride > 0 && limit > stride) {
+      const size_t count = (limit - 1) / stride;
+      pages.resize(1 + count);
+      std::atomic<size_t> next{0};
+      std::atomic<bool> failed{false};
+      // Each fetcher holds one connection and takes pages in turn, so the
+      // pool's limits apply and a slow page does not stall the others.
+      const auto fetch = [&] {
+        try {
+          auto conn = borrow(Priority::bulk);
+          for (size_t i = next++; i < count && !failed; i = next++) {
+            const size_t wanted = std::min(stride, limit - (1 + i) * stride);
+            auto page = conn->op_locate_page_by_group(
+                group, o_type, (1 + i) * stride, wanted
+            );
+            if (page.size() > wanted) {
+              page.resize(wanted);
+            }
+            pages[1 + i] = std::move(page);
+          }
+        } catch (...) {
+          failed = true;
+          throw;
+        }
+      };
+
+      std::vector<std::future<void>> fetchers;
+      for (size_t i = 1; i < std::min(parallelism, count); ++i) {
+        fetchers.push_back(std::async(std::launch::async, fetch));
+      }
+      std::exception_ptr error;
+      try {
+        fetch();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      for (auto &fetcher : fetchers) {
+        try {
+          fetcher.get();
+        } catch (...) {
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
+
+      // Keep the pages up to the first one shorter than expected; the
+      // rest of the range is paged sequentially below.
+      for (size_t i = 1; i < pages.size(); ++i) {
+        offset += pages[i].size();
+        if (pages[i].size() < std::min(stride, limit - i * stride)) {
+          pages.resize(i + 1);
+          break;
+        }
+      }
+    }
+
+    // Sequential paging: without a count, or after a short page.
+    if (stride > 0 && offset < limit) {
+      auto conn = borrow(Priority::bulk);
+      while (offset < limit) {
+        const size_t wanted = std::min(page_size, limit - offset);
+        auto page =
+            conn->op_locate_page_by_group(group, o_type, offset, wanted);
+        if (page.empty()) {
+          break;
+        }
+        if (page.size() > wanted) {
+          page.resize(wanted);
+        }
+        offset += page.size();
+        pages.push_back(std::move(page));
+      }
     }
-    return acquire_locked(std::move(lk));
+
+    size_t total = 0;
+    for (const auto &page : pages) {
+      total += page.size();
+    }
+    std::vector<std::string> ids;
+    ids.reserve(total);
+    for (auto &page : pages) {
+      std::move(page.begin(), page.end(), std::back_inserter(ids));
+    }
+    return ids;
   }
 
   // ----------------------------------------------------------------------------
@@ -204,13 +1296,60 @@ namespace kmipclient {
   // ----------------------------------------------------------------------------
 
   size_t KmipClientPool::available_count() const {
-    std::lock_guard<std::mutex> lk(mutex_);
-    return available_.size();
+    size_t count = 0;
+    for (size_t i = 0; i < shard_count_; ++i) {
+      count += shards_[i].count.load();
+    }
+    if (config_.thread_affinity) {
+      std::lock_guard<std::mutex> lk(affinity_mutex_);
+      for (const auto &cache : affinity_caches_) {
+        count += cache->slot.load() != nullptr ? 1 : 0;
+      }
+    }
+    return count;
   }
 
   size_t KmipClientPool::total_count() const {
-    std::lock_guard<std::mutex> lk(mutex_);
-    return total_count_;
+    return total_count_.load();
+  }
+
+  size_t KmipClientPool::concurrency_limit() const noexcept {
+    return limiter_ ? limiter_->limit() : config_.max_connections;
+  }
+
+  PoolMetrics KmipClientPool::metrics() const {
+    const auto load = [](const std::atomic<std::uint64_t> &counter) {
+      return counter.load(std::memory_order_relaxed);
+    };
+
+    PoolMetrics m;
+    m.borrow_wait = telemetry_.borrow_wait.snapshot();
+    m.connect = telemetry_.connect.snapshot();
+    m.handshake = telemetry_.handshake.snapshot();
+    m.hold = telemetry_.hold.snapshot();
+    m.exchange = telemetry_.exchange.snapshot();
+
+    m.borrows = load(telemetry_.borrows);
+    m.borrow_timeouts = load(telemetry_.borrow_timeouts);
+    m.exhaustions = load(telemetry_.exhaustions);
+    m.discards = load(telemetry_.discards);
+    m.connects = load(telemetry_.connects);
+    m.connect_failures = load(telemetry_.connect_failures);
+    m.reconnects = load(telemetry_.reconnects);
+    m.exchange_errors = load(telemetry_.exchange_errors);
+    m.sheds = load(telemetry_.sheds);
+    m.circuit_opens = breaker_ ? breaker_->opens() : 0;
+    m.circuit_rejections = load(telemetry_.circuit_rejections);
+
+    const size_t total = total_count();
+    const size_t idle = available_count();
+    m.idle = idle;
+    m.in_use = total > idle ? total - idle : 0;
+    m.waiting = waiting_[0].load() + waiting_[1].load();
+    m.max = config_.max_connections;
+    m.limit = concurrency_limit();
+    m.circuit_open = circuit_state() != CircuitBreaker::State::closed;
+    return m;
   }
 
 }  // namespace kmipclient
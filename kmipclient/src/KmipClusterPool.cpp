@@ -0,0 +1,316 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/KmipClusterPool.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+namespace kmipclient {
+
+  // ============================================================================
+  // BorrowedClient
+  // ============================================================================
+
+  KmipClusterPool::BorrowedClient::BorrowedClient(
+      KmipClusterPool &cluster,
+      size_t node,
+      KmipClientPool::BorrowedClient inner
+  ) noexcept
+    : cluster_(&cluster),
+      node_(node),
+      inner_(std::move(inner)) {}
+
+  KmipClusterPool::BorrowedClient::BorrowedClient(
+      BorrowedClient &&other
+  ) noexcept
+    : cluster_(other.cluster_),
+      node_(other.node_),
+      inner_(std::move(other.inner_)) {
+    other.cluster_ = nullptr;  // disown so other's dtor is a no-op
+  }
+
+  KmipClusterPool::BorrowedClient &KmipClusterPool::BorrowedClient::operator=(
+      BorrowedClient &&other
+  ) noexcept {
+    if (this != &other) {
+      release();
+      cluster_ = other.cluster_;
+      node_ = other.node_;
+      inner_ = std::move(other.inner_);
+      other.cluster_ = nullptr;
+    }
+    return *this;
+  }
+
+  KmipClusterPool::BorrowedClient::~BorrowedClient() {
+    release();
+  }
+
+  const KmipClusterPool::Endpoint &
+      KmipClusterPool::BorrowedClient::endpoint() const noexcept {
+    return cluster_->nodes_[node_].endpoint;
+  }
+
+  void KmipClusterPool::BorrowedClient::release() noexcept {
+    if (cluster_ == nullptr) {
+      return;
+    }
+    const bool healthy = inner_.isHealthy();
+    {
+      // Hand the connection back to the node pool first.
+      auto returned = std::move(inner_);
+    }
+    cluster_->record(node_, healthy);
+    cluster_ = nullptr;
+  }
+
+  // ============================================================================
+  // KmipClusterPool
+  // ============================================================================
+
+  KmipClusterPool::KmipClusterPool(const Config &config) : config_(config) {
+    if (config_.endpoints.empty()) {
+      throw kmipcore::KmipException(
+          -1, "KmipClusterPool: at least one endpoint is required"
+      );
+    }
+    const double alpha = config_.latency_smoothing;
+    if (!(alpha > 0.0 && alpha <= 1.0)) {
+      throw kmipcore::KmipException(
+          -1, "KmipClusterPool: latency_smoothing must be in (0, 1]"
+      );
+    }
+    if (config_.failure_threshold == 0) {
+      throw kmipcore::KmipException(
+          -1, "KmipClusterPool: failure_threshold must be greater than zero"
+      );
+    }
+
+    nodes_.reserve(config_.endpoints.size());
+    try {
+      for (const auto &endpoint : config_.endpoints) {
+        add_node(endpoint);
+      }
+    } catch (...) {
+      close_nodes();
+      throw;
+    }
+  }
+
+  KmipClusterPool::~KmipClusterPool() {
+    close_nodes();
+  }
+
+  // ----------------------------------------------------------------------------
+  // Private helpers
+  // ----------------------------------------------------------------------------
+
+  void KmipClusterPool::add_node(const Endpoint &endpoint) {
+    auto node_config = config_.node;
+    node_config.host = endpoint.host;
+    node_config.port = endpoint.port;
+    // Nodes are routed by round-trip time; the pools are closed before the
+    // cluster goes away.
+    node_config.exchange_observer =
+        [this,
+         index = nodes_.size(),
+         observer = config_.node.exchange_observer](
+            std::chrono::steady_clock::duration elapsed, bool completed
+        ) {
+          if (completed) {
+            observe_exchange(index, elapsed);
+          }
+          if (observer) {
+            observer(elapsed, completed);
+          }
+        };
+
+    Node node;
+    node.endpoint = endpoint;
+    node.pool = std::make_unique<KmipClientPool>(node_config);
+    // Warm-up connections of the new pool may already report exchanges.
+    std::lock_guard<std::mutex> lk(mutex_);
+    nodes_.push_back(std::move(node));
+  }
+
+  void KmipClusterPool::close_nodes() noexcept {
+    for (auto &node : nodes_) {
+      node.pool.reset();
+    }
+  }
+
+  std::optional<size_t>
+      KmipClusterPool::select_node(const std::vector<bool> &excluded) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lk(mutex_);
+
+    std::optional<size_t> best;
+    double best_score = std::numeric_limits<double>::infinity();
+    size_t best_outstanding = std::numeric_limits<size_t>::max();
+    // Used only when every candidate is ejected.
+    std::optional<size_t> least_ejected;
+
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+      if (excluded[i]) {
+        continue;
+      }
+      const Node &node = nodes_[i];
+      if (node.ejected_until > now) {
+        if (!least_ejected ||
+            node.ejected_until < nodes_[*least_ejected].ejected_until) {
+          least_ejected = i;
+        }
+        continue;
+      }
+      // Expected wait; unmeasured nodes score zero so they get sampled.
+      const double score =
+          node.measured
+              ? node.latency_us * static_cast<double>(node.outstanding + 1)
+              : 0.0;
+      if (score < best_score ||
+          (score == best_score && node.outstanding < best_outstanding)) {
+        best = i;
+        best_score = score;
+        best_outstanding = node.outstanding;
+      }
+    }
+
+    if (!best) {
+      best = least_ejected;
+    }
+    if (best) {
+      ++nodes_[*best].outstanding;
+    }
+    return best;
+  }
+
+  void KmipClusterPool::record(size_t node, bool healthy) noexcept {
+    std::lock_guard<std::mutex> lk(mutex_);
+    Node &n = nodes_[node];
+    --n.outstanding;
+
+    if (!healthy) {
+      if (++n.consecutive_failures >= config_.failure_threshold) {
+        n.ejected_until =
+            std::chrono::steady_clock::now() + config_.ejection_duration;
+      }
+      return;
+    }
+
+    n.consecutive_failures = 0;
+    n.ejected_until = {};
+  }
+
+  void KmipClusterPool::observe_exchange(
+      size_t node, std::chrono::steady_clock::duration elapsed
+  ) noexcept {
+    const double sample =
+        std::chrono::duration<double, std::micro>(elapsed).count();
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (node >= nodes_.size()) {
+      return;  // still constructing the cluster
+    }
+    Node &n = nodes_[node];
+    if (n.measured) {
+      n.latency_us += config_.latency_smoothing * (sample - n.latency_us);
+    } else {
+      n.latency_us = sample;
+      n.measured = true;
+    }
+  }
+
+  KmipClusterPool::BorrowedClient
+      KmipClusterPool::borrow_excluding(std::vector<bool> &excluded) {
+    std::exception_ptr last_error;
+    while (auto node = select_node(excluded)) {
+      try {
+        return BorrowedClient(*this, *node, nodes_[*node].pool->borrow());
+      } catch (...) {
+        // Connecting to the node failed; nothing was sent, so moving on to
+        // another node is always safe.
+        last_error = std::current_exception();
+        record(*node, false);
+        excluded[*node] = true;
+      }
+    }
+    if (last_error) {
+      std::rethrow_exception(last_error);
+    }
+    throw kmipcore::KmipException(
+        -1, "KmipClusterPool: no cluster node left to try"
+    );
+  }
+
+  // ----------------------------------------------------------------------------
+  // Public methods
+  // ----------------------------------------------------------------------------
+
+  KmipClusterPool::BorrowedClient KmipClusterPool::borrow() {
+    std::vector<bool> excluded(nodes_.size(), false);
+    return borrow_excluding(excluded);
+  }
+
+  size_t KmipClusterPool::select(std::optional<size_t> avoid) {
+    std::vector<bool> excluded(nodes_.size(), false);
+    if (avoid && *avoid < nodes_.size() && nodes_.size() > 1) {
+      excluded[*avoid] = true;
+    }
+    // Never empty: at most one of several nodes is excluded.
+    return *select_node(excluded);
+  }
+
+  KmipClusterPool::BorrowedClient
+      KmipClusterPool::borrow_selected(size_t node) {
+    try {
+      return BorrowedClient(*this, node, nodes_[node].pool->borrow());
+    } catch (...) {
+      record(node, false);
+      if (nodes_.size() == 1) {
+        throw;
+      }
+    }
+    std::vector<bool> excluded(nodes_.size(), false);
+    excluded[node] = true;
+    return borrow_excluding(excluded);
+  }
+
+  std::vector<KmipClusterPool::NodeStats> KmipClusterPool::node_stats() const {
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<NodeStats> stats;
+    stats.reserve(nodes_.size());
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    for (const auto &node : nodes_) {
+      NodeStats s;
+      s.endpoint = node.endpoint;
+      s.latency = std::chrono::microseconds(
+          static_cast<std::chrono::microseconds::rep>(node.latency_us)
+      );
+      s.outstanding = node.outstanding;
+      s.consecutive_failures = node.consecutive_failures;
+      s.ejected = node.ejected_until > now;
+      s.total_connections = node.pool->total_count();
+      stats.push_back(std::move(s));
+    }
+    return stats;
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,71 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/LatencyTracker.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <algorithm>
+
+namespace kmipclient {
+
+  LatencyTracker::LatencyTracker(size_t capacity) : capacity_(capacity) {
+    if (capacity_ == 0) {
+      throw kmipcore::KmipException(
+          -1, "LatencyTracker: capacity must be greater than zero"
+      );
+    }
+    samples_.reserve(capacity_);
+  }
+
+  void LatencyTracker::record(std::chrono::steady_clock::duration latency) {
+    const auto us =
+        std::chrono::duration_cast<std::chrono::microseconds>(latency);
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (samples_.size() < capacity_) {
+      samples_.push_back(us);
+      return;
+    }
+    samples_[next_] = us;
+    next_ = (next_ + 1) % capacity_;
+  }
+
+  std::optional<std::chrono::microseconds>
+      LatencyTracker::percentile(double q, size_t min_samples) const {
+    std::vector<std::chrono::microseconds> sorted;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      if (samples_.empty() || samples_.size() < min_samples) {
+        return std::nullopt;
+      }
+      sorted = samples_;
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    // Index of the q-quantile, rounded to the nearest sample.
+    const auto rank = static_cast<size_t>(
+        q * static_cast<double>(sorted.size() - 1) + 0.5
+    );
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+    return sorted[rank];
+  }
+
+  size_t LatencyTracker::size() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return samples_.size();
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,130 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/LocateCursor.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <algorithm>
+
+namespace kmipclient {
+
+  LocateCursor::LocateCursor(FetchPage fetch, Options options)
+    : fetch_(std::make_shared<const FetchPage>(std::move(fetch))),
+      options_(options) {
+    if (options_.page_size == 0) {
+      throw kmipcore::KmipException(
+          -1, "LocateCursor: page_size must be greater than zero"
+      );
+    }
+  }
+
+  // A prefetch in flight is awaited by the destructor of its future.
+  LocateCursor::~LocateCursor() = default;
+  LocateCursor::LocateCursor(LocateCursor &&) noexcept = default;
+  LocateCursor &LocateCursor::operator=(LocateCursor &&) noexcept = default;
+
+  LocateCursor::Page LocateCursor::fetch_page(
+      const FetchPage &fetch, std::size_t offset, std::size_t requested
+  ) {
+    Page page;
+    page.ids = fetch(offset, requested, &page.located_items);
+    return page;
+  }
+
+  std::size_t LocateCursor::next_request_size() const noexcept {
+    if (options_.max_ids == 0) {
+      return options_.page_size;
+    }
+    return std::min(options_.page_size, options_.max_ids - returned_);
+  }
+
+  void LocateCursor::start_prefetch() {
+    prefetched_ = std::async(
+        std::launch::async,
+        [fetch = fetch_, offset = offset_, requested = next_request_size()] {
+          return fetch_page(*fetch, offset, requested);
+        }
+    );
+  }
+
+  void LocateCursor::deduplicate(std::vector<std::string> &ids) {
+    if (options_.dedup_window == 0) {
+      return;
+    }
+    std::erase_if(ids, [this](const std::string &id) {
+      if (!seen_.insert(id).second) {
+        return true;
+      }
+      seen_order_.push_back(id);
+      if (seen_order_.size() > options_.dedup_window) {
+        seen_.erase(seen_order_.front());
+        seen_order_.pop_front();
+      }
+      return false;
+    });
+  }
+
+  std::optional<std::vector<std::string>> LocateCursor::next_page() {
+    while (!exhausted_) {
+      // On failure offset_ is unchanged, so the next call retries the page.
+      Page page = prefetched_.valid()
+                      ? prefetched_.get()
+                      : fetch_page(*fetch_, offset_, next_request_size());
+
+      if (page.located_items) {
+        located_items_ = page.located_items;
+      }
+      offset_ += page.ids.size();
+      // Short pages do not end the result set: servers may cap Maximum
+      // Items below the page size.
+      exhausted_ = page.ids.empty() ||
+                   (located_items_ && offset_ >= *located_items_);
+
+      deduplicate(page.ids);
+      if (options_.max_ids > 0) {
+        const std::size_t room = options_.max_ids - returned_;
+        if (page.ids.size() >= room) {
+          page.ids.resize(room);
+          exhausted_ = true;
+        }
+      }
+      returned_ += page.ids.size();
+
+      if (!exhausted_ && options_.prefetch) {
+        start_prefetch();
+      }
+      if (!page.ids.empty()) {
+        return std::move(page.ids);
+      }
+    }
+    return std::nullopt;
+  }
+
+  std::optional<std::string> LocateCursor::next() {
+    while (position_ == page_.size()) {
+      auto page = next_page();
+      if (!page) {
+        return std::nullopt;
+      }
+      page_ = std::move(*page);
+      position_ = 0;
+    }
+    return std::move(page_[position_++]);
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,107 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "MessageFramer.hpp"
+
+#include "kmipclient/KmipIOException.hpp"
+#include "kmipcore/kmip_enums.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+namespace kmipclient {
+
+  namespace {
+
+    [[nodiscard]] int32_t read_int32_be(const uint8_t *bytes) {
+      return (static_cast<int32_t>(bytes[0]) << 24) |
+             (static_cast<int32_t>(bytes[1]) << 16) |
+             (static_cast<int32_t>(bytes[2]) << 8) |
+             static_cast<int32_t>(bytes[3]);
+    }
+
+  }  // namespace
+
+  MessageFramer::MessageFramer(size_t read_ahead)
+    : buffer_(std::max(read_ahead, HEADER_SIZE)),
+      read_ahead_(std::max(read_ahead, HEADER_SIZE)) {}
+
+  std::optional<std::vector<uint8_t>>
+      MessageFramer::next_message(size_t max_message_size) {
+    if (!pending_size_.has_value()) {
+      if (buffered() < HEADER_SIZE) {
+        return std::nullopt;
+      }
+
+      const int32_t length = read_int32_be(buffer_.data() + head_ + 4);
+      const std::size_t effective_limit =
+          std::min(max_message_size, kmipcore::KMIP_MAX_MESSAGE_HARD_LIMIT);
+      if (length < 0 || static_cast<size_t>(length) > effective_limit) {
+        std::ostringstream oss;
+        oss << "Message too long. Length: " << length
+            << ", allowed: " << effective_limit;
+        throw KmipIOException(kmipcore::KMIP_EXCEED_MAX_MESSAGE_SIZE, oss.str());
+      }
+      pending_size_ = HEADER_SIZE + static_cast<size_t>(length);
+    }
+
+    const size_t message_size = *pending_size_;
+    if (buffered() < message_size) {
+      return std::nullopt;
+    }
+
+    std::vector<uint8_t> message(
+        buffer_.begin() + static_cast<std::ptrdiff_t>(head_),
+        buffer_.begin() + static_cast<std::ptrdiff_t>(head_ + message_size)
+    );
+    head_ += message_size;
+    pending_size_.reset();
+    if (head_ == tail_) {
+      head_ = 0;
+      tail_ = 0;
+      // Do not keep the memory of an occasional large message per
+      // connection.
+      if (buffer_.size() > read_ahead_) {
+        buffer_.resize(read_ahead_);
+        buffer_.shrink_to_fit();
+      }
+    }
+    return message;
+  }
+
+  std::span<uint8_t> MessageFramer::write_window() {
+    // Room needed: the rest of the message being assembled, or at least one
+    // read-ahead chunk when its length is not known yet.
+    const size_t wanted = std::max(pending_size_.value_or(0), read_ahead_);
+
+    if (buffer_.size() - head_ < wanted) {
+      // Compact unread bytes to the front before growing.
+      if (head_ > 0) {
+        std::memmove(buffer_.data(), buffer_.data() + head_, buffered());
+        tail_ -= head_;
+        head_ = 0;
+      }
+      if (buffer_.size() < wanted) {
+        buffer_.resize(wanted);
+      }
+    }
+
+    return std::span<uint8_t>(buffer_).subspan(tail_);
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,97 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef KMIPCLIENT_MESSAGE_FRAMER_HPP
+#define KMIPCLIENT_MESSAGE_FRAMER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace kmipclient {
+
+  /**
+   * Per-connection read-ahead buffer that slices complete TTLV messages out
+   * of the received byte stream.
+   *
+   * The transport is asked for as many bytes as fit into the free tail of the
+   * buffer, so one recv() call usually delivers a whole response (or several
+   * pipelined responses from one TLS record).  Consumed bytes are reclaimed by
+   * compacting the unread remainder to the front of the buffer; messages are
+   * therefore always contiguous, which the TTLV decoder requires.
+   */
+  class MessageFramer {
+  public:
+    /** Length of the TTLV tag/type/length prefix of every KMIP message. */
+    static constexpr size_t HEADER_SIZE = 8;
+    /** Initial buffer capacity; one typical TLS record plus headroom. */
+    static constexpr size_t DEFAULT_READ_AHEAD = 16 * 1024;
+
+    explicit MessageFramer(size_t read_ahead = DEFAULT_READ_AHEAD);
+
+    /**
+     * Extracts the next complete message if it is fully buffered.
+     *
+     * @param max_message_size Caller limit for the message body length; the
+     *        library hard limit is always enforced as well.
+     * @return The full message (header included) or std::nullopt when more
+     *         bytes are required.
+     * @throws KmipIOException when the announced length exceeds the limit.
+     */
+    std::optional<std::vector<uint8_t>> next_message(size_t max_message_size);
+
+    /**
+     * Returns a writable window at the tail of the buffer for the next
+     * recv() call.  The window is large enough to hold the rest of the
+     * message currently being assembled when its length is already known.
+     */
+    std::span<uint8_t> write_window();
+
+    /** Marks @p n bytes of the last write window as received. */
+    void commit(size_t n) noexcept { tail_ += n; }
+
+    /** Number of received bytes not yet handed out as messages. */
+    [[nodiscard]] size_t buffered() const noexcept { return tail_ - head_; }
+
+    /**
+     * Current buffer size.  It grows to hold a message larger than the
+     * read-ahead and returns to the read-ahead once that message has been
+     * handed out with nothing else buffered.
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return buffer_.size(); }
+
+    /** Drops all buffered bytes (e.g. after the connection was closed). */
+    void reset() noexcept {
+      head_ = 0;
+      tail_ = 0;
+      pending_size_.reset();
+    }
+
+  private:
+    std::vector<uint8_t> buffer_;
+    size_t head_ = 0;
+    size_t tail_ = 0;
+    size_t read_ahead_;
+    /** Validated total size of the message at head_, once its header is in. */
+    std::optional<size_t> pending_size_;
+  };
+
+}  // namespace kmipclient
+
+#endif  // KMIPCLIENT_MESSAGE_FRAMER_HPP
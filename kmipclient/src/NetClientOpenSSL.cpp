@@ -18,6 +18,7 @@
 
 #include "kmipclient/NetClientOpenSSL.hpp"
 
+#include "SocketConnector.hpp"
 #include "kmipclient/KmipIOException.hpp"
 
 #include <arpa/inet.h>
@@ -33,6 +34,7 @@
 #include <sstream>
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <unistd.h>
 
 namespace kmipclient {
 
@@ -247,7 +249,7 @@ namespace kmipclient {
     }
   }
 
-  static void restore_socket_blocking(BIO *bio) {
+  static void set_socket_nonblocking(BIO *bio, bool nonblocking) {
     int fd = -1;
     if (BIO_get_fd(bio, &fd) < 0 || fd < 0) {
       throw KmipIOException(
@@ -264,7 +266,8 @@ namespace kmipclient {
       );
     }
 
-    const int desired_flags = flags & ~O_NONBLOCK;
+    const int desired_flags =
+        nonblocking ? flags | O_NONBLOCK : flags & ~O_NONBLOCK;
     if (fcntl(fd, F_SETFL, desired_flags) != 0) {
       throw KmipIOException(
           kmipcore::KMIP_IO_FAILURE,
@@ -408,11 +411,11 @@ namespace kmipclient {
       );
     }
 
-    std::unique_ptr<BIO, BioDeleter> new_bio(BIO_new_ssl_connect(new_ctx.get()));
+    std::unique_ptr<BIO, BioDeleter> new_bio(BIO_new_ssl(new_ctx.get(), 1));
     if (!new_bio) {
       throw KmipIOException(
           kmipcore::KMIP_IO_FAILURE,
-          "BIO_new_ssl_connect failed: " + getOpenSslError()
+          "BIO_new_ssl failed: " + getOpenSslError()
       );
     }
 
@@ -428,30 +431,50 @@ namespace kmipclient {
     configure_tls_verification(new_ctx.get(), ssl, m_host, m_tls_verification);
 
     SSL_set_mode(ssl, SSL_MODE_AUTO_RETRY);
-    BIO_set_conn_hostname(new_bio.get(), m_host.c_str());
-    BIO_set_conn_port(new_bio.get(), m_port.c_str());
 
-    if (m_timeout_ms > 0) {
-      if (BIO_set_nbio(new_bio.get(), 1) != 1) {
-        throw KmipIOException(
-            kmipcore::KMIP_IO_FAILURE,
-            "BIO_set_nbio(1) failed before connect"
-        );
-      }
+    // The TCP connection is established by us rather than by a connect BIO
+    // so that resolution can be cached and several addresses raced.
+    const auto started = std::chrono::steady_clock::now();
+    const auto deadline = started + std::chrono::milliseconds(m_timeout_ms);
+    auto &resolver = ResolverCache::instance();
+    int fd = -1;
+    try {
+      fd = connect_racing(
+          resolver.resolve(m_host, m_port, m_connect_options.dns_cache_ttl),
+          m_connect_options.attempt_delay,
+          m_timeout_ms
+      );
+    } catch (const KmipIOException &) {
+      // The cached addresses may be stale; resolve again next time.
+      resolver.invalidate(m_host, m_port);
+      throw;
+    }
+
+    const auto tcp_connected = std::chrono::steady_clock::now();
+
+    BIO *socket_bio = BIO_new_socket(fd, BIO_CLOSE);
+    if (socket_bio == nullptr) {
+      ::close(fd);
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          "BIO_new_socket failed: " + getOpenSslError()
+      );
+    }
+    BIO_push(new_bio.get(), socket_bio);
 
-      const auto deadline = std::chrono::steady_clock::now() +
-                            std::chrono::milliseconds(m_timeout_ms);
+    if (m_timeout_ms > 0) {
+      // The socket is still non-blocking from the connect race.
       for (;;) {
         ERR_clear_error();
-        const int connect_ret = BIO_do_connect(new_bio.get());
-        if (connect_ret == 1) {
+        const int handshake_ret = BIO_do_handshake(new_bio.get());
+        if (handshake_ret == 1) {
           break;
         }
 
         if (!BIO_should_retry(new_bio.get())) {
           throw KmipIOException(
               kmipcore::KMIP_IO_FAILURE,
-              "BIO_do_connect failed: " + getOpenSslError()
+              "TLS handshake failed: " + getOpenSslError()
           );
         }
 
@@ -459,24 +482,26 @@ namespace kmipclient {
             new_bio.get(), deadline, "connect/handshake", m_timeout_ms
         );
       }
-
-      restore_socket_blocking(new_bio.get());
-      if (BIO_set_nbio(new_bio.get(), 0) != 1) {
-        throw KmipIOException(
-            kmipcore::KMIP_IO_FAILURE,
-            "BIO_set_nbio(0) failed after connect"
-        );
-      }
+      set_socket_nonblocking(new_bio.get(), false);
     } else {
-      if (BIO_do_connect(new_bio.get()) != 1) {
+      set_socket_nonblocking(new_bio.get(), false);
+      if (BIO_do_handshake(new_bio.get()) != 1) {
         throw KmipIOException(
             kmipcore::KMIP_IO_FAILURE,
-            "BIO_do_connect failed: " + getOpenSslError()
+            "TLS handshake failed: " + getOpenSslError()
         );
       }
     }
 
     ensure_tls_peer_verified(ssl, m_tls_verification);
+    m_connect_timing = {
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            tcp_connected - started
+        ),
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - tcp_connected
+        ),
+    };
 
     // Apply per-operation I/O timeouts on the now-connected socket so that
     // every subsequent BIO_read / BIO_write times out after m_timeout_ms ms.
@@ -484,6 +509,7 @@ namespace kmipclient {
 
     bio_ = std::move(new_bio);
     ctx_ = std::move(new_ctx);
+    nonblocking_ = false;
 
     m_isConnected = true;
     return true;
@@ -497,13 +523,69 @@ namespace kmipclient {
     if (ctx_) {
       ctx_.reset();
     }
+    nonblocking_ = false;
     m_isConnected = false;
   }
 
+  void NetClientOpenSSL::use_nonblocking(bool nonblocking) {
+    // The socket keeps the mode of the last call, so a connection used only
+    // in one mode switches at most once.
+    if (nonblocking_ != nonblocking) {
+      set_socket_nonblocking(bio_.get(), nonblocking);
+      nonblocking_ = nonblocking;
+    }
+  }
+
+  int NetClientOpenSSL::native_handle() const noexcept {
+    int fd = -1;
+    if (!bio_ || BIO_get_fd(bio_.get(), &fd) < 0) {
+      return -1;
+    }
+    return fd;
+  }
+
+  bool NetClientOpenSSL::is_idle_usable() noexcept {
+    if (!m_isConnected || !bio_) {
+      return false;
+    }
+    SSL *ssl = nullptr;
+    BIO_get_ssl(bio_.get(), &ssl);
+    int fd = -1;
+    if (ssl == nullptr || SSL_pending(ssl) > 0 ||
+        BIO_get_fd(bio_.get(), &fd) < 0 || fd < 0) {
+      return false;
+    }
+
+    const int state = probe_idle_socket(fd);
+    if (state != -1) {
+      return state == 1;
+    }
+
+    // Input is waiting.  With TLS 1.3 that is normally a session ticket sent
+    // after the handshake, so let OpenSSL process the pending records without
+    // blocking and see what is left.
+    const int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+      return false;
+    }
+    ERR_clear_error();
+    std::uint8_t byte = 0;
+    const int ret = SSL_peek(ssl, &byte, 1);
+    const int error = ret > 0 ? SSL_ERROR_NONE : SSL_get_error(ssl, ret);
+    ERR_clear_error();
+    if (fcntl(fd, F_SETFL, flags) != 0) {
+      return false;
+    }
+    // Application data (ret > 0) is unexpected on an idle connection;
+    // close_notify and errors mean the session is gone.
+    return ret <= 0 && error == SSL_ERROR_WANT_READ;
+  }
+
   int NetClientOpenSSL::send(std::span<const std::uint8_t> data) {
     if (!checkConnected()) {
       return -1;
     }
+    use_nonblocking(false);
     const int dlen = static_cast<int>(data.size());
     errno = 0;
     const int ret = BIO_write(bio_.get(), data.data(), dlen);
@@ -515,10 +597,34 @@ namespace kmipclient {
     return ret;
   }
 
+  int NetClientOpenSSL::send_nonblocking(
+      std::span<const std::uint8_t> data, Readiness &wait
+  ) {
+    wait = Readiness::none;
+    if (!m_isConnected || !bio_) {
+      return -1;
+    }
+    use_nonblocking(true);
+    const int ret =
+        BIO_write(bio_.get(), data.data(), static_cast<int>(data.size()));
+    if (ret > 0) {
+      return ret;
+    }
+    if (BIO_should_retry(bio_.get())) {
+      // A TLS record may need the other direction, e.g. during
+      // renegotiation.
+      wait = BIO_should_read(bio_.get()) ? Readiness::readable
+                                         : Readiness::writable;
+      return 0;
+    }
+    return -1;
+  }
+
   int NetClientOpenSSL::recv(std::span<std::uint8_t> data) {
     if (!checkConnected()) {
       return -1;
     }
+    use_nonblocking(false);
     const int dlen = static_cast<int>(data.size());
     errno = 0;
     const int ret = BIO_read(bio_.get(), data.data(), dlen);
@@ -531,4 +637,25 @@ namespace kmipclient {
     return ret;
   }
 
+  int NetClientOpenSSL::recv_nonblocking(
+      std::span<std::uint8_t> data, Readiness &wait
+  ) {
+    wait = Readiness::none;
+    if (!m_isConnected || !bio_) {
+      return -1;
+    }
+    use_nonblocking(true);
+    const int ret =
+        BIO_read(bio_.get(), data.data(), static_cast<int>(data.size()));
+    if (ret > 0) {
+      return ret;
+    }
+    if (BIO_should_retry(bio_.get())) {
+      wait = BIO_should_write(bio_.get()) ? Readiness::writable
+                                          : Readiness::readable;
+      return 0;
+    }
+    return ret == 0 ? 0 : -1;
+  }
+
 }  // namespace kmipclient
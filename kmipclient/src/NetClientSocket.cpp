@@ -0,0 +1,164 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/NetClientSocket.hpp"
+
+#include "SocketConnector.hpp"
+#include "kmipclient/KmipIOException.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace kmipclient {
+
+  static std::string timeoutMessage(const char *op, int timeout_ms) {
+    return std::string("KMIP ") + op + " timed out after " +
+           std::to_string(timeout_ms) + "ms";
+  }
+
+  static bool is_timeout_errno() {
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == ETIMEDOUT;
+  }
+
+  NetClientSocket::~NetClientSocket() {
+    // Avoid calling virtual methods from destructor.
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  void NetClientSocket::adopt(int fd) {
+    close();
+
+    const int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags & ~O_NONBLOCK) != 0) {
+      const std::string error = strerror(errno);
+      ::close(fd);
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          "Unable to switch socket to blocking mode: " + error
+      );
+    }
+
+    if (m_timeout_ms > 0) {
+      struct timeval tv{};
+      tv.tv_sec = m_timeout_ms / 1000;
+      tv.tv_usec = (m_timeout_ms % 1000) * 1000;
+      if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) != 0 ||
+          setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) != 0) {
+        const std::string error = strerror(errno);
+        ::close(fd);
+        throw KmipIOException(
+            kmipcore::KMIP_IO_FAILURE,
+            "Failed to set socket timeouts (" + std::to_string(m_timeout_ms) +
+                "ms): " + error
+        );
+      }
+    }
+
+    fd_ = fd;
+    m_isConnected = true;
+  }
+
+  void NetClientSocket::close() {
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+    m_isConnected = false;
+  }
+
+  int NetClientSocket::send(std::span<const std::uint8_t> data) {
+    if (!m_isConnected && !connect()) {
+      return -1;
+    }
+    ssize_t ret = 0;
+    do {
+      ret = ::send(fd_, data.data(), data.size(), MSG_NOSIGNAL);
+    } while (ret < 0 && errno == EINTR);
+    if (ret < 0 && is_timeout_errno()) {
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE, timeoutMessage("send", m_timeout_ms)
+      );
+    }
+    return static_cast<int>(ret);
+  }
+
+  int NetClientSocket::recv(std::span<std::uint8_t> data) {
+    if (!m_isConnected && !connect()) {
+      return -1;
+    }
+    ssize_t ret = 0;
+    do {
+      ret = ::recv(fd_, data.data(), data.size(), 0);
+    } while (ret < 0 && errno == EINTR);
+    if (ret < 0 && is_timeout_errno()) {
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE, timeoutMessage("receive", m_timeout_ms)
+      );
+    }
+    return static_cast<int>(ret);
+  }
+
+  int NetClientSocket::send_nonblocking(
+      std::span<const std::uint8_t> data, Readiness &wait
+  ) {
+    wait = Readiness::none;
+    if (!m_isConnected) {
+      return -1;
+    }
+    ssize_t ret = 0;
+    do {
+      ret = ::send(
+          fd_, data.data(), data.size(), MSG_NOSIGNAL | MSG_DONTWAIT
+      );
+    } while (ret < 0 && errno == EINTR);
+    if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      wait = Readiness::writable;
+      return 0;
+    }
+    return static_cast<int>(ret);
+  }
+
+  int NetClientSocket::recv_nonblocking(
+      std::span<std::uint8_t> data, Readiness &wait
+  ) {
+    wait = Readiness::none;
+    if (!m_isConnected) {
+      return -1;
+    }
+    ssize_t ret = 0;
+    do {
+      ret = ::recv(fd_, data.data(), data.size(), MSG_DONTWAIT);
+    } while (ret < 0 && errno == EINTR);
+    if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      wait = Readiness::readable;
+      return 0;
+    }
+    return static_cast<int>(ret);
+  }
+
+  bool NetClientSocket::is_idle_usable() noexcept {
+    // Plain TTLV has no unsolicited messages: any input is unexpected.
+    return m_isConnected && fd_ >= 0 && probe_idle_socket(fd_) == 1;
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,59 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/NetClientTcp.hpp"
+
+#include "SocketConnector.hpp"
+#include "kmipclient/KmipIOException.hpp"
+
+#include <chrono>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+namespace kmipclient {
+
+  bool NetClientTcp::connect() {
+    const auto started = std::chrono::steady_clock::now();
+    auto &resolver = ResolverCache::instance();
+    int fd = -1;
+    try {
+      fd = connect_racing(
+          resolver.resolve(m_host, m_port, m_connect_options.dns_cache_ttl),
+          m_connect_options.attempt_delay,
+          m_timeout_ms
+      );
+    } catch (const KmipIOException &) {
+      resolver.invalidate(m_host, m_port);
+      throw;
+    }
+
+    // Requests are written in one piece; don't hold back the last segment.
+    const int one = 1;
+    (void) setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    adopt(fd);
+    m_connect_timing = {
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - started
+        ),
+        std::chrono::microseconds{0},
+    };
+    return true;
+  }
+
+}  // namespace kmipclient
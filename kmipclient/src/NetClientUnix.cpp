@@ -0,0 +1,64 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/NetClientUnix.hpp"
+
+#include "kmipclient/KmipIOException.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace kmipclient {
+
+  bool NetClientUnix::connect() {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (m_host.empty() || m_host.size() >= sizeof(addr.sun_path)) {
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          "Invalid Unix socket path '" + m_host + "'"
+      );
+    }
+    std::memcpy(addr.sun_path, m_host.c_str(), m_host.size() + 1);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          std::string("socket(AF_UNIX) failed: ") + strerror(errno)
+      );
+    }
+
+    if (::connect(
+            fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)
+        ) != 0) {
+      const std::string error = strerror(errno);
+      ::close(fd);
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          "Unable to connect to Unix socket '" + m_host + "': " + error
+      );
+    }
+
+    adopt(fd);
+    return true;
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,192 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/PipelinedKmipClient.hpp"
+
+#include "IOUtils.hpp"
+#include "kmipclient/KmipIOException.hpp"
+#include "kmipcore/kmip_errors.hpp"
+
+#include <limits>
+#include <sstream>
+
+namespace kmipclient {
+
+  PipelinedKmipClient::PipelinedKmipClient(
+      NetClient &net_client,
+      const std::shared_ptr<kmipcore::Logger> &logger,
+      kmipcore::ProtocolVersion version,
+      size_t window
+  )
+    : net_client_(net_client),
+      io_(std::make_unique<IOUtils>(net_client, logger)),
+      version_(version),
+      window_(window) {
+    if (window_ == 0) {
+      throw kmipcore::KmipException(
+          -1, "PipelinedKmipClient: window must be greater than zero"
+      );
+    }
+  }
+
+  PipelinedKmipClient::~PipelinedKmipClient() = default;
+
+  kmipcore::RequestMessage PipelinedKmipClient::make_request_message() {
+    kmipcore::RequestMessage request(version_);
+    if (next_batch_item_id_ >
+        std::numeric_limits<uint32_t>::max() - BATCH_ITEM_ID_BLOCK) {
+      next_batch_item_id_ = 1;
+    }
+    request.setNextBatchItemId(next_batch_item_id_);
+    next_batch_item_id_ += BATCH_ITEM_ID_BLOCK;
+    return request;
+  }
+
+  PipelinedKmipClient::Ticket
+      PipelinedKmipClient::submit(kmipcore::RequestMessage request) {
+    for (const auto &item : request.getBatchItems()) {
+      if (in_flight_batch_item_ids_.contains(item.getUniqueBatchItemId())) {
+        std::ostringstream oss;
+        oss << "PipelinedKmipClient: batch item id "
+            << item.getUniqueBatchItemId()
+            << " is already used by a request in flight; build requests with "
+               "make_request_message()";
+        throw kmipcore::KmipException(-1, oss.str());
+      }
+    }
+
+    while (in_flight_.size() >= window_) {
+      receive_one();
+    }
+
+    const auto request_bytes = request.serialize();
+    try {
+      io_->send_message(request_bytes);
+    } catch (const KmipIOException &) {
+      // A partially written message desynchronizes the stream for every
+      // request sent before it as well.
+      fail_window(std::current_exception());
+      throw;
+    }
+
+    const Ticket ticket = next_ticket_++;
+    for (const auto &item : request.getBatchItems()) {
+      in_flight_batch_item_ids_.insert(item.getUniqueBatchItemId());
+    }
+    in_flight_.push_back(InFlight{ticket, std::move(request)});
+    return ticket;
+  }
+
+  void PipelinedKmipClient::receive_one() {
+    auto &oldest = in_flight_.front();
+    std::vector<uint8_t> bytes;
+    try {
+      bytes = io_->receive_message(oldest.request.getMaxResponseSize());
+    } catch (const KmipIOException &) {
+      fail_window(std::current_exception());
+      throw;
+    }
+
+    for (const auto &item : oldest.request.getBatchItems()) {
+      in_flight_batch_item_ids_.erase(item.getUniqueBatchItemId());
+    }
+    completed_.emplace(
+        oldest.ticket,
+        Completed{std::move(oldest.request), std::move(bytes), nullptr}
+    );
+    in_flight_.pop_front();
+  }
+
+  void PipelinedKmipClient::fail_window(const std::exception_ptr &error) {
+    for (auto &entry : in_flight_) {
+      completed_.emplace(
+          entry.ticket, Completed{std::move(entry.request), {}, error}
+      );
+    }
+    in_flight_.clear();
+    in_flight_batch_item_ids_.clear();
+    net_client_.close();
+  }
+
+  PipelinedKmipClient::Response PipelinedKmipClient::wait(Ticket ticket) {
+    auto it = completed_.find(ticket);
+    while (it == completed_.end()) {
+      bool pending = false;
+      for (const auto &entry : in_flight_) {
+        if (entry.ticket == ticket) {
+          pending = true;
+          break;
+        }
+      }
+      if (!pending) {
+        throw kmipcore::KmipException(
+            -1,
+            "PipelinedKmipClient: unknown or already collected ticket " +
+                std::to_string(ticket)
+        );
+      }
+      receive_one();
+      it = completed_.find(ticket);
+    }
+
+    Completed completed = std::move(it->second);
+    completed_.erase(it);
+    if (completed.error) {
+      std::rethrow_exception(completed.error);
+    }
+
+    // The parser copies the operation hints it needs from the request, so
+    // build it before the request is moved into the result.
+    auto parser = std::make_unique<kmipcore::ResponseParser>(
+        completed.bytes, completed.request
+    );
+    Response response{std::move(completed.request), std::move(parser)};
+    const auto count = static_cast<int>(response.parser->getBatchItemCount());
+    for (int idx = 0; idx < count; ++idx) {
+      const uint32_t echoed = response.parser->getUniqueBatchItemId(idx);
+      if (echoed == 0) {
+        continue;  // server does not echo ids; positional matching only
+      }
+      bool known = false;
+      for (const auto &item : response.request.getBatchItems()) {
+        if (item.getUniqueBatchItemId() == echoed) {
+          known = true;
+          break;
+        }
+      }
+      if (!known) {
+        std::ostringstream oss;
+        oss << "PipelinedKmipClient: response batch item id " << echoed
+            << " does not belong to request " << ticket
+            << "; connection is out of sync";
+        const auto error = std::make_exception_ptr(
+            KmipIOException(kmipcore::KMIP_IO_FAILURE, oss.str())
+        );
+        fail_window(error);
+        std::rethrow_exception(error);
+      }
+    }
+    return response;
+  }
+
+  void PipelinedKmipClient::drain() {
+    while (!in_flight_.empty()) {
+      receive_one();
+    }
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,136 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/PoolMetrics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace kmipclient {
+
+  // ============================================================================
+  // LatencyHistogram
+  // ============================================================================
+
+  void LatencyHistogram::record(
+      std::chrono::steady_clock::duration latency
+  ) noexcept {
+    const auto us = static_cast<std::uint64_t>(std::max<std::int64_t>(
+        0,
+        std::chrono::duration_cast<std::chrono::microseconds>(latency).count()
+    ));
+    // bit_width(us) is 0 below 1 us and i for [2^(i-1), 2^i).
+    const size_t bucket =
+        std::min<size_t>(static_cast<size_t>(std::bit_width(us)), BUCKETS - 1);
+
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_us_.fetch_add(us, std::memory_order_relaxed);
+    auto seen = max_us_.load(std::memory_order_relaxed);
+    while (us > seen && !max_us_.compare_exchange_weak(
+                            seen, us, std::memory_order_relaxed
+                        )) {
+    }
+  }
+
+  LatencyHistogram::Snapshot LatencyHistogram::snapshot() const noexcept {
+    // Not atomic as a whole; concurrent samples may be partially included.
+    Snapshot result;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+      result.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    result.count = count_.load(std::memory_order_relaxed);
+    result.sum = std::chrono::microseconds(
+        static_cast<std::int64_t>(sum_us_.load(std::memory_order_relaxed))
+    );
+    result.max = std::chrono::microseconds(
+        static_cast<std::int64_t>(max_us_.load(std::memory_order_relaxed))
+    );
+    return result;
+  }
+
+  std::chrono::microseconds
+      LatencyHistogram::Snapshot::upper_bound(size_t bucket) noexcept {
+    if (bucket + 1 >= BUCKETS) {
+      return std::chrono::microseconds::max();
+    }
+    return std::chrono::microseconds(std::int64_t{1} << bucket);
+  }
+
+  std::chrono::microseconds
+      LatencyHistogram::Snapshot::mean() const noexcept {
+    if (count == 0) {
+      return std::chrono::microseconds{0};
+    }
+    return sum / static_cast<std::int64_t>(count);
+  }
+
+  std::chrono::microseconds
+      LatencyHistogram::Snapshot::percentile(double q) const noexcept {
+    std::uint64_t total = 0;
+    for (const auto n : buckets) {
+      total += n;
+    }
+    if (total == 0) {
+      return std::chrono::microseconds{0};
+    }
+    const auto rank = static_cast<std::uint64_t>(
+        std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(total))
+    );
+    std::uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+      seen += buckets[i];
+      if (seen >= std::max<std::uint64_t>(rank, 1)) {
+        return std::min(upper_bound(i), max);
+      }
+    }
+    return max;
+  }
+
+  // ============================================================================
+  // PoolMetrics
+  // ============================================================================
+
+  void PoolMetrics::visit(PoolMetricsVisitor &visitor) const {
+    visitor.histogram("borrow_wait", borrow_wait);
+    visitor.histogram("connect", connect);
+    visitor.histogram("handshake", handshake);
+    visitor.histogram("hold", hold);
+    visitor.histogram("exchange", exchange);
+
+    visitor.counter("borrows", borrows);
+    visitor.counter("borrow_timeouts", borrow_timeouts);
+    visitor.counter("exhaustions", exhaustions);
+    visitor.counter("discards", discards);
+    visitor.counter("connects", connects);
+    visitor.counter("connect_failures", connect_failures);
+    visitor.counter("reconnects", reconnects);
+    visitor.counter("exchange_errors", exchange_errors);
+    visitor.counter("sheds", sheds);
+    visitor.counter("circuit_opens", circuit_opens);
+    visitor.counter("circuit_rejections", circuit_rejections);
+
+    visitor.gauge("idle", idle);
+    visitor.gauge("in_use", in_use);
+    visitor.gauge("waiting", waiting);
+    visitor.gauge("max", max);
+    visitor.gauge("limit", limit);
+    visitor.gauge("circuit_open", circuit_open);
+  }
+
+}  // namespace kmipclient
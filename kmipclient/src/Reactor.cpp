@@ -0,0 +1,183 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/Reactor.hpp"
+
+#include "kmipclient/KmipIOException.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace kmipclient {
+
+  PollReactor::PollReactor() {
+    int fds[2];
+    if (pipe(fds) != 0) {
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          std::string("PollReactor: pipe failed: ") + strerror(errno)
+      );
+    }
+    wake_read_ = fds[0];
+    wake_write_ = fds[1];
+    for (const int fd : fds) {
+      const int flags = fcntl(fd, F_GETFL, 0);
+      if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+        const std::string error = strerror(errno);
+        ::close(wake_read_);
+        ::close(wake_write_);
+        throw KmipIOException(
+            kmipcore::KMIP_IO_FAILURE,
+            "PollReactor: unable to make the wake-up pipe non-blocking: " +
+                error
+        );
+      }
+    }
+  }
+
+  PollReactor::~PollReactor() {
+    ::close(wake_read_);
+    ::close(wake_write_);
+  }
+
+  void PollReactor::post(std::function<void()> fn) {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      posted_.push_back(std::move(fn));
+    }
+    wake();
+  }
+
+  void PollReactor::when_ready(
+      int fd,
+      NetClient::Readiness readiness,
+      std::chrono::milliseconds timeout,
+      std::function<void(bool ready)> fn
+  ) {
+    const short events =
+        readiness == NetClient::Readiness::writable ? POLLOUT : POLLIN;
+    const auto deadline = timeout.count() > 0 ? Clock::now() + timeout
+                                              : Clock::time_point::max();
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      watches_.push_back(Watch{fd, events, deadline, std::move(fn)});
+    }
+    wake();
+  }
+
+  void PollReactor::stop() noexcept {
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      stopping_ = true;
+    }
+    wake();
+  }
+
+  void PollReactor::wake() noexcept {
+    const char byte = 0;
+    // A full pipe already guarantees a wake-up.
+    (void) !::write(wake_write_, &byte, 1);
+  }
+
+  void PollReactor::run() {
+    std::vector<pollfd> fds;
+    std::vector<std::function<void()>> due;
+    std::vector<std::function<void(bool)>> ready;
+    std::vector<std::function<void(bool)>> expired;
+    for (;;) {
+      // 1. Snapshot the watches; only this thread removes them, so the
+      //    first fds.size() - 1 entries stay in place during poll().
+      int timeout_ms = -1;
+      {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (stopping_) {
+          stopping_ = false;
+          return;
+        }
+        due.swap(posted_);
+        fds.assign(1, pollfd{wake_read_, POLLIN, 0});
+        const auto now = Clock::now();
+        for (const auto &watch : watches_) {
+          fds.push_back(pollfd{watch.fd, watch.events, 0});
+          if (watch.deadline != Clock::time_point::max()) {
+            const auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                std::max(watch.deadline - now, Clock::duration::zero())
+            );
+            const int ms = static_cast<int>(left.count());
+            timeout_ms = timeout_ms < 0 ? ms : std::min(timeout_ms, ms);
+          }
+        }
+      }
+      if (!due.empty()) {
+        for (auto &fn : due) {
+          fn();
+        }
+        due.clear();
+        continue;
+      }
+
+      // 2. Wait for a socket, a deadline or a wake-up.
+      int ret = 0;
+      do {
+        ret = ::poll(fds.data(), fds.size(), timeout_ms);
+      } while (ret < 0 && errno == EINTR);
+      if (fds[0].revents != 0) {
+        char buf[64];
+        while (::read(wake_read_, buf, sizeof(buf)) > 0) {
+        }
+      }
+
+      // 3. Hand out the ready and expired watches.
+      {
+        std::lock_guard<std::mutex> lk(mutex_);
+        const auto now = Clock::now();
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < watches_.size(); ++i) {
+          auto &watch = watches_[i];
+          const bool polled = i + 1 < fds.size();
+          if (polled && fds[i + 1].revents != 0) {
+            ready.push_back(std::move(watch.fn));
+          } else if (now >= watch.deadline) {
+            expired.push_back(std::move(watch.fn));
+          } else {
+            if (kept != i) {
+              watches_[kept] = std::move(watch);
+            }
+            ++kept;
+          }
+        }
+        watches_.erase(
+            watches_.begin() + static_cast<std::ptrdiff_t>(kept),
+            watches_.end()
+        );
+      }
+      for (auto &fn : ready) {
+        fn(true);
+      }
+      for (auto &fn : expired) {
+        fn(false);
+      }
+      ready.clear();
+      expired.clear();
+    }
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,109 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/RetryPolicy.hpp"
+
+#include "kmipcore/kmip_basics.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace kmipclient {
+
+  namespace {
+
+    /// A Locate for the Fresh member of a group marks the object it returns
+    /// as no longer fresh, so sending it twice may return another object.
+    bool takes_fresh_member(const kmipcore::RequestBatchItem &item) noexcept {
+      if (item.getOperation() != kmipcore::KMIP_OP_LOCATE) {
+        return false;
+      }
+      using kmipcore::object_group_member;
+      using kmipcore::tag;
+      try {
+        const auto payload = item.getRequestPayload();
+        const auto member =
+            payload == nullptr
+                ? nullptr
+                : payload->getChild(tag::KMIP_TAG_OBJECT_GROUP_MEMBER);
+        return member != nullptr &&
+               member->toEnum() ==
+                   static_cast<int32_t>(
+                       object_group_member::KMIP_GROUP_MEMBER_FRESH
+                   );
+      } catch (...) {
+        // Unreadable: assume the worst.
+        return true;
+      }
+    }
+
+  }  // namespace
+
+  bool RetryPolicy::is_idempotent(kmipcore::operation op) noexcept {
+    using kmipcore::operation;
+    switch (op) {
+      case operation::KMIP_OP_GET:
+      case operation::KMIP_OP_GET_ATTRIBUTES:
+      case operation::KMIP_OP_GET_ATTRIBUTE_LIST:
+      case operation::KMIP_OP_LOCATE:
+      case operation::KMIP_OP_QUERY:
+      case operation::KMIP_OP_DISCOVER_VERSIONS:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  bool RetryPolicy::is_idempotent(
+      const kmipcore::RequestMessage &request
+  ) noexcept {
+    const auto &items = request.getBatchItems();
+    return !items.empty() &&
+           std::all_of(items.begin(), items.end(), [](const auto &item) {
+             return is_idempotent(
+                        static_cast<kmipcore::operation>(item.getOperation())
+                    ) &&
+                    !takes_fresh_member(item);
+           });
+  }
+
+  bool RetryPolicy::may_retry(
+      bool idempotent, const KmipIOException &error, unsigned attempt
+  ) const noexcept {
+    return attempt < max_attempts && (idempotent || !error.bytes_sent());
+  }
+
+  std::chrono::milliseconds RetryPolicy::backoff(unsigned attempt) const {
+    if (attempt <= 1) {
+      return std::chrono::milliseconds(0);
+    }
+    // initial_backoff * 2^(attempt - 2), saturating at max_backoff.
+    auto wait = initial_backoff;
+    for (unsigned i = 2; i < attempt && wait < max_backoff; ++i) {
+      wait *= 2;
+    }
+    wait = std::min(wait, max_backoff);
+
+    thread_local std::minstd_rand random{std::random_device{}()};
+    const double spread = std::clamp(jitter, 0.0, 1.0);
+    std::uniform_real_distribution<double> factor(1.0 - spread, 1.0);
+    return std::chrono::milliseconds(static_cast<long long>(
+        static_cast<double>(wait.count()) * factor(random)
+    ));
+  }
+
+}  // namespace kmipclient
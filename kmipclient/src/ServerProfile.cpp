@@ -0,0 +1,68 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/ServerProfile.hpp"
+
+#include <algorithm>
+
+namespace kmipclient {
+
+  void ServerProfile::set_discovery(
+      std::vector<kmipcore::ProtocolVersion> server_versions,
+      kmipcore::ProtocolVersion chosen,
+      std::vector<kmipcore::operation> operations
+  ) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    server_versions_ = std::move(server_versions);
+    protocol_version_ = chosen;
+    operations_ = std::move(operations);
+  }
+
+  std::optional<kmipcore::ProtocolVersion>
+      ServerProfile::protocol_version() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return protocol_version_;
+  }
+
+  std::vector<kmipcore::ProtocolVersion>
+      ServerProfile::server_versions() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return server_versions_;
+  }
+
+  bool ServerProfile::supports(kmipcore::operation op) const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return operations_.empty() ||
+           std::find(operations_.begin(), operations_.end(), op) !=
+               operations_.end();
+  }
+
+  std::optional<kmipcore::ProtocolVersion> ServerProfile::choose_version(
+      const std::vector<kmipcore::ProtocolVersion> &server_versions,
+      const kmipcore::ProtocolVersion &preferred
+  ) {
+    std::optional<kmipcore::ProtocolVersion> best;
+    for (const auto &version : server_versions) {
+      if (preferred.is_at_least(version.getMajor(), version.getMinor()) &&
+          (!best || version.is_at_least(best->getMajor(), best->getMinor()))) {
+        best = version;
+      }
+    }
+    return best;
+  }
+
+}  // namespace kmipclient
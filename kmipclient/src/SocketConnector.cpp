@@ -0,0 +1,302 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "SocketConnector.hpp"
+
+#include "kmipclient/KmipIOException.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <netdb.h>
+#include <optional>
+#include <poll.h>
+#include <unistd.h>
+
+namespace kmipclient {
+
+  // ============================================================================
+  // ResolverCache
+  // ============================================================================
+
+  ResolverCache &ResolverCache::instance() {
+    static ResolverCache cache;
+    return cache;
+  }
+
+  static std::vector<SocketAddress>
+      resolve_uncached(const std::string &host, const std::string &port) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_ADDRCONFIG;
+
+    addrinfo *result = nullptr;
+    const int rc = getaddrinfo(host.c_str(), port.c_str(), &hints, &result);
+    if (rc != 0) {
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          "Unable to resolve " + host + ":" + port + ": " + gai_strerror(rc)
+      );
+    }
+
+    std::vector<SocketAddress> addresses;
+    for (const addrinfo *ai = result; ai != nullptr; ai = ai->ai_next) {
+      if (ai->ai_addrlen > sizeof(sockaddr_storage)) {
+        continue;
+      }
+      SocketAddress address;
+      std::memcpy(&address.storage, ai->ai_addr, ai->ai_addrlen);
+      address.length = ai->ai_addrlen;
+      address.family = ai->ai_family;
+      addresses.push_back(address);
+    }
+    freeaddrinfo(result);
+
+    if (addresses.empty()) {
+      throw KmipIOException(
+          kmipcore::KMIP_IO_FAILURE,
+          "No usable address for " + host + ":" + port
+      );
+    }
+    return addresses;
+  }
+
+  std::vector<SocketAddress> ResolverCache::resolve(
+      const std::string &host,
+      const std::string &port,
+      std::chrono::milliseconds ttl
+  ) {
+    if (ttl.count() <= 0) {
+      return resolve_uncached(host, port);
+    }
+
+    const std::string key = host + '\n' + port;
+    const auto now = std::chrono::steady_clock::now();
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      auto it = entries_.find(key);
+      if (it != entries_.end() && it->second.expires > now) {
+        return it->second.addresses;
+      }
+    }
+
+    // Resolve without the lock; concurrent misses may resolve twice.
+    auto addresses = resolve_uncached(host, port);
+    std::lock_guard<std::mutex> lk(mutex_);
+    entries_[key] = Entry{addresses, now + ttl};
+    return addresses;
+  }
+
+  void ResolverCache::invalidate(
+      const std::string &host, const std::string &port
+  ) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    entries_.erase(host + '\n' + port);
+  }
+
+  // ============================================================================
+  // Connection racing
+  // ============================================================================
+
+  std::vector<SocketAddress>
+      interleave_address_families(std::vector<SocketAddress> addresses) {
+    if (addresses.empty()) {
+      return addresses;
+    }
+    const int first_family = addresses.front().family;
+    std::deque<SocketAddress> preferred;
+    std::deque<SocketAddress> other;
+    for (auto &address : addresses) {
+      (address.family == first_family ? preferred : other).push_back(address);
+    }
+
+    std::vector<SocketAddress> result;
+    result.reserve(addresses.size());
+    while (!preferred.empty() || !other.empty()) {
+      if (!preferred.empty()) {
+        result.push_back(preferred.front());
+        preferred.pop_front();
+      }
+      if (!other.empty()) {
+        result.push_back(other.front());
+        other.pop_front();
+      }
+    }
+    return result;
+  }
+
+  namespace {
+
+    /// Closes every socket still owned by a failed or finished race.
+    struct Attempts {
+      std::vector<pollfd> fds;
+
+      ~Attempts() {
+        for (const auto &pfd : fds) {
+          ::close(pfd.fd);
+        }
+      }
+
+      /// Hands @p index over to the caller; it will not be closed.
+      int release(size_t index) {
+        const int fd = fds[index].fd;
+        fds.erase(fds.begin() + static_cast<std::ptrdiff_t>(index));
+        return fd;
+      }
+
+      void drop(size_t index) { ::close(release(index)); }
+    };
+
+  }  // namespace
+
+  int connect_racing(
+      const std::vector<SocketAddress> &addresses,
+      std::chrono::milliseconds attempt_delay,
+      int timeout_ms
+  ) {
+    using clock = std::chrono::steady_clock;
+
+    const auto ordered = interleave_address_families(addresses);
+    const auto start = clock::now();
+    const std::optional<clock::time_point> deadline =
+        timeout_ms > 0
+            ? std::optional(start + std::chrono::milliseconds(timeout_ms))
+            : std::nullopt;
+
+    Attempts attempts;
+    size_t next = 0;
+    auto next_start = start;
+    std::string last_error = "no address to connect to";
+
+    for (;;) {
+      auto now = clock::now();
+
+      // Start the next attempt when its turn has come, or right away when
+      // nothing else is in flight.
+      if (next < ordered.size() &&
+          (now >= next_start || attempts.fds.empty())) {
+        const auto &address = ordered[next++];
+        const int fd = ::socket(
+            address.family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0
+        );
+        if (fd < 0) {
+          last_error = std::string("socket() failed: ") + strerror(errno);
+          continue;
+        }
+        if (::connect(
+                fd,
+                reinterpret_cast<const sockaddr *>(&address.storage),
+                address.length
+            ) == 0) {
+          return fd;  // connected immediately (e.g. loopback)
+        }
+        if (errno != EINPROGRESS) {
+          last_error = std::string("connect() failed: ") + strerror(errno);
+          ::close(fd);
+          continue;
+        }
+        attempts.fds.push_back(pollfd{fd, POLLOUT, 0});
+        next_start = now + attempt_delay;
+        continue;
+      }
+
+      if (attempts.fds.empty()) {
+        throw KmipIOException(
+            kmipcore::KMIP_IO_FAILURE,
+            "Unable to connect to any resolved address: " + last_error
+        );
+      }
+
+      if (deadline && now >= *deadline) {
+        throw KmipIOException(
+            kmipcore::KMIP_IO_FAILURE,
+            "KMIP connect timed out after " + std::to_string(timeout_ms) +
+                "ms"
+        );
+      }
+
+      // Sleep until a socket completes, the next attempt is due, or time is
+      // up.
+      std::optional<clock::time_point> wake = deadline;
+      if (next < ordered.size() && (!wake || next_start < *wake)) {
+        wake = next_start;
+      }
+      int wait_ms = -1;
+      if (wake) {
+        wait_ms = static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(*wake - now)
+                .count()
+        );
+        wait_ms = std::max(wait_ms, 1);
+      }
+
+      const int ready = ::poll(
+          attempts.fds.data(),
+          static_cast<nfds_t>(attempts.fds.size()),
+          wait_ms
+      );
+      if (ready < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw KmipIOException(
+            kmipcore::KMIP_IO_FAILURE,
+            std::string("poll failed while connecting: ") + strerror(errno)
+        );
+      }
+
+      for (size_t i = attempts.fds.size(); i-- > 0;) {
+        if (attempts.fds[i].revents == 0) {
+          continue;
+        }
+        int error = 0;
+        socklen_t length = sizeof(error);
+        if (getsockopt(
+                attempts.fds[i].fd, SOL_SOCKET, SO_ERROR, &error, &length
+            ) != 0) {
+          error = errno;
+        }
+        if (error == 0) {
+          return attempts.release(i);
+        }
+        last_error = std::string("connect() failed: ") + strerror(error);
+        attempts.drop(i);
+        // A failed attempt lets the next address start without delay.
+        next_start = clock::now();
+      }
+    }
+  }
+
+  int probe_idle_socket(int fd) noexcept {
+    std::uint8_t byte = 0;
+    ssize_t n = 0;
+    do {
+      n = ::recv(fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    } while (n < 0 && errno == EINTR);
+    if (n > 0) {
+      return -1;
+    }
+    if (n == 0) {
+      return 0;  // orderly shutdown by the peer
+    }
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 1 : 0;
+  }
+
+}  // namespace kmipclient
@@ -0,0 +1,104 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef SOCKETCONNECTOR_HPP
+#define SOCKETCONNECTOR_HPP
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <sys/socket.h>
+#include <unordered_map>
+#include <vector>
+
+namespace kmipclient {
+
+  /// One resolved socket address.
+  struct SocketAddress {
+    sockaddr_storage storage{};
+    socklen_t length = 0;
+    int family = AF_UNSPEC;
+  };
+
+  /**
+   * Process-wide cache of getaddrinfo() results, keyed by host and port.
+   *
+   * getaddrinfo() does not report record TTLs, so entries live for the
+   * duration given by the caller.  Entries are dropped with invalidate()
+   * when no resolved address could be connected.
+   */
+  class ResolverCache {
+  public:
+    static ResolverCache &instance();
+
+    /// Resolves @p host : @p port for TCP, reusing a cached result younger
+    /// than @p ttl.  A zero @p ttl bypasses the cache.  Throws
+    /// KmipIOException when resolution fails.
+    std::vector<SocketAddress> resolve(
+        const std::string &host,
+        const std::string &port,
+        std::chrono::milliseconds ttl
+    );
+
+    /// Forgets the cached result for @p host : @p port.
+    void invalidate(const std::string &host, const std::string &port);
+
+  private:
+    struct Entry {
+      std::vector<SocketAddress> addresses;
+      std::chrono::steady_clock::time_point expires;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+  };
+
+  /// Reorders @p addresses so that address families alternate, starting
+  /// with the family of the first (most preferred) address (RFC 8305, 4).
+  std::vector<SocketAddress>
+      interleave_address_families(std::vector<SocketAddress> addresses);
+
+  /**
+   * Connects a TCP socket to the first address that completes the handshake.
+   *
+   * Attempts are started in the order of interleave_address_families(), the
+   * next one after @p attempt_delay or as soon as an earlier attempt fails;
+   * earlier attempts keep running meanwhile ("Happy Eyeballs", RFC 8305).
+   * All losing sockets are closed.
+   *
+   * @param timeout_ms Overall limit; zero or negative waits indefinitely.
+   * @return Connected socket in non-blocking mode.
+   * @throws KmipIOException when every address failed or the time ran out.
+   */
+  int connect_racing(
+      const std::vector<SocketAddress> &addresses,
+      std::chrono::milliseconds attempt_delay,
+      int timeout_ms
+  );
+
+  /**
+   * Checks without blocking that an idle connected socket is still open.
+   *
+   * @return 1 when the socket is open with nothing to read, 0 when it was
+   *         closed or reset by the peer, and -1 when unread input is waiting
+   *         (the caller decides whether that input is acceptable).
+   */
+  int probe_idle_socket(int fd) noexcept;
+
+}  // namespace kmipclient
+
+#endif  // SOCKETCONNECTOR_HPP
@@ -0,0 +1,75 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/AdaptiveLimiter.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+using kmipclient::AdaptiveLimiter;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+TEST(AdaptiveLimiterTest, ShrinksWhenLatencyInflatesAndRecovers) {
+  AdaptiveLimiter limiter({
+      .initial_limit = 16,
+      .min_limit = 2,
+      .max_limit = 32,
+  });
+  EXPECT_EQ(limiter.limit(), 16u);
+
+  for (int i = 0; i < 100; ++i) {
+    limiter.on_success(milliseconds(1), 16);
+  }
+  EXPECT_EQ(limiter.baseline(), milliseconds(1));
+  const size_t healthy = limiter.limit();
+  EXPECT_GT(healthy, 16u);
+
+  // A brownout: every round trip takes ten times the baseline.
+  for (int i = 0; i < 200; ++i) {
+    limiter.on_success(milliseconds(10), limiter.limit());
+  }
+  EXPECT_EQ(limiter.limit(), 2u);
+
+  for (int i = 0; i < 500; ++i) {
+    limiter.on_success(milliseconds(1), limiter.limit());
+  }
+  EXPECT_GT(limiter.limit(), 8u);
+  EXPECT_LE(limiter.limit(), 32u);
+}
+
+TEST(AdaptiveLimiterTest, BacksOffOncePerEpisodeAndIgnoresIdleCapacity) {
+  AdaptiveLimiter limiter({.initial_limit = 8, .max_limit = 8});
+
+  // Failures of requests that were in flight together count once.
+  for (int i = 0; i < 4; ++i) {
+    limiter.on_failure();
+  }
+  EXPECT_EQ(limiter.limit(), 6u);
+
+  // Fast responses at low utilisation do not raise the limit.
+  for (int i = 0; i < 100; ++i) {
+    limiter.on_success(microseconds(500), 1);
+  }
+  EXPECT_EQ(limiter.limit(), 6u);
+
+  EXPECT_THROW(AdaptiveLimiter({.min_limit = 0}), kmipcore::KmipException);
+  EXPECT_THROW(AdaptiveLimiter({.tolerance = 1.0}), kmipcore::KmipException);
+  EXPECT_THROW(AdaptiveLimiter({.backoff = 1.0}), kmipcore::KmipException);
+}
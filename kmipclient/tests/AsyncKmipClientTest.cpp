@@ -0,0 +1,137 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/AsyncKmipClient.hpp"
+
+#include "FakeNetClient.hpp"
+
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kmipclient;
+
+namespace {
+
+  /// Activates any object except "missing".
+  kmipcore::ResponseMessage activate_any(const kmipcore::RequestMessage &rq) {
+    return test::make_response_message(
+        rq, {test::echo_id_item(rq.getBatchItems().front())}
+    );
+  }
+
+}  // namespace
+
+TEST(AsyncKmipClientTest, FutureAndCallbackVariantsDeliverResults) {
+  KmipClientPool pool(test::fake_pool(activate_any, 2));
+  AsyncKmipClient async(pool);
+
+  auto activated = async.activate_async("key-1");
+
+  std::promise<std::string> reported;
+  async.activate_async("key-2", [&](std::future<std::string> id) {
+    reported.set_value(id.get());
+  });
+
+  EXPECT_EQ(activated.get(), "key-1");
+  EXPECT_EQ(reported.get_future().get(), "key-2");
+}
+
+TEST(AsyncKmipClientTest, ErrorsReachCallbacks) {
+  KmipClientPool pool(test::fake_pool(activate_any, 1));
+  AsyncKmipClient async(pool, 1);
+
+  // A KMIP error keeps the connection.
+  std::promise<void> server_error;
+  async.activate_async("missing", [&](std::future<std::string> id) {
+    try {
+      (void) id.get();
+      server_error.set_value();
+    } catch (...) {
+      server_error.set_exception(std::current_exception());
+    }
+  });
+  EXPECT_THROW(server_error.get_future().get(), kmipcore::KmipException);
+  EXPECT_EQ(pool.metrics().discards, 0u);
+
+  // A transport error discards it.
+  std::promise<void> transport_error;
+  async.submit(
+      [](KmipClient &) -> int {
+        throw KmipIOException(kmipcore::KMIP_IO_FAILURE, "connection reset");
+      },
+      [&](std::future<int> result) {
+        try {
+          (void) result.get();
+          transport_error.set_value();
+        } catch (...) {
+          transport_error.set_exception(std::current_exception());
+        }
+      }
+  );
+  EXPECT_THROW(transport_error.get_future().get(), KmipIOException);
+  for (int i = 0; i < 200 && pool.metrics().discards == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(pool.metrics().discards, 1u);
+
+  // A throwing callback does not take the worker down.
+  async.activate_async("key-1", [](std::future<std::string>) {
+    throw std::runtime_error("callback failed");
+  });
+  EXPECT_EQ(async.activate_async("key-2").get(), "key-2");
+}
+
+TEST(AsyncKmipClientTest, ShutdownCompletesQueuedWork) {
+  KmipClientPool pool(test::fake_pool(activate_any, 1));
+  auto async = std::make_unique<AsyncKmipClient>(pool, 1);
+
+  // Keep the only worker busy until the shutdown has begun, which makes
+  // the client refuse new work.
+  std::promise<void> started;
+  AsyncKmipClient *client = async.get();
+  auto busy = client->submit([client, &started](KmipClient &) {
+    started.set_value();
+    for (;;) {
+      try {
+        client->submit([](KmipClient &) {});
+      } catch (const kmipcore::KmipException &) {
+        return;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  started.get_future().wait();
+  std::vector<std::future<std::string>> queued;
+  for (int i = 0; i < 5; ++i) {
+    queued.push_back(async->activate_async("key-" + std::to_string(i)));
+  }
+
+  async.reset();
+
+  busy.get();
+  for (size_t i = 0; i < queued.size(); ++i) {
+    ASSERT_EQ(
+        queued[i].wait_for(std::chrono::seconds(0)), std::future_status::ready
+    );
+    EXPECT_EQ(queued[i].get(), "key-" + std::to_string(i));
+  }
+}
@@ -0,0 +1,78 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CircuitBreaker.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+using kmipclient::CircuitBreaker;
+using State = CircuitBreaker::State;
+using std::chrono::milliseconds;
+
+TEST(CircuitBreakerTest, OpensAfterConsecutiveFailuresOnly) {
+  CircuitBreaker breaker({.failure_threshold = 3});
+  breaker.on_failure();
+  breaker.on_failure();
+  breaker.on_success();  // resets the streak
+  breaker.on_failure();
+  breaker.on_failure();
+  EXPECT_TRUE(breaker.allows());
+
+  breaker.on_failure();
+  EXPECT_EQ(breaker.state(), State::open);
+  EXPECT_FALSE(breaker.allows());
+  EXPECT_EQ(breaker.opens(), 1u);
+
+  EXPECT_THROW(
+      CircuitBreaker({.failure_threshold = 0}), kmipcore::KmipException
+  );
+  EXPECT_THROW(CircuitBreaker({.jitter = 1.0}), kmipcore::KmipException);
+}
+
+TEST(CircuitBreakerTest, SingleProbeWithExponentialBackoff) {
+  int changes = 0;
+  CircuitBreaker breaker({
+      .failure_threshold = 1,
+      .open_duration = milliseconds(100),
+      .max_backoff = milliseconds(300),
+      .jitter = 0.0,
+      .listener = [&](State, State) { ++changes; },
+  });
+  breaker.on_failure();
+  const auto first = *breaker.probe_due();
+  EXPECT_FALSE(breaker.begin_probe(first - milliseconds(1)));
+
+  ASSERT_TRUE(breaker.begin_probe(first));
+  EXPECT_EQ(breaker.state(), State::half_open);
+  EXPECT_FALSE(breaker.begin_probe(first));  // one probe at a time
+  EXPECT_FALSE(breaker.probe_due().has_value());
+
+  const auto failed_at = std::chrono::steady_clock::now();
+  breaker.end_probe(false);
+  const auto second = *breaker.probe_due();
+  EXPECT_GE(second - failed_at, milliseconds(200));
+  EXPECT_LE(second - failed_at, milliseconds(250));
+
+  ASSERT_TRUE(breaker.begin_probe(second));
+  breaker.end_probe(true);
+  EXPECT_TRUE(breaker.allows());
+  EXPECT_EQ(breaker.opens(), 1u);
+  EXPECT_EQ(changes, 5);  // open, half, open, half, closed
+}
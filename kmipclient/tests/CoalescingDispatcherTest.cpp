@@ -0,0 +1,168 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CoalescingDispatcher.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipcore/kmip_basics.hpp"
+
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kmipclient;
+using kmipcore::Element;
+using kmipcore::tag;
+
+namespace {
+
+  /// Batch item counts of the request messages a key server received.
+  struct Received {
+    std::mutex mutex;
+    std::vector<size_t> items_per_message;
+  };
+
+  /// Answers Get, Get Attributes and Activate for any key except "missing".
+  kmipcore::ResponseBatchItem answer(const kmipcore::RequestBatchItem &item) {
+    const auto id = item.getRequestPayload()
+                        ->getChild(tag::KMIP_TAG_UNIQUE_IDENTIFIER)
+                        ->toString();
+    if (id == "missing") {
+      auto failed = test::make_success_item(item);
+      failed.setResultStatus(kmipcore::KMIP_STATUS_OPERATION_FAILED);
+      failed.setResultReason(kmipcore::KMIP_REASON_ITEM_NOT_FOUND);
+      return failed;
+    }
+
+    auto payload = Element::createStructure(tag::KMIP_TAG_RESPONSE_PAYLOAD);
+    const auto add = [&payload](std::shared_ptr<Element> element) {
+      payload->asStructure()->add(std::move(element));
+    };
+    add(Element::createTextString(tag::KMIP_TAG_UNIQUE_IDENTIFIER, id));
+    if (item.getOperation() == kmipcore::KMIP_OP_GET) {
+      add(Element::createEnumeration(
+          tag::KMIP_TAG_OBJECT_TYPE, kmipcore::KMIP_OBJTYPE_SYMMETRIC_KEY
+      ));
+      auto key_block = Element::createStructure(tag::KMIP_TAG_KEY_BLOCK);
+      key_block->asStructure()->add(Element::createEnumeration(
+          tag::KMIP_TAG_KEY_FORMAT_TYPE, kmipcore::KMIP_KEYFORMAT_RAW
+      ));
+      auto key_value = Element::createStructure(tag::KMIP_TAG_KEY_VALUE);
+      key_value->asStructure()->add(Element::createByteString(
+          tag::KMIP_TAG_KEY_MATERIAL, std::vector<uint8_t>(32, 0x2A)
+      ));
+      key_block->asStructure()->add(key_value);
+      auto key = Element::createStructure(tag::KMIP_TAG_SYMMETRIC_KEY);
+      key->asStructure()->add(key_block);
+      add(key);
+    } else if (item.getOperation() == kmipcore::KMIP_OP_GET_ATTRIBUTES) {
+      auto state = Element::createStructure(tag::KMIP_TAG_ATTRIBUTE);
+      state->asStructure()->add(
+          Element::createTextString(tag::KMIP_TAG_ATTRIBUTE_NAME, "State")
+      );
+      state->asStructure()->add(Element::createEnumeration(
+          tag::KMIP_TAG_ATTRIBUTE_VALUE, kmipcore::KMIP_STATE_ACTIVE
+      ));
+      add(state);
+    }
+    return test::make_success_item(item, payload);
+  }
+
+  KmipClientPool::Config key_server_pool(std::shared_ptr<Received> received) {
+    return test::fake_pool([received](const kmipcore::RequestMessage &rq) {
+      {
+        std::lock_guard<std::mutex> lk(received->mutex);
+        received->items_per_message.push_back(rq.getBatchItemCount());
+      }
+      std::vector<kmipcore::ResponseBatchItem> items;
+      for (const auto &item : rq.getBatchItems()) {
+        items.push_back(answer(item));
+      }
+      return test::make_response_message(rq, std::move(items));
+    });
+  }
+
+}  // namespace
+
+TEST(CoalescingDispatcherTest, ConcurrentGetsShareOneMessage) {
+  auto received = std::make_shared<Received>();
+  KmipClientPool pool(key_server_pool(received));
+  CoalescingDispatcher dispatcher(
+      pool, {.window = std::chrono::seconds(1), .max_operations = 4}
+  );
+
+  std::vector<std::future<std::unique_ptr<Key>>> keys(4);
+  std::vector<std::thread> callers;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    callers.emplace_back([&, i] {
+      keys[i] = dispatcher.get_key("key-" + std::to_string(i));
+    });
+  }
+  for (auto &caller : callers) {
+    caller.join();
+  }
+  for (auto &key : keys) {
+    EXPECT_EQ(key.get()->value().size(), 32u);
+  }
+
+  EXPECT_EQ(dispatcher.messages_sent(), 1u);
+  // One Get plus one Get Attributes per key.
+  EXPECT_EQ(received->items_per_message, std::vector<size_t>{8});
+}
+
+TEST(CoalescingDispatcherTest, FailedOperationLeavesOthersIntact) {
+  auto received = std::make_shared<Received>();
+  KmipClientPool pool(key_server_pool(received));
+  CoalescingDispatcher dispatcher(
+      pool, {.window = std::chrono::seconds(1), .max_operations = 3}
+  );
+
+  auto found = dispatcher.get_key("key-1");
+  auto missing = dispatcher.get_key("missing");
+  auto activated = dispatcher.activate("key-2");
+
+  EXPECT_EQ(found.get()->value().size(), 32u);
+  EXPECT_THROW(missing.get(), kmipcore::KmipException);
+  EXPECT_EQ(activated.get(), "key-2");
+  EXPECT_EQ(dispatcher.messages_sent(), 1u);
+}
+
+TEST(CoalescingDispatcherTest, FullBatchIsSentBeforeWindowCloses) {
+  auto received = std::make_shared<Received>();
+  KmipClientPool pool(key_server_pool(received));
+  CoalescingDispatcher dispatcher(
+      pool, {.window = std::chrono::seconds(30), .max_operations = 3}
+  );
+
+  std::vector<std::future<std::string>> results;
+  for (int i = 0; i < 3; ++i) {
+    results.push_back(dispatcher.activate("key-" + std::to_string(i)));
+  }
+  for (auto &result : results) {
+    ASSERT_EQ(
+        result.wait_for(std::chrono::seconds(5)), std::future_status::ready
+    );
+  }
+  EXPECT_EQ(dispatcher.messages_sent(), 1u);
+  EXPECT_EQ(dispatcher.pending_count(), 0u);
+  EXPECT_EQ(received->items_per_message, std::vector<size_t>{3});
+}
@@ -0,0 +1,275 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CoroKmipClient.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipclient/KmipIOException.hpp"
+#include "kmipclient/NetClientUnix.hpp"
+#include "kmipcore/kmip_basics.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace kmipclient;
+using kmipcore::Element;
+
+namespace {
+
+  /// Unix socket KMIP server holding objects "id-0" ... "id-4", one thread
+  /// per connection.  Locate returns at most two identifiers per page along
+  /// with the Located Items count; every other request is answered with
+  /// its Unique Identifier.  A silent server never answers.
+  class ObjectStoreServer {
+  public:
+    explicit ObjectStoreServer(bool silent = false)
+      : silent_(silent),
+        path_(
+            "/tmp/kmipclient-coro-test-" + std::to_string(::getpid()) +
+            ".sock"
+        ) {
+      ::unlink(path_.c_str());
+      fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      sockaddr_un addr{};
+      addr.sun_family = AF_UNIX;
+      std::strncpy(addr.sun_path, path_.c_str(), sizeof(addr.sun_path) - 1);
+      if (::bind(fd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) !=
+              0 ||
+          ::listen(fd_, 16) != 0) {
+        ADD_FAILURE() << "unable to listen on " << path_;
+      }
+      acceptor_ = std::thread([this] { accept_all(); });
+    }
+
+    ~ObjectStoreServer() {
+      ::shutdown(fd_, SHUT_RDWR);
+      ::close(fd_);
+      acceptor_.join();
+      std::lock_guard<std::mutex> lk(mutex_);
+      for (const int conn : connections_) {
+        ::shutdown(conn, SHUT_RDWR);
+      }
+      for (auto &t : workers_) {
+        t.join();
+      }
+      for (const int conn : connections_) {
+        ::close(conn);
+      }
+      ::unlink(path_.c_str());
+    }
+
+    [[nodiscard]] const std::string &path() const { return path_; }
+
+    std::atomic<int> accepted{0};
+    std::atomic<int> requests{0};
+
+  private:
+    void accept_all() {
+      for (;;) {
+        const int conn = ::accept(fd_, nullptr, nullptr);
+        if (conn < 0) {
+          return;
+        }
+        ++accepted;
+        std::lock_guard<std::mutex> lk(mutex_);
+        connections_.push_back(conn);
+        workers_.emplace_back([this, conn] { serve(conn); });
+      }
+    }
+
+    static bool read_exact(int conn, uint8_t *data, size_t size) {
+      while (size > 0) {
+        const ssize_t n = ::recv(conn, data, size, 0);
+        if (n <= 0) {
+          return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+      }
+      return true;
+    }
+
+    void serve(int conn) {
+      for (;;) {
+        std::vector<uint8_t> message(8);
+        if (!read_exact(conn, message.data(), 8)) {
+          return;
+        }
+        const size_t body = (static_cast<size_t>(message[4]) << 24) |
+                            (static_cast<size_t>(message[5]) << 16) |
+                            (static_cast<size_t>(message[6]) << 8) |
+                            static_cast<size_t>(message[7]);
+        message.resize(8 + body);
+        if (!read_exact(conn, message.data() + 8, body)) {
+          return;
+        }
+        ++requests;
+        if (silent_) {
+          continue;
+        }
+
+        size_t offset = 0;
+        const auto request = kmipcore::RequestMessage::fromElement(
+            Element::deserialize(message, offset)
+        );
+        const auto reply =
+            test::serialize_element(answer(request).toElement());
+        if (::send(conn, reply.data(), reply.size(), MSG_NOSIGNAL) !=
+            static_cast<ssize_t>(reply.size())) {
+          return;
+        }
+      }
+    }
+
+    static kmipcore::ResponseMessage
+        answer(const kmipcore::RequestMessage &rq) {
+      const auto &item = rq.getBatchItems().front();
+      if (item.getOperation() == kmipcore::KMIP_OP_LOCATE) {
+        return test::make_response_message(
+            rq, {test::locate_item(item, 5, true, 2)}
+        );
+      }
+      return test::make_response_message(rq, {test::echo_id_item(item)});
+    }
+
+    bool silent_;
+    std::string path_;
+    int fd_ = -1;
+    std::thread acceptor_;
+    std::mutex mutex_;
+    std::vector<int> connections_;
+    std::vector<std::thread> workers_;
+  };
+
+  /// Runs a PollReactor on its own thread for the lifetime of the object.
+  class ReactorThread {
+  public:
+    ReactorThread() : thread_([this] { reactor.run(); }) {}
+    ~ReactorThread() {
+      reactor.stop();
+      thread_.join();
+    }
+
+    PollReactor reactor;
+
+  private:
+    std::thread thread_;
+  };
+
+  CoroKmipClient::Config unix_client(
+      const std::string &path, std::size_t max_connections = 2
+  ) {
+    return {
+        .transport_factory =
+            [path] { return std::make_unique<NetClientUnix>(path, 1000); },
+        .max_connections = max_connections,
+    };
+  }
+
+  Task<std::vector<std::size_t>> activate_and_page(CoroKmipClient &kmip) {
+    const auto activated = co_await kmip.activate("id-0");
+    EXPECT_EQ(activated, "id-0");
+    std::vector<std::size_t> page_sizes;
+    auto pages = kmip.locate_pages(
+        "group", object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 3
+    );
+    while (auto page = co_await pages.next()) {
+      page_sizes.push_back(page->size());
+    }
+    EXPECT_EQ(pages.produced(), 5u);
+    co_return page_sizes;
+  }
+
+  Task<std::string> activate(CoroKmipClient &kmip, std::string id) {
+    auto activated = co_await kmip.activate(std::move(id));
+    co_return activated;
+  }
+
+  Task<bool> activate_times_out(CoroKmipClient &kmip) {
+    try {
+      (void) co_await kmip.activate("id-0");
+    } catch (const KmipIOException &) {
+      co_return true;
+    }
+    co_return false;
+  }
+
+}  // namespace
+
+TEST(CoroKmipClientTest, AwaitsOperationsAndPagesPastShortPages) {
+  ObjectStoreServer server;
+  ReactorThread loop;
+  CoroKmipClient kmip(loop.reactor, unix_client(server.path()));
+
+  // The server caps pages at two identifiers; the Located Items count
+  // keeps the generator going.
+  EXPECT_EQ(
+      spawn(activate_and_page(kmip)).get(),
+      (std::vector<std::size_t>{2, 2, 1})
+  );
+  auto located = spawn(kmip.locate_by_group(
+      "group", object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 3
+  ));
+  EXPECT_EQ(located.get().size(), 3u);
+  EXPECT_EQ(server.accepted.load(), 1);
+}
+
+TEST(CoroKmipClientTest, QueuesOperationsBeyondMaxConnections) {
+  ObjectStoreServer server;
+  ReactorThread loop;
+  CoroKmipClient kmip(loop.reactor, unix_client(server.path(), 2));
+
+  std::vector<std::future<std::string>> results;
+  for (int i = 0; i < 16; ++i) {
+    results.push_back(spawn(activate(kmip, "id-" + std::to_string(i % 5))));
+  }
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(results[i].get(), "id-" + std::to_string(i % 5));
+  }
+  EXPECT_LE(server.accepted.load(), 2);
+  EXPECT_EQ(server.requests.load(), 16);
+}
+
+TEST(CoroKmipClientTest, TimesOutAndReconnects) {
+  ReactorThread loop;
+  {
+    ObjectStoreServer silent(true);
+    auto config = unix_client(silent.path(), 1);
+    config.io_timeout = std::chrono::milliseconds(50);
+    CoroKmipClient kmip(loop.reactor, std::move(config));
+
+    EXPECT_TRUE(spawn(activate_times_out(kmip)).get());
+    // The timed-out connection was closed; the next operation opens another.
+    EXPECT_TRUE(spawn(activate_times_out(kmip)).get());
+    EXPECT_EQ(silent.accepted.load(), 2);
+  }
+}
+
+TEST(CoroKmipClientTest, RejectsMissingTransportFactory) {
+  PollReactor reactor;
+  EXPECT_THROW(CoroKmipClient(reactor, {}), kmipcore::KmipException);
+}
@@ -0,0 +1,99 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/CoroPoolBridge.hpp"
+
+#include "FakeNetClient.hpp"
+
+#include <atomic>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kmipclient;
+
+namespace {
+
+  /// Server holding objects "id-0" ... "id-4": Locate pages through them,
+  /// at most two per page, and Activate accepts them.
+  kmipcore::ResponseMessage object_store(const kmipcore::RequestMessage &rq) {
+    const auto &item = rq.getBatchItems().front();
+    if (item.getOperation() == kmipcore::KMIP_OP_LOCATE) {
+      return test::make_response_message(
+          rq, {test::locate_item(item, 5, true, 2)}
+      );
+    }
+    return test::make_response_message(rq, {test::echo_id_item(item)});
+  }
+
+  /// Runs posted work at once, counting the resumptions.
+  class CountingExecutor : public Executor {
+  public:
+    void post(std::function<void()> fn) override {
+      ++posted;
+      fn();
+    }
+
+    std::atomic<int> posted{0};
+  };
+
+  Task<std::vector<std::size_t>> activate_and_page(CoroPoolBridge &kmip) {
+    const auto activated = co_await kmip.activate("id-0");
+    EXPECT_EQ(activated, "id-0");
+    std::vector<std::size_t> page_sizes;
+    auto pages = kmip.locate_pages(
+        "group", object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 3
+    );
+    while (auto page = co_await pages.next()) {
+      page_sizes.push_back(page->size());
+    }
+    EXPECT_EQ(pages.produced(), 5u);
+    co_return page_sizes;
+  }
+
+  Task<bool> activate_missing(CoroPoolBridge &kmip) {
+    try {
+      (void) co_await kmip.activate("missing");
+    } catch (const kmipcore::KmipException &) {
+      co_return true;
+    }
+    co_return false;
+  }
+
+}  // namespace
+
+TEST(CoroPoolBridgeTest, AwaitsOperationsAndLocatePages) {
+  KmipClientPool pool(test::fake_pool(object_store));
+  AsyncKmipClient async(pool);
+  CoroPoolBridge kmip(async);
+
+  EXPECT_EQ(
+      spawn(activate_and_page(kmip)).get(), (std::vector<std::size_t>{2, 2, 1})
+  );
+}
+
+TEST(CoroPoolBridgeTest, ResumesThroughExecutorAndRethrowsErrors) {
+  KmipClientPool pool(test::fake_pool(object_store));
+  AsyncKmipClient async(pool);
+  CountingExecutor executor;
+  CoroPoolBridge kmip(async, &executor);
+
+  EXPECT_TRUE(spawn(activate_missing(kmip)).get());
+  EXPECT_EQ(executor.posted.load(), 1);
+}
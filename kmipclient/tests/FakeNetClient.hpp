@@ -0,0 +1,258 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef KMIPCLIENT_TESTS_FAKE_NET_CLIENT_HPP
+#define KMIPCLIENT_TESTS_FAKE_NET_CLIENT_HPP
+
+#include "kmipclient/KmipClientPool.hpp"
+#include "kmipclient/NetClient.hpp"
+#include "kmipcore/kmip_basics.hpp"
+#include "kmipcore/kmip_protocol.hpp"
+#include "kmipcore/serialization_buffer.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace kmipclient::test {
+
+  /** Serializes a TTLV element tree into wire bytes. */
+  inline std::vector<uint8_t>
+      serialize_element(const std::shared_ptr<kmipcore::Element> &element) {
+    kmipcore::SerializationBuffer buf;
+    element->serialize(buf);
+    return buf.release();
+  }
+
+  /** Builds a successful response batch item echoing @p request_item. */
+  inline kmipcore::ResponseBatchItem make_success_item(
+      const kmipcore::RequestBatchItem &request_item,
+      std::shared_ptr<kmipcore::Element> payload = {}
+  ) {
+    kmipcore::ResponseBatchItem item;
+    item.setOperation(request_item.getOperation());
+    item.setUniqueBatchItemId(request_item.getUniqueBatchItemId());
+    item.setResultStatus(kmipcore::KMIP_STATUS_SUCCESS);
+    if (payload) {
+      item.setResponsePayload(std::move(payload));
+    }
+    return item;
+  }
+
+  /** Wraps response batch items into a complete response message. */
+  inline kmipcore::ResponseMessage make_response_message(
+      const kmipcore::RequestMessage &request,
+      std::vector<kmipcore::ResponseBatchItem> items
+  ) {
+    kmipcore::ResponseMessage response;
+    response.getHeader().setProtocolVersion(
+        request.getHeader().getProtocolVersion()
+    );
+    response.getHeader().setBatchCount(static_cast<int32_t>(items.size()));
+    for (auto &item : items) {
+      response.add_batch_item(item);
+    }
+    return response;
+  }
+
+  /**
+   * In-memory transport for unit tests.
+   *
+   * Bytes preloaded into @ref response_bytes are served to recv() as-is.
+   * When a @ref handler is installed, every complete request message sent
+   * through the transport is decoded and answered with the handler's
+   * response, emulating an in-order KMIP server.
+   */
+  class FakeNetClient : public NetClient {
+  public:
+    using Handler = std::function<kmipcore::ResponseMessage(
+        const kmipcore::RequestMessage &
+    )>;
+
+    FakeNetClient()
+      : NetClient("host", "5696", "client.pem", "client.key", "ca.pem", 1000) {}
+
+    bool connect() override {
+      ++connect_calls;
+      m_isConnected = true;
+      return true;
+    }
+
+    void close() override { m_isConnected = false; }
+
+    bool is_idle_usable() noexcept override {
+      ++idle_probe_calls;
+      return m_isConnected;
+    }
+
+    int send(std::span<const std::uint8_t> data) override {
+      ++send_calls;
+
+      const int desired = send_plan_index < static_cast<int>(send_plan.size())
+                            ? send_plan[send_plan_index++]
+                            : static_cast<int>(data.size());
+      if (desired <= 0) {
+        return desired;
+      }
+
+      const int sent = std::min(desired, static_cast<int>(data.size()));
+      sent_bytes.insert(sent_bytes.end(), data.begin(), data.begin() + sent);
+      if (handler) {
+        answer_complete_requests();
+      }
+      return sent;
+    }
+
+    int recv(std::span<std::uint8_t> data) override {
+      ++recv_calls;
+      if (recv_offset >= response_bytes.size()) {
+        return 0;
+      }
+
+      const size_t count =
+          std::min(data.size(), response_bytes.size() - recv_offset);
+      std::copy_n(response_bytes.data() + recv_offset, count, data.data());
+      recv_offset += count;
+      return static_cast<int>(count);
+    }
+
+    Handler handler;
+    std::vector<int> send_plan;
+    std::vector<uint8_t> response_bytes;
+    std::vector<uint8_t> sent_bytes;
+    std::vector<kmipcore::RequestMessage> received_requests;
+    int send_calls = 0;
+    int recv_calls = 0;
+    int connect_calls = 0;
+    int idle_probe_calls = 0;
+
+  private:
+    void answer_complete_requests() {
+      while (sent_bytes.size() - parsed_offset >= 8) {
+        const auto *len = sent_bytes.data() + parsed_offset + 4;
+        const size_t body = (static_cast<size_t>(len[0]) << 24) |
+                            (static_cast<size_t>(len[1]) << 16) |
+                            (static_cast<size_t>(len[2]) << 8) |
+                            static_cast<size_t>(len[3]);
+        if (sent_bytes.size() - parsed_offset < 8 + body) {
+          return;
+        }
+
+        size_t offset = 0;
+        auto element = kmipcore::Element::deserialize(
+            std::span<const uint8_t>(sent_bytes).subspan(parsed_offset, 8 + body),
+            offset
+        );
+        parsed_offset += 8 + body;
+
+        auto request = kmipcore::RequestMessage::fromElement(element);
+        const auto reply = serialize_element(handler(request).toElement());
+        received_requests.push_back(std::move(request));
+        response_bytes.insert(response_bytes.end(), reply.begin(), reply.end());
+      }
+    }
+
+    int send_plan_index = 0;
+    size_t recv_offset = 0;
+    size_t parsed_offset = 0;
+  };
+
+  /**
+   * Pool configuration whose connections are FakeNetClient transports
+   * answering with @p handler.
+   */
+  inline KmipClientPool::Config fake_pool(
+      FakeNetClient::Handler handler = {}, size_t max_connections = 2
+  ) {
+    return {
+        .max_connections = max_connections,
+        .transport_factory =
+            [handler](const KmipClientPool::Config &) {
+              auto nc = std::make_unique<FakeNetClient>();
+              nc->handler = handler;
+              return nc;
+            },
+    };
+  }
+
+  /**
+   * Answers a request naming an object by Unique Identifier with that
+   * identifier, or with Item Not Found when it is "missing".
+   */
+  inline kmipcore::ResponseBatchItem
+      echo_id_item(const kmipcore::RequestBatchItem &item) {
+    using kmipcore::Element;
+    const auto id = item.getRequestPayload()
+                        ->getChild(kmipcore::tag::KMIP_TAG_UNIQUE_IDENTIFIER)
+                        ->toString();
+    if (id == "missing") {
+      auto failed = make_success_item(item);
+      failed.setResultStatus(kmipcore::KMIP_STATUS_OPERATION_FAILED);
+      failed.setResultReason(kmipcore::KMIP_REASON_ITEM_NOT_FOUND);
+      return failed;
+    }
+    auto payload =
+        Element::createStructure(kmipcore::tag::KMIP_TAG_RESPONSE_PAYLOAD);
+    payload->asStructure()->add(
+        Element::createTextString(kmipcore::tag::KMIP_TAG_UNIQUE_IDENTIFIER, id)
+    );
+    return make_success_item(item, payload);
+  }
+
+  /**
+   * Answers a Locate over @p count objects "id-0", "id-1", ... with the page
+   * selected by Offset Items and Maximum Items, cut to @p max_page items
+   * when positive, reporting Located Items if @p report_count.
+   */
+  inline kmipcore::ResponseBatchItem locate_item(
+      const kmipcore::RequestBatchItem &item,
+      int count,
+      bool report_count = true,
+      int max_page = 0
+  ) {
+    using kmipcore::Element;
+    const auto &request = item.getRequestPayload();
+    const auto offset = request->getChild(kmipcore::tag::KMIP_TAG_OFFSET_ITEMS);
+    const int first = offset ? offset->toInt() : 0;
+    int page =
+        request->getChild(kmipcore::tag::KMIP_TAG_MAXIMUM_ITEMS)->toInt();
+    if (max_page > 0) {
+      page = std::min(page, max_page);
+    }
+    const int last = std::min(count, first + page);
+    auto payload =
+        Element::createStructure(kmipcore::tag::KMIP_TAG_RESPONSE_PAYLOAD);
+    if (report_count) {
+      payload->asStructure()->add(
+          Element::createInteger(kmipcore::tag::KMIP_TAG_LOCATED_ITEMS, count)
+      );
+    }
+    for (int i = first; i < last; ++i) {
+      payload->asStructure()->add(Element::createTextString(
+          kmipcore::tag::KMIP_TAG_UNIQUE_IDENTIFIER, "id-" + std::to_string(i)
+      ));
+    }
+    return make_success_item(item, payload);
+  }
+
+}  // namespace kmipclient::test
+
+#endif  // KMIPCLIENT_TESTS_FAKE_NET_CLIENT_HPP
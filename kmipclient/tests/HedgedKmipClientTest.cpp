@@ -0,0 +1,164 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/HedgedKmipClient.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipcore/kmip_basics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+using namespace kmipclient;
+using kmipcore::Element;
+using kmipcore::tag;
+
+namespace {
+
+  /// Two-node cluster of fake servers answering Activate with "reply-<n>",
+  /// n counting requests over both nodes.  The first @p slow requests take
+  /// @p delay.
+  KmipClusterPool::Config
+      fake_cluster(int slow, std::chrono::milliseconds delay) {
+    auto requests = std::make_shared<std::atomic<int>>(0);
+    KmipClusterPool::Config config;
+    config.endpoints = {{"node-1", "5696"}, {"node-2", "5696"}};
+    config.node.max_connections = 2;
+    config.node.transport_factory = [=](const KmipClientPool::Config &) {
+      auto nc = std::make_unique<test::FakeNetClient>();
+      nc->handler = [=](const kmipcore::RequestMessage &rq) {
+        const int n = ++*requests;
+        if (n <= slow) {
+          std::this_thread::sleep_for(delay);
+        }
+        auto payload =
+            Element::createStructure(tag::KMIP_TAG_RESPONSE_PAYLOAD);
+        payload->asStructure()->add(Element::createTextString(
+            tag::KMIP_TAG_UNIQUE_IDENTIFIER, "reply-" + std::to_string(n)
+        ));
+        return test::make_response_message(
+            rq, {test::make_success_item(rq.getBatchItems().front(), payload)}
+        );
+      };
+      return nc;
+    };
+    return config;
+  }
+
+  std::string activate(KmipClient &client) {
+    return client.op_activate("key");
+  }
+
+}  // namespace
+
+TEST(HedgedKmipClientTest, SlowFirstAttemptLosesToHedge) {
+  KmipClusterPool cluster(fake_cluster(1, std::chrono::milliseconds(500)));
+  HedgedKmipClient hedged(
+      cluster, {.initial_delay = std::chrono::milliseconds(20)}
+  );
+
+  const auto started = std::chrono::steady_clock::now();
+  EXPECT_EQ(hedged.execute(activate), "reply-2");
+  EXPECT_LT(
+      std::chrono::steady_clock::now() - started,
+      std::chrono::milliseconds(400)
+  );
+  EXPECT_EQ(hedged.hedges_sent(), 1u);
+  EXPECT_EQ(hedged.hedge_wins(), 1u);
+}
+
+TEST(HedgedKmipClientTest, HedgeAvoidsNodeFirstAttemptWaitsFor) {
+  // One connection per node; node-2 answers with its name after 30 ms,
+  // node-1 at once.
+  KmipClusterPool::Config config;
+  config.endpoints = {{"node-1", "5696"}, {"node-2", "5696"}};
+  config.node.max_connections = 1;
+  config.node.transport_factory = [](const KmipClientPool::Config &node) {
+    auto nc = std::make_unique<test::FakeNetClient>();
+    nc->handler = [host = node.host](const kmipcore::RequestMessage &rq) {
+      if (host == "node-2") {
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+      }
+      auto payload = Element::createStructure(tag::KMIP_TAG_RESPONSE_PAYLOAD);
+      payload->asStructure()->add(
+          Element::createTextString(tag::KMIP_TAG_UNIQUE_IDENTIFIER, host)
+      );
+      return test::make_response_message(
+          rq, {test::make_success_item(rq.getBatchItems().front(), payload)}
+      );
+    };
+    return nc;
+  };
+  KmipClusterPool cluster(config);
+  // Measure both nodes, node-1 being by far the faster.
+  EXPECT_EQ(cluster.execute(activate), "node-1");
+  EXPECT_EQ(cluster.execute(activate), "node-2");
+
+  // Holding node-1's only connection blocks the first attempt in borrow,
+  // though node-1 still scores best.  The hedge must go to node-2.
+  std::optional<KmipClusterPool::BorrowedClient> held = cluster.borrow();
+  ASSERT_EQ(held->node_index(), 0u);
+  std::thread releaser([&held] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    held.reset();
+  });
+
+  {
+    HedgedKmipClient hedged(
+        cluster,
+        {.initial_delay = std::chrono::milliseconds(20), .max_hedge_ratio = 1}
+    );
+    const auto started = std::chrono::steady_clock::now();
+    EXPECT_EQ(hedged.execute(activate), "node-2");
+    EXPECT_LT(
+        std::chrono::steady_clock::now() - started,
+        std::chrono::milliseconds(300)
+    );
+    EXPECT_EQ(hedged.hedge_wins(), 1u);
+  }
+  releaser.join();
+}
+
+TEST(HedgedKmipClientTest, DelayFollowsCachedPercentile) {
+  KmipClusterPool cluster(fake_cluster(0, std::chrono::milliseconds(0)));
+  HedgedKmipClient hedged(
+      cluster,
+      {.initial_delay = std::chrono::milliseconds(200),
+       .min_samples = 4,
+       .refresh_samples = 8}
+  );
+  EXPECT_EQ(hedged.hedge_delay(), std::chrono::milliseconds(200));
+
+  for (int i = 0; i < 3; ++i) {
+    (void) hedged.execute(activate);
+  }
+  EXPECT_EQ(hedged.hedge_delay(), std::chrono::milliseconds(200));
+
+  // The fourth sample makes the percentile trusted.
+  (void) hedged.execute(activate);
+  EXPECT_LT(hedged.hedge_delay(), std::chrono::milliseconds(200));
+  EXPECT_EQ(hedged.hedges_sent(), 0u);
+
+  HedgedKmipClient::Config invalid;
+  invalid.refresh_samples = 0;
+  EXPECT_THROW(HedgedKmipClient(cluster, invalid), kmipcore::KmipException);
+}
@@ -16,6 +16,8 @@
  */
 
 #include "../src/IOUtils.hpp"
+#include "../src/MessageFramer.hpp"
+#include "FakeNetClient.hpp"
 
 #include "kmipclient/Kmip.hpp"
 #include "kmipclient/KmipIOException.hpp"
@@ -28,6 +30,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <optional>
 #include <span>
 #include <string>
 #include <type_traits>
@@ -48,54 +51,8 @@ namespace {
     std::vector<kmipcore::LogRecord> records;
   };
 
-  class FakeNetClient final : public kmipclient::NetClient {
-  public:
-    FakeNetClient()
-      : NetClient("host", "5696", "client.pem", "client.key", "ca.pem", 1000) {}
-
-    bool connect() override {
-      m_isConnected = true;
-      return true;
-    }
-
-    void close() override { m_isConnected = false; }
-
-    int send(std::span<const std::uint8_t> data) override {
-      ++send_calls;
-
-      const int desired = send_plan_index < static_cast<int>(send_plan.size())
-                            ? send_plan[send_plan_index++]
-                            : static_cast<int>(data.size());
-      if (desired <= 0) {
-        return desired;
-      }
-
-      const int sent = std::min(desired, static_cast<int>(data.size()));
-      sent_bytes.insert(sent_bytes.end(), data.begin(), data.begin() + sent);
-      return sent;
-    }
-
-    int recv(std::span<std::uint8_t> data) override {
-      if (recv_offset >= response_bytes.size()) {
-        return 0;
-      }
-
-      const size_t count =
-          std::min(data.size(), response_bytes.size() - recv_offset);
-      std::copy_n(response_bytes.data() + recv_offset, count, data.data());
-      recv_offset += count;
-      return static_cast<int>(count);
-    }
-
-    std::vector<int> send_plan;
-    std::vector<uint8_t> response_bytes;
-    std::vector<uint8_t> sent_bytes;
-    int send_calls = 0;
-
-  private:
-    int send_plan_index = 0;
-    size_t recv_offset = 0;
-  };
+  using kmipclient::test::FakeNetClient;
+  using kmipclient::test::serialize_element;
 
   std::vector<uint8_t>
       build_response_with_payload(const std::vector<uint8_t> &payload) {
@@ -114,13 +71,6 @@ namespace {
     return out;
   }
 
-  std::vector<uint8_t>
-      serialize_element(const std::shared_ptr<kmipcore::Element> &element) {
-    kmipcore::SerializationBuffer buf;
-    element->serialize(buf);
-    return buf.release();
-  }
-
 }  // namespace
 
 static_assert(
@@ -169,6 +119,32 @@ TEST(IOUtilsTest, SendFailsIfTransportStopsProgress) {
   );
 }
 
+TEST(IOUtilsTest, FailureReportsWhetherRequestBytesWereSent) {
+  const std::vector<uint8_t> request{0, 1, 2, 3};
+  std::vector<uint8_t> response;
+  const auto bytes_sent = [&](FakeNetClient &nc) {
+    kmipclient::IOUtils io(nc);
+    try {
+      io.do_exchange(request, response, 1024);
+    } catch (const kmipclient::KmipIOException &e) {
+      return e.bytes_sent();
+    }
+    ADD_FAILURE() << "exchange did not fail";
+    return false;
+  };
+
+  FakeNetClient refused;
+  refused.send_plan = {0};
+  EXPECT_FALSE(bytes_sent(refused));
+
+  FakeNetClient partial;
+  partial.send_plan = {2, 0};
+  EXPECT_TRUE(bytes_sent(partial));
+
+  FakeNetClient no_response;  // request sent, connection closed
+  EXPECT_TRUE(bytes_sent(no_response));
+}
+
 TEST(IOUtilsTest, AcceptsResponsesLargerThanLegacy64KiBLimit) {
   FakeNetClient nc;
   const std::size_t payload_size = 128 * 1024;
@@ -186,6 +162,24 @@ TEST(IOUtilsTest, AcceptsResponsesLargerThanLegacy64KiBLimit) {
   EXPECT_EQ(response, nc.response_bytes);
 }
 
+TEST(IOUtilsTest, FramerShrinksAfterLargeMessage) {
+  const auto large =
+      build_response_with_payload(std::vector<uint8_t>(128 * 1024, 0xAB));
+  kmipclient::MessageFramer framer(1024);
+
+  std::size_t fed = 0;
+  std::optional<std::vector<uint8_t>> message;
+  while (!(message = framer.next_message(kmipcore::KMIP_MAX_MESSAGE_SIZE))) {
+    const auto window = framer.write_window();
+    const auto n = std::min(window.size(), large.size() - fed);
+    std::copy_n(large.data() + fed, n, window.data());
+    framer.commit(n);
+    fed += n;
+  }
+  EXPECT_EQ(*message, large);
+  EXPECT_EQ(framer.capacity(), 1024u);
+}
+
 TEST(IOUtilsTest, RejectsResponseThatExceedsCallerLimit) {
   FakeNetClient nc;
   nc.response_bytes =
@@ -232,6 +226,58 @@ TEST(IOUtilsTest, RejectsResponseThatExceedsHardLimitEvenIfCallerLimitIsHigher)
   }
 }
 
+TEST(IOUtilsTest, SmallResponseIsReadWithSingleRecvCall) {
+  FakeNetClient nc;
+  nc.response_bytes =
+      build_response_with_payload(std::vector<uint8_t>(200, 0x5A));
+
+  kmipclient::IOUtils io(nc);
+  const std::vector<uint8_t> request{0x01};
+  std::vector<uint8_t> response;
+
+  ASSERT_NO_THROW(io.do_exchange(request, response, 1024));
+  EXPECT_EQ(response, nc.response_bytes);
+  EXPECT_EQ(nc.recv_calls, 1);
+}
+
+TEST(IOUtilsTest, ReadAheadBytesAreServedToTheNextExchange) {
+  FakeNetClient nc;
+  nc.connect();
+  const auto first = build_response_with_payload({0x01, 0x02, 0x03});
+  const auto second = build_response_with_payload({0x04, 0x05});
+  nc.response_bytes = first;
+  nc.response_bytes.insert(
+      nc.response_bytes.end(), second.begin(), second.end()
+  );
+
+  kmipclient::IOUtils io(nc);
+  const std::vector<uint8_t> request{0x01};
+  std::vector<uint8_t> response;
+
+  ASSERT_NO_THROW(io.do_exchange(request, response, 1024));
+  EXPECT_EQ(response, first);
+  ASSERT_NO_THROW(io.do_exchange(request, response, 1024));
+  EXPECT_EQ(response, second);
+  EXPECT_EQ(nc.recv_calls, 1);
+}
+
+TEST(IOUtilsTest, TruncatedResponseFailsAndClosesTransport) {
+  FakeNetClient nc;
+  nc.connect();
+  auto bytes = build_response_with_payload(std::vector<uint8_t>(64, 0x33));
+  bytes.resize(bytes.size() - 10);
+  nc.response_bytes = bytes;
+
+  kmipclient::IOUtils io(nc);
+  const std::vector<uint8_t> request{0x01};
+  std::vector<uint8_t> response;
+
+  EXPECT_THROW(
+      io.do_exchange(request, response, 1024), kmipclient::KmipIOException
+  );
+  EXPECT_FALSE(nc.is_connected());
+}
+
 TEST(IOUtilsTest, DebugLoggingRedactsSensitiveTtlvFields) {
   FakeNetClient nc;
 
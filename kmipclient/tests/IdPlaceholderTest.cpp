@@ -0,0 +1,271 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "FakeNetClient.hpp"
+#include "kmipclient/KmipClient.hpp"
+#include "kmipclient/SymmetricKey.hpp"
+#include "kmipcore/kmip_basics.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace kmipclient;
+using kmipcore::Element;
+using kmipcore::tag;
+
+namespace {
+
+  /// Key server processing batches in order.  Operations without a Unique
+  /// Identifier use the ID Placeholder only if @c resolve_placeholder.  Each
+  /// Fresh group member is handed out once.  The first @c reject_attributes
+  /// Get Attributes requests fail as if their encoding were not understood.
+  class KeyServer : public test::FakeNetClient {
+  public:
+    explicit KeyServer(bool resolve_placeholder)
+      : resolve_placeholder_(resolve_placeholder) {
+      handler = [this](const kmipcore::RequestMessage &request) {
+        placeholder_.clear();
+        std::vector<kmipcore::ResponseBatchItem> items;
+        for (const auto &item : request.getBatchItems()) {
+          items.push_back(answer(item));
+        }
+        return test::make_response_message(request, std::move(items));
+      };
+      connect();
+    }
+
+    int created = 0;
+    int reject_attributes = 0;
+    int fresh_handed_out = 0;
+    std::vector<std::string> activated;
+
+  private:
+    kmipcore::ResponseBatchItem answer(const kmipcore::RequestBatchItem &item) {
+      const auto &request = item.getRequestPayload();
+      auto payload = Element::createStructure(tag::KMIP_TAG_RESPONSE_PAYLOAD);
+      const auto add = [&payload](std::shared_ptr<Element> element) {
+        payload->asStructure()->add(std::move(element));
+      };
+
+      if (item.getOperation() == kmipcore::KMIP_OP_CREATE ||
+          item.getOperation() == kmipcore::KMIP_OP_REGISTER) {
+        placeholder_ = "key-" + std::to_string(++created);
+        add(Element::createTextString(
+            tag::KMIP_TAG_UNIQUE_IDENTIFIER, placeholder_
+        ));
+        return test::make_success_item(item, payload);
+      }
+      if (item.getOperation() == kmipcore::KMIP_OP_LOCATE) {
+        const auto member =
+            request->getChild(tag::KMIP_TAG_OBJECT_GROUP_MEMBER);
+        if (member &&
+            member->toEnum() ==
+                static_cast<int32_t>(
+                    object_group_member::KMIP_GROUP_MEMBER_FRESH
+                )) {
+          placeholder_ = "fresh-" + std::to_string(++fresh_handed_out);
+          add(Element::createTextString(
+              tag::KMIP_TAG_UNIQUE_IDENTIFIER, placeholder_
+          ));
+        } else if (member) {
+          placeholder_ = "key-2";
+          add(Element::createTextString(
+              tag::KMIP_TAG_UNIQUE_IDENTIFIER, placeholder_
+          ));
+        }
+        return test::make_success_item(item, payload);
+      }
+
+      std::string id = resolve_placeholder_ ? placeholder_ : "";
+      if (const auto uid = request->getChild(tag::KMIP_TAG_UNIQUE_IDENTIFIER)) {
+        id = uid->toString();
+      }
+      if (id.empty()) {
+        auto failed = test::make_success_item(item);
+        failed.setResultStatus(kmipcore::KMIP_STATUS_OPERATION_FAILED);
+        failed.setResultReason(kmipcore::KMIP_REASON_ITEM_NOT_FOUND);
+        return failed;
+      }
+      if (item.getOperation() == kmipcore::KMIP_OP_GET_ATTRIBUTES &&
+          reject_attributes > 0) {
+        --reject_attributes;
+        auto failed = test::make_success_item(item);
+        failed.setResultStatus(kmipcore::KMIP_STATUS_OPERATION_FAILED);
+        failed.setResultReason(kmipcore::KMIP_REASON_INVALID_FIELD);
+        return failed;
+      }
+      add(Element::createTextString(tag::KMIP_TAG_UNIQUE_IDENTIFIER, id));
+      if (item.getOperation() == kmipcore::KMIP_OP_GET) {
+        add(Element::createEnumeration(
+            tag::KMIP_TAG_OBJECT_TYPE, kmipcore::KMIP_OBJTYPE_SYMMETRIC_KEY
+        ));
+        auto key_block = Element::createStructure(tag::KMIP_TAG_KEY_BLOCK);
+        key_block->asStructure()->add(Element::createEnumeration(
+            tag::KMIP_TAG_KEY_FORMAT_TYPE, kmipcore::KMIP_KEYFORMAT_RAW
+        ));
+        auto key_value = Element::createStructure(tag::KMIP_TAG_KEY_VALUE);
+        key_value->asStructure()->add(Element::createByteString(
+            tag::KMIP_TAG_KEY_MATERIAL, std::vector<uint8_t>(32, 0x2A)
+        ));
+        key_block->asStructure()->add(key_value);
+        auto key = Element::createStructure(tag::KMIP_TAG_SYMMETRIC_KEY);
+        key->asStructure()->add(key_block);
+        add(key);
+      } else if (item.getOperation() == kmipcore::KMIP_OP_ACTIVATE) {
+        activated.push_back(id);
+      } else {
+        auto state = Element::createStructure(tag::KMIP_TAG_ATTRIBUTE);
+        state->asStructure()->add(
+            Element::createTextString(tag::KMIP_TAG_ATTRIBUTE_NAME, "State")
+        );
+        state->asStructure()->add(Element::createEnumeration(
+            tag::KMIP_TAG_ATTRIBUTE_VALUE, kmipcore::KMIP_STATE_ACTIVE
+        ));
+        add(state);
+      }
+      return test::make_success_item(item, payload);
+    }
+
+    bool resolve_placeholder_;
+    std::string placeholder_;
+  };
+
+}  // namespace
+
+TEST(IdPlaceholderTest, OnlyThePlaceholderOmitsTheIdentifier) {
+  const auto uid = [](const kmipcore::RequestBatchItem &item) {
+    return item.getRequestPayload()->getChild(tag::KMIP_TAG_UNIQUE_IDENTIFIER);
+  };
+
+  EXPECT_EQ(uid(kmipcore::GetRequest(kmipcore::ID_PLACEHOLDER)), nullptr);
+  EXPECT_EQ(
+      uid(kmipcore::GetAttributesRequest(kmipcore::ID_PLACEHOLDER, {"State"})),
+      nullptr
+  );
+
+  // An empty identifier is still sent, for the server to reject.
+  const auto empty = uid(kmipcore::ActivateRequest(std::string()));
+  ASSERT_NE(empty, nullptr);
+  EXPECT_EQ(empty->toString(), "");
+  ASSERT_NE(uid(kmipcore::GetAttributesRequest("", {"State"})), nullptr);
+}
+
+TEST(IdPlaceholderTest, LatestInGroupTakesOneRoundTrip) {
+  KeyServer server(true);
+  KmipClient client(server);
+  client.set_server_profile(std::make_shared<ServerProfile>());
+
+  const auto key = client.op_get_latest_in_group("g");
+  ASSERT_NE(key, nullptr);
+  EXPECT_EQ(key->value().size(), 32u);
+  ASSERT_EQ(server.received_requests.size(), 1u);
+  const auto &request = server.received_requests.front();
+  EXPECT_EQ(request.getBatchItemCount(), 3u);
+  EXPECT_EQ(request.getHeader().getBatchOrderOption(), true);
+  EXPECT_TRUE(client.server_profile()->id_placeholders());
+}
+
+TEST(IdPlaceholderTest, LatestInGroupFallsBackWithoutPlaceholders) {
+  KeyServer server(false);
+  KmipClient client(server);
+  auto profile = std::make_shared<ServerProfile>();
+  client.set_server_profile(profile);
+
+  ASSERT_NE(client.op_get_latest_in_group("g"), nullptr);
+  EXPECT_EQ(server.received_requests.size(), 2u);
+  EXPECT_FALSE(profile->id_placeholders());
+
+  // Later lookups skip the chained batch: Locate, then Get.
+  ASSERT_NE(client.op_get_latest_in_group("g"), nullptr);
+  EXPECT_EQ(server.received_requests.size(), 4u);
+  EXPECT_EQ(server.received_requests[2].getBatchItemCount(), 1u);
+}
+
+TEST(IdPlaceholderTest, LatestInGroupLocatesFreshMemberOnce) {
+  KeyServer server(true);
+  KmipClient client(server, {}, kmipcore::KMIP_VERSION_2_0);
+  auto profile = std::make_shared<ServerProfile>();
+  client.set_server_profile(profile);
+  server.reject_attributes = 1;
+
+  const auto key = client.op_get_latest_in_group(
+      "g",
+      object_type::KMIP_OBJTYPE_SYMMETRIC_KEY,
+      object_group_member::KMIP_GROUP_MEMBER_FRESH
+  );
+  ASSERT_NE(key, nullptr);
+  EXPECT_EQ(server.fresh_handed_out, 1);
+
+  // The encoding fallback reads the located key by its identifier.
+  ASSERT_EQ(server.received_requests.size(), 2u);
+  const auto &retry = server.received_requests[1].getBatchItems();
+  ASSERT_EQ(retry.front().getOperation(), kmipcore::KMIP_OP_GET);
+  EXPECT_EQ(
+      retry.front()
+          .getRequestPayload()
+          ->getChild(tag::KMIP_TAG_UNIQUE_IDENTIFIER)
+          ->toString(),
+      "fresh-1"
+  );
+  EXPECT_TRUE(profile->id_placeholders());
+
+  // Resending a Fresh Locate could skip a member.
+  EXPECT_FALSE(RetryPolicy::is_idempotent(server.received_requests[0]));
+}
+
+TEST(IdPlaceholderTest, CreateAndActivateShareOneMessage) {
+  KeyServer server(true);
+  KmipClient client(server);
+
+  EXPECT_EQ(client.op_create_and_activate("k", "g"), "key-1");
+  ASSERT_EQ(server.received_requests.size(), 1u);
+  const auto &items = server.received_requests.front().getBatchItems();
+  ASSERT_EQ(items.size(), 2u);
+  EXPECT_EQ(items[1].getOperation(), kmipcore::KMIP_OP_ACTIVATE);
+  EXPECT_EQ(server.activated, std::vector<std::string>{"key-1"});
+
+  // A chained item must not name its object.
+  auto request = client.make_request_message();
+  EXPECT_THROW(
+      request.add_chained_batch_item(kmipcore::ActivateRequest(
+          kmipcore::ID_PLACEHOLDER
+      )),
+      kmipcore::KmipException
+  );
+  request.add_batch_item(kmipcore::GetRequest("id"));
+  EXPECT_THROW(
+      request.add_chained_batch_item(kmipcore::ActivateRequest("id")),
+      kmipcore::KmipException
+  );
+}
+
+TEST(IdPlaceholderTest, RegisterAndActivateFallsBackToSecondRoundTrip) {
+  KeyServer server(false);
+  KmipClient client(server);
+  auto profile = std::make_shared<ServerProfile>();
+  client.set_server_profile(profile);
+  const auto key =
+      SymmetricKey::aes_from_value(std::vector<unsigned char>(32, 0x11));
+
+  EXPECT_EQ(client.op_register_and_activate("k", "g", key), "key-1");
+  EXPECT_EQ(server.received_requests.size(), 2u);
+  EXPECT_FALSE(profile->id_placeholders());
+
+  EXPECT_EQ(client.op_register_and_activate("k", "g", key), "key-2");
+  EXPECT_EQ(server.received_requests.size(), 4u);
+  EXPECT_EQ(server.received_requests[2].getBatchItemCount(), 1u);
+  EXPECT_EQ(server.activated, (std::vector<std::string>{"key-1", "key-2"}));
+}
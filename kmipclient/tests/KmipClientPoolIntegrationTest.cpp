@@ -22,6 +22,10 @@
  * operations and proper connection pooling behavior.
  */
 
+#include "kmipclient/AsyncKmipClient.hpp"
+#include "kmipclient/CoalescingDispatcher.hpp"
+#include "kmipclient/CoroPoolBridge.hpp"
+#include "kmipclient/HedgedKmipClient.hpp"
 #include "kmipclient/Kmip.hpp"
 #include "kmipclient/KmipClient.hpp"
 #include "kmipclient/KmipClientPool.hpp"
@@ -33,6 +37,7 @@
 #include <chrono>
 #include <climits>
 #include <cstdlib>
+#include <future>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <sstream>
@@ -517,3 +522,136 @@ TEST_F(KmipClientPoolIntegrationTest, PoolStatistics) {
   EXPECT_EQ(pool.available_count(), 1);
   EXPECT_EQ(pool.total_count(), 1);
 }
+
+// ============================================================================
+// AsyncKmipClient over the pool
+// ============================================================================
+
+TEST_F(KmipClientPoolIntegrationTest, AsyncCreateAndGetWithFutures) {
+  auto pool = KmipClientPool(createPoolConfig(3));
+  AsyncKmipClient async(pool);
+
+  const int num_keys = 6;
+  std::vector<std::future<std::string>> created;
+  for (int i = 0; i < num_keys; ++i) {
+    created.push_back(async.create_aes_key_async(
+        POOL_TEST_NAME_PREFIX + "async_" + std::to_string(i), TEST_GROUP
+    ));
+  }
+
+  std::vector<std::future<std::unique_ptr<Key>>> fetched;
+  for (auto &f : created) {
+    const auto key_id = f.get();
+    trackKeyForCleanup(key_id);
+    fetched.push_back(async.get_key_async(key_id));
+  }
+  for (auto &f : fetched) {
+    EXPECT_EQ(f.get()->value().size(), 32);
+  }
+  EXPECT_LE(pool.total_count(), 3u);
+}
+
+TEST_F(KmipClientPoolIntegrationTest, AsyncCallbackReportsServerError) {
+  auto pool = KmipClientPool(createPoolConfig(2));
+  AsyncKmipClient async(pool);
+
+  std::promise<bool> reported;
+  async.get_key_async(
+      "non-existent-key-id", false, [&reported](auto result) {
+        try {
+          (void) result.get();
+          reported.set_value(false);
+        } catch (const kmipcore::KmipException &) {
+          reported.set_value(true);
+        }
+      }
+  );
+  EXPECT_TRUE(reported.get_future().get());
+}
+
+TEST_F(KmipClientPoolIntegrationTest, CoroutineCreateActivateAndLocatePages) {
+  auto pool = KmipClientPool(createPoolConfig(2));
+  AsyncKmipClient async(pool);
+  CoroPoolBridge kmip(async);
+
+  auto workflow = [this, &kmip]() -> Task<std::size_t> {
+    const auto key_id = co_await kmip.create_aes_key(
+        POOL_TEST_NAME_PREFIX + "coro", TEST_GROUP
+    );
+    trackKeyForCleanup(key_id);
+    EXPECT_EQ(co_await kmip.activate(key_id), key_id);
+
+    auto pages = kmip.locate_pages(
+        TEST_GROUP, object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 2
+    );
+    bool found = false;
+    while (auto page = co_await pages.next()) {
+      EXPECT_LE(page->size(), 2u);
+      found = found ||
+              std::find(page->begin(), page->end(), key_id) != page->end();
+    }
+    EXPECT_TRUE(found);
+    co_return pages.produced();
+  };
+
+  EXPECT_GE(spawn(workflow()).get(), 1u);
+}
+
+TEST_F(KmipClientPoolIntegrationTest, CoalescedConcurrentGetKey) {
+  auto pool = KmipClientPool(createPoolConfig(2));
+  CoalescingDispatcher dispatcher(
+      pool, {.window = std::chrono::milliseconds(20), .workers = 1}
+  );
+
+  constexpr int num_keys = 6;
+  std::vector<std::string> key_ids;
+  {
+    auto conn = pool.borrow();
+    for (int i = 0; i < num_keys; ++i) {
+      key_ids.push_back(conn->op_create_aes_key(
+          POOL_TEST_NAME_PREFIX + "coalesce_" + std::to_string(i), TEST_GROUP
+      ));
+      trackKeyForCleanup(key_ids.back());
+    }
+  }
+
+  std::vector<std::future<std::unique_ptr<Key>>> keys;
+  for (const auto &id : key_ids) {
+    keys.push_back(dispatcher.get_key(id));
+  }
+  auto missing = dispatcher.get_key("non-existent-coalesced-key-id");
+
+  for (auto &key : keys) {
+    EXPECT_EQ(key.get()->value().size(), 32u);
+  }
+  EXPECT_THROW(missing.get(), kmipcore::KmipException);
+  EXPECT_LT(dispatcher.messages_sent(), static_cast<uint64_t>(num_keys));
+  EXPECT_EQ(dispatcher.operations_completed(), num_keys + 1u);
+}
+
+TEST_F(KmipClientPoolIntegrationTest, HedgedGetKeyOnSingleNodeCluster) {
+  const auto node = createPoolConfig(2);
+  KmipClusterPool cluster({
+      .endpoints = {{node.host, node.port}},
+      .node = node,
+  });
+  // A zero percentile hedges as soon as a single sample exists.
+  HedgedKmipClient hedged(
+      cluster,
+      {.percentile = 0.0,
+       .min_samples = 1,
+       .max_hedge_ratio = 1.0}
+  );
+
+  const auto key_id = cluster.execute([](KmipClient &c) {
+    return c.op_create_aes_key(POOL_TEST_NAME_PREFIX + "hedged", TEST_GROUP);
+  });
+  trackKeyForCleanup(key_id);
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(hedged.get_key(key_id)->value().size(), 32u);
+  }
+  EXPECT_EQ(hedged.requests(), 5u);
+  EXPECT_GE(hedged.latencies().size(), 5u);
+  EXPECT_GT(hedged.hedge_delay().count(), 0);
+}
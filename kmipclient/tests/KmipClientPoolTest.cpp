@@ -0,0 +1,547 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/KmipClientPool.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipcore/kmip_errors.hpp"
+#include "kmipcore/kmip_requests.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace kmipclient;
+
+namespace {
+
+  KmipClientPool::Config fake_config(size_t max_connections, size_t shards) {
+    auto config = test::fake_pool({}, max_connections);
+    config.shards = shards;
+    return config;
+  }
+
+  /// Fake transport whose connect() fails while @c down is set.
+  class FlakyNetClient : public test::FakeNetClient {
+  public:
+    FlakyNetClient(
+        std::shared_ptr<std::atomic<bool>> down,
+        std::shared_ptr<std::atomic<int>> attempts
+    )
+      : down_(std::move(down)), attempts_(std::move(attempts)) {}
+
+    bool connect() override {
+      attempts_->fetch_add(1);
+      if (down_->load()) {
+        throw KmipIOException(kmipcore::KMIP_IO_FAILURE, "refused");
+      }
+      return FakeNetClient::connect();
+    }
+
+  private:
+    std::shared_ptr<std::atomic<bool>> down_;
+    std::shared_ptr<std::atomic<int>> attempts_;
+  };
+
+  /// Pool of four fake servers answering Locate over @p count objects as
+  /// test::locate_item() does; each page takes 2 ms so that fetches
+  /// overlap.
+  KmipClientPool::Config
+      locate_pool(int count, bool report_count, int max_page = 0) {
+    auto config = test::fake_pool(
+        [=](const kmipcore::RequestMessage &rq) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          return test::make_response_message(
+              rq,
+              {test::locate_item(
+                  rq.getBatchItems().front(), count, report_count, max_page
+              )}
+          );
+        },
+        4
+    );
+    config.shards = 1;
+    return config;
+  }
+
+}  // namespace
+
+TEST(KmipClientPoolTest, ConcurrentBorrowsStayWithinLimit) {
+  KmipClientPool pool(fake_config(4, 3));
+  EXPECT_EQ(pool.shard_count(), 3u);
+
+  std::atomic<size_t> in_use{0};
+  std::atomic<size_t> peak{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 16; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 500; ++i) {
+        auto conn = pool.borrow();
+        const size_t now = in_use.fetch_add(1) + 1;
+        size_t seen = peak.load();
+        while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+        }
+        in_use.fetch_sub(1);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_LE(peak.load(), 4u);
+  EXPECT_LE(pool.total_count(), 4u);
+  EXPECT_EQ(pool.available_count(), pool.total_count());
+}
+
+TEST(KmipClientPoolTest, ExhaustedPoolTimesOutAndWakesOnReturn) {
+  KmipClientPool pool(fake_config(2, 2));
+  auto first = pool.borrow();
+  auto second = pool.borrow();
+
+  EXPECT_FALSE(pool.try_borrow().has_value());
+  EXPECT_THROW(
+      (void) pool.borrow(std::chrono::milliseconds(20)),
+      kmipcore::KmipException
+  );
+
+  // A parked borrower is woken by a return to another thread's shard.
+  std::thread returner([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto released = std::move(first);
+  });
+  auto third = pool.borrow(std::chrono::seconds(5));
+  returner.join();
+  EXPECT_EQ(pool.total_count(), 2u);
+}
+
+TEST(KmipClientPoolTest, WarmUpAndReplenishKeepMinimumOpen) {
+  auto config = fake_config(4, 2);
+  config.min_connections = 3;
+  KmipClientPool pool(config);
+
+  pool.warm_up();
+  EXPECT_GE(pool.total_count(), 3u);
+  EXPECT_EQ(pool.warm_up(), 0u);
+
+  // A discarded connection is re-opened in the background.
+  {
+    auto conn = pool.borrow();
+    conn.markUnhealthy();
+  }
+  for (int i = 0; i < 100 && pool.available_count() < 3; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(pool.total_count(), 3u);
+  EXPECT_EQ(pool.available_count(), 3u);
+}
+
+TEST(KmipClientPoolTest, MetricsCountBorrowsExchangesAndDiscards) {
+  auto config = fake_config(1, 1);
+  config.transport_factory = [](const KmipClientPool::Config &) {
+    auto transport = std::make_unique<test::FakeNetClient>();
+    transport->handler = [](const kmipcore::RequestMessage &request) {
+      return test::make_response_message(
+          request, {test::make_success_item(request.getBatchItems().front())}
+      );
+    };
+    return transport;
+  };
+  KmipClientPool pool(config);
+
+  {
+    auto conn = pool.borrow();
+    auto request = conn->make_request_message();
+    request.add_batch_item(kmipcore::ActivateRequest("id"));
+    (void) conn->exchange(request);
+  }
+  {
+    auto conn = pool.borrow();
+    conn.markUnhealthy();
+    EXPECT_FALSE(pool.try_borrow().has_value());
+  }
+
+  const auto m = pool.metrics();
+  EXPECT_EQ(m.borrows, 2u);
+  EXPECT_EQ(m.borrow_wait.count, 2u);
+  EXPECT_EQ(m.hold.count, 2u);
+  EXPECT_EQ(m.exchange.count, 1u);
+  EXPECT_EQ(m.connects, 1u);
+  EXPECT_EQ(m.connect.count, 1u);
+  EXPECT_EQ(m.exhaustions, 1u);
+  EXPECT_EQ(m.discards, 1u);
+  EXPECT_EQ(m.in_use, 0u);
+  EXPECT_EQ(m.max, 1u);
+
+  struct Collector : PoolMetricsVisitor {
+    std::map<std::string, std::uint64_t> values;
+    void counter(std::string_view name, std::uint64_t value) override {
+      values[std::string(name)] = value;
+    }
+    void gauge(std::string_view name, std::uint64_t value) override {
+      values[std::string(name)] = value;
+    }
+    void histogram(
+        std::string_view name, const LatencyHistogram::Snapshot &snapshot
+    ) override {
+      values[std::string(name)] = snapshot.count;
+    }
+  } collector;
+  pool.visit_metrics(collector);
+  EXPECT_EQ(collector.values["borrows"], 2u);
+  EXPECT_EQ(collector.values["exchange"], 1u);
+  EXPECT_EQ(collector.values["max"], 1u);
+}
+
+TEST(KmipClientPoolTest, BulkBorrowersCannotTakeReservedConnections) {
+  auto config = fake_config(2, 1);
+  config.reserved_interactive = 1;
+  KmipClientPool pool(config);
+  using Priority = KmipClientPool::Priority;
+
+  auto bulk = pool.borrow(Priority::bulk);
+  EXPECT_FALSE(pool.try_borrow(Priority::bulk).has_value());
+  EXPECT_THROW(
+      (void) pool.borrow(std::chrono::milliseconds(10), Priority::bulk),
+      kmipcore::KmipException
+  );
+  auto interactive = pool.try_borrow(Priority::interactive);
+  EXPECT_TRUE(interactive.has_value());
+}
+
+TEST(KmipClientPoolTest, QueuedBorrowersAreServedByPriorityThenArrival) {
+  KmipClientPool pool(fake_config(1, 1));
+  using Priority = KmipClientPool::Priority;
+  auto held = std::make_optional(pool.borrow());
+
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+  std::vector<std::thread> threads;
+  const auto enqueue = [&](std::string name, Priority priority) {
+    const auto queued = pool.metrics().waiting + 1;
+    threads.emplace_back([&, name, priority] {
+      auto conn = pool.borrow(priority);
+      std::lock_guard<std::mutex> lk(order_mutex);
+      order.push_back(name);
+    });
+    while (pool.metrics().waiting < queued) {
+      std::this_thread::yield();
+    }
+  };
+  enqueue("bulk-1", Priority::bulk);
+  enqueue("interactive-1", Priority::interactive);
+  enqueue("bulk-2", Priority::bulk);
+  enqueue("interactive-2", Priority::interactive);
+
+  held.reset();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(
+      order,
+      (std::vector<std::string>{
+          "interactive-1", "interactive-2", "bulk-1", "bulk-2"
+      })
+  );
+}
+
+TEST(KmipClientPoolTest, AdaptiveLimitQueuesAndShedsExcessBorrowers) {
+  auto config = fake_config(4, 1);
+  config.adaptive_limit = AdaptiveLimiter::Config{.initial_limit = 1};
+  config.max_waiting = 1;
+  KmipClientPool pool(config);
+  EXPECT_EQ(pool.concurrency_limit(), 1u);
+
+  auto held = std::make_optional(pool.borrow());
+  EXPECT_FALSE(pool.try_borrow().has_value());
+
+  std::thread queued([&] { auto conn = pool.borrow(); });
+  while (pool.metrics().waiting < 1) {
+    std::this_thread::yield();
+  }
+  EXPECT_THROW((void) pool.borrow(), KmipOverloadException);
+  EXPECT_EQ(pool.metrics().sheds, 1u);
+
+  held.reset();
+  queued.join();
+  EXPECT_EQ(pool.total_count(), 1u);
+  EXPECT_EQ(pool.metrics().limit, 1u);
+}
+
+TEST(KmipClientPoolTest, CircuitBreakerFailsFastAndRecoversByProbe) {
+  using State = CircuitBreaker::State;
+  auto down = std::make_shared<std::atomic<bool>>(true);
+  auto attempts = std::make_shared<std::atomic<int>>(0);
+  std::mutex transitions_mutex;
+  std::vector<std::pair<State, State>> transitions;
+
+  auto config = fake_config(4, 1);
+  config.transport_factory = [down, attempts](const KmipClientPool::Config &) {
+    return std::make_unique<FlakyNetClient>(down, attempts);
+  };
+  config.circuit_breaker = CircuitBreaker::Config{
+      .failure_threshold = 2,
+      .open_duration = std::chrono::milliseconds(20),
+      .max_backoff = std::chrono::milliseconds(40),
+      .listener =
+          [&](State from, State to) {
+            std::lock_guard<std::mutex> lk(transitions_mutex);
+            transitions.emplace_back(from, to);
+          },
+  };
+  KmipClientPool pool(config);
+
+  EXPECT_THROW((void) pool.borrow(), KmipIOException);
+  EXPECT_THROW((void) pool.borrow(), KmipIOException);
+  EXPECT_EQ(pool.circuit_state(), State::open);
+  EXPECT_THROW((void) pool.borrow(), KmipCircuitOpenException);
+  EXPECT_THROW((void) pool.try_borrow(), KmipCircuitOpenException);
+  EXPECT_GE(pool.metrics().circuit_rejections, 2u);
+
+  // Only the background probe connects while the breaker is open.
+  for (int i = 0; i < 200 && attempts->load() < 3; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(attempts->load(), 3);
+
+  down->store(false);
+  for (int i = 0; i < 200 && pool.circuit_state() != State::closed; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  ASSERT_EQ(pool.circuit_state(), State::closed);
+  auto conn = pool.borrow();
+  EXPECT_EQ(pool.total_count(), 1u);  // the probe's connection
+  EXPECT_EQ(pool.metrics().circuit_opens, 1u);
+
+  std::lock_guard<std::mutex> lk(transitions_mutex);
+  ASSERT_GE(transitions.size(), 4u);
+  EXPECT_EQ(transitions.front(), std::make_pair(State::closed, State::open));
+  EXPECT_EQ(transitions[1], std::make_pair(State::open, State::half_open));
+  EXPECT_EQ(transitions[2], std::make_pair(State::half_open, State::open));
+  EXPECT_EQ(
+      transitions.back(), std::make_pair(State::half_open, State::closed)
+  );
+}
+
+TEST(KmipClientPoolTest, ThreadAffinityReturnsCachedConnectionToItsThread) {
+  auto config = fake_config(2, 2);
+  config.thread_affinity = true;
+  KmipClientPool pool(config);
+
+  KmipClient *cached = nullptr;
+  {
+    auto conn = pool.borrow();
+    cached = &*conn;
+  }
+  EXPECT_EQ(pool.available_count(), 1u);
+  {
+    auto conn = pool.borrow();
+    EXPECT_EQ(&*conn, cached);
+  }
+
+  // Another thread reclaims the cached connection once the pool is full.
+  std::thread other([&] {
+    auto first = pool.borrow();
+    auto second = pool.borrow(std::chrono::seconds(5));
+    EXPECT_TRUE(&*first == cached || &*second == cached);
+  });
+  other.join();
+  EXPECT_EQ(pool.total_count(), 2u);
+  EXPECT_EQ(pool.available_count(), 2u);
+}
+
+TEST(KmipClientPoolTest, ExitingThreadsHandBackTheirCachedConnection) {
+  auto config = fake_config(1, 1);
+  config.thread_affinity = true;
+  auto pool = std::make_unique<KmipClientPool>(config);
+
+  // Each short-lived thread caches the only connection until it exits.
+  for (int i = 0; i < 50; ++i) {
+    std::thread([&] { auto conn = pool->borrow(); }).join();
+    EXPECT_EQ(pool->available_count(), 1u);
+  }
+  EXPECT_EQ(pool->metrics().connects, 1u);
+  {
+    auto conn = pool->borrow(std::chrono::seconds(1));
+  }
+
+  // A thread that outlives the pool leaves its connection to the pool.
+  std::promise<void> cached;
+  std::promise<void> destroyed;
+  std::thread survivor([&] {
+    {
+      auto conn = pool->borrow();
+    }
+    cached.set_value();
+    destroyed.get_future().wait();
+  });
+  cached.get_future().wait();
+  pool.reset();
+  destroyed.set_value();
+  survivor.join();
+}
+
+TEST(KmipClientPoolTest, BorrowProbesOnlyLongIdleConnections) {
+  for (const bool health_check : {true, false}) {
+    test::FakeNetClient *transport = nullptr;
+    auto config = fake_config(1, 1);
+    config.thread_affinity = true;
+    if (health_check) {
+      config.health_check_interval = std::chrono::hours(1);
+    }
+    config.probe_idle_after = std::chrono::milliseconds(50);
+    config.transport_factory = [&transport](const KmipClientPool::Config &) {
+      auto fake = std::make_unique<test::FakeNetClient>();
+      transport = fake.get();
+      return fake;
+    };
+    KmipClientPool pool(config);
+
+    (void) pool.borrow();
+    (void) pool.borrow();
+    // Without the background check every borrow of an idle connection
+    // probes it, on the affinity fast path too.
+    EXPECT_EQ(transport->idle_probe_calls, health_check ? 0 : 1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    (void) pool.borrow();
+    EXPECT_EQ(transport->idle_probe_calls, health_check ? 1 : 2);
+  }
+}
+
+TEST(KmipClientPoolTest, HealthCheckCoversThreadCachedConnections) {
+  auto transports = std::make_shared<std::vector<test::FakeNetClient *>>();
+  transports->reserve(4);
+  auto config = fake_config(1, 1);
+  config.thread_affinity = true;
+  config.health_check_interval = std::chrono::milliseconds(10);
+  config.transport_factory = [transports](const KmipClientPool::Config &) {
+    auto transport = std::make_unique<test::FakeNetClient>();
+    transports->push_back(transport.get());
+    return transport;
+  };
+  KmipClientPool pool(config);
+
+  {
+    auto conn = pool.borrow();
+  }
+  // The server drops the connection while this thread keeps it cached.
+  transports->front()->close();
+  for (int i = 0; i < 200 && pool.metrics().reconnects == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(pool.metrics().reconnects, 1u);
+  EXPECT_EQ(pool.total_count(), 1u);
+  EXPECT_EQ(pool.available_count(), 1u);
+}
+
+TEST(KmipClientPoolTest, AsyncBorrowersQueueWithoutBlocking) {
+  auto config = fake_config(1, 1);
+  config.max_waiting = 2;
+  KmipClientPool pool(config);
+
+  std::optional<KmipClientPool::BorrowedClient> held = pool.borrow();
+  std::optional<KmipClientPool::BorrowedClient> served;
+  pool.borrow_async([&](auto client, std::exception_ptr error) {
+    EXPECT_FALSE(error);
+    served = std::move(client);
+  });
+  auto future = pool.borrow_async(KmipClientPool::Priority::bulk);
+  EXPECT_FALSE(served.has_value());
+  EXPECT_EQ(pool.metrics().waiting, 2u);
+
+  // Shedding is reported through the callback.
+  std::exception_ptr shed;
+  pool.borrow_async([&](auto client, std::exception_ptr error) {
+    EXPECT_FALSE(client.has_value());
+    shed = error;
+  });
+  EXPECT_THROW(std::rethrow_exception(shed), KmipOverloadException);
+
+  // Returns serve the queued requests in order on the returning thread.
+  held.reset();
+  ASSERT_TRUE(served.has_value());
+  EXPECT_EQ(
+      future.wait_for(std::chrono::seconds(0)), std::future_status::timeout
+  );
+  served.reset();
+  ASSERT_EQ(
+      future.wait_for(std::chrono::seconds(0)), std::future_status::ready
+  );
+  auto last = future.get();
+  EXPECT_TRUE(last.isHealthy());
+  EXPECT_EQ(pool.metrics().waiting, 0u);
+}
+
+TEST(KmipClientPoolTest, ParallelLocateMergesPagesInServerOrder) {
+  for (const bool report_count : {true, false}) {
+    KmipClientPool pool(locate_pool(1000, report_count));
+
+    const auto ids = pool.parallel_locate(
+        "", object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 4, 64
+    );
+    ASSERT_EQ(ids.size(), 1000u);
+    for (size_t i = 0; i < ids.size(); ++i) {
+      ASSERT_EQ(ids[i], "id-" + std::to_string(i));
+    }
+    // Without Located Items there is nothing to split: one connection.
+    EXPECT_EQ(pool.total_count() > 1, report_count);
+  }
+  EXPECT_THROW(
+      (void) KmipClientPool(fake_config(1, 1))
+          .parallel_locate("", object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 0),
+      kmipcore::KmipException
+  );
+}
+
+TEST(KmipClientPoolTest, ParallelLocateStopsAtMaxIds) {
+  // A huge Located Items count must neither size the fan-out nor keep the
+  // sequential paging going past max_ids.
+  for (const bool report_count : {true, false}) {
+    KmipClientPool pool(locate_pool(1'000'000'000, report_count));
+
+    const auto ids = pool.parallel_locate(
+        "", object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 4, 64, 300
+    );
+    ASSERT_EQ(ids.size(), 300u);
+    EXPECT_EQ(ids.back(), "id-299");
+  }
+}
+
+TEST(KmipClientPoolTest, ParallelLocateFollowsServerPageCap) {
+  // The server serves 100 of the 256 identifiers asked for per page.
+  for (const bool report_count : {true, false}) {
+    KmipClientPool pool(locate_pool(1000, report_count, 100));
+
+    const auto ids = pool.parallel_locate(
+        "", object_type::KMIP_OBJTYPE_SYMMETRIC_KEY, 4, 256
+    );
+    ASSERT_EQ(ids.size(), 1000u);
+    for (size_t i = 0; i < ids.size(); ++i) {
+      ASSERT_EQ(ids[i], "id-" + std::to_string(i));
+    }
+  }
+}
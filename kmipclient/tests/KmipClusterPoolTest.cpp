@@ -0,0 +1,135 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/KmipClusterPool.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipcore/kmip_basics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+
+using kmipclient::KmipClientPool;
+using kmipclient::KmipClusterPool;
+
+namespace {
+
+  // Nodes that can never be connected to (no client certificate), so every
+  // borrow attempt fails before anything is sent.
+  KmipClusterPool::Config unreachable_cluster(unsigned failure_threshold) {
+    KmipClusterPool::Config config;
+    config.endpoints = {{"127.0.0.1", "1"}, {"127.0.0.1", "2"}};
+    config.node.client_cert = "/nonexistent/cert.pem";
+    config.node.client_key = "/nonexistent/key.pem";
+    config.node.server_ca_cert = "/nonexistent/ca.pem";
+    config.node.timeout_ms = 200;
+    config.failure_threshold = failure_threshold;
+    config.ejection_duration = std::chrono::milliseconds(50);
+    return config;
+  }
+
+}  // namespace
+
+TEST(KmipClusterPoolTest, RejectsInvalidConfig) {
+  KmipClusterPool::Config config = unreachable_cluster(1);
+  config.endpoints.clear();
+  EXPECT_THROW(KmipClusterPool{config}, kmipcore::KmipException);
+
+  config = unreachable_cluster(0);
+  EXPECT_THROW(KmipClusterPool{config}, kmipcore::KmipException);
+
+  config = unreachable_cluster(1);
+  config.latency_smoothing = 0.0;
+  EXPECT_THROW(KmipClusterPool{config}, kmipcore::KmipException);
+}
+
+TEST(KmipClusterPoolTest, BorrowTriesEveryNodeThenEjects) {
+  KmipClusterPool cluster(unreachable_cluster(2));
+
+  EXPECT_THROW((void) cluster.borrow(), kmipcore::KmipException);
+  for (const auto &node : cluster.node_stats()) {
+    EXPECT_EQ(node.consecutive_failures, 1u);
+    EXPECT_FALSE(node.ejected);
+    EXPECT_EQ(node.outstanding, 0u);
+  }
+
+  EXPECT_THROW((void) cluster.borrow(), kmipcore::KmipException);
+  for (const auto &node : cluster.node_stats()) {
+    EXPECT_EQ(node.consecutive_failures, 2u);
+    EXPECT_TRUE(node.ejected);
+  }
+
+  // Ejected nodes are still tried when nothing else is left.
+  EXPECT_THROW((void) cluster.borrow(), kmipcore::KmipException);
+  for (const auto &node : cluster.node_stats()) {
+    EXPECT_EQ(node.consecutive_failures, 3u);
+    EXPECT_EQ(node.total_connections, 0u);
+  }
+}
+
+TEST(KmipClusterPoolTest, FailoverGivesUpAfterAllNodes) {
+  KmipClusterPool cluster(unreachable_cluster(5));
+  int calls = 0;
+  EXPECT_THROW(
+      cluster.execute_with_failover([&](kmipclient::KmipClient &) {
+        return ++calls;
+      }),
+      kmipcore::KmipException
+  );
+  EXPECT_EQ(calls, 0);
+  EXPECT_EQ(cluster.node_count(), 2u);
+}
+
+TEST(KmipClusterPoolTest, LatencyAverageTracksExchangesNotHoldTime) {
+  std::atomic<int> observed{0};
+  KmipClusterPool::Config config;
+  config.endpoints = {{"node-1", "5696"}};
+  config.node.exchange_observer = [&](auto, bool) { ++observed; };
+  config.node.transport_factory = [](const KmipClientPool::Config &) {
+    auto nc = std::make_unique<kmipclient::test::FakeNetClient>();
+    nc->handler = [](const kmipcore::RequestMessage &rq) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      const auto &item = rq.getBatchItems().front();
+      auto payload = kmipcore::Element::createStructure(
+          kmipcore::tag::KMIP_TAG_RESPONSE_PAYLOAD
+      );
+      payload->asStructure()->add(kmipcore::Element::createTextString(
+          kmipcore::tag::KMIP_TAG_UNIQUE_IDENTIFIER, "key"
+      ));
+      return kmipclient::test::make_response_message(
+          rq, {kmipclient::test::make_success_item(item, payload)}
+      );
+    };
+    return nc;
+  };
+  KmipClusterPool cluster(config);
+
+  {
+    auto conn = cluster.borrow();
+    // Time the borrower spends between requests is not the node's latency.
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(conn->op_activate("key"), "key");
+  }
+  const auto latency = cluster.node_stats().front().latency;
+  EXPECT_GE(latency, std::chrono::milliseconds(20));
+  EXPECT_LT(latency, std::chrono::milliseconds(300));
+  // The node's own observer still sees every exchange.
+  EXPECT_EQ(observed.load(), 1);
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/LatencyTracker.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+using kmipclient::LatencyTracker;
+using std::chrono::microseconds;
+
+TEST(LatencyTrackerTest, PercentilesOverRecordedSamples) {
+  LatencyTracker tracker;
+  EXPECT_FALSE(tracker.percentile(0.5).has_value());
+
+  for (int i = 1; i <= 100; ++i) {
+    tracker.record(microseconds(i));
+  }
+  EXPECT_EQ(tracker.percentile(0.0), microseconds(1));
+  EXPECT_EQ(tracker.percentile(0.5), microseconds(51));
+  EXPECT_EQ(tracker.percentile(0.95), microseconds(95));
+  EXPECT_EQ(tracker.percentile(1.0), microseconds(100));
+  EXPECT_FALSE(tracker.percentile(0.5, 101).has_value());
+}
+
+TEST(LatencyTrackerTest, KeepsOnlyMostRecentSamples) {
+  LatencyTracker tracker(4);
+  for (int i = 1; i <= 4; ++i) {
+    tracker.record(microseconds(1000));
+  }
+  for (int i = 1; i <= 4; ++i) {
+    tracker.record(microseconds(i));
+  }
+  EXPECT_EQ(tracker.size(), 4u);
+  EXPECT_EQ(tracker.percentile(1.0), microseconds(4));
+
+  EXPECT_THROW(LatencyTracker{0}, kmipcore::KmipException);
+}
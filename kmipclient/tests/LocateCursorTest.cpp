@@ -0,0 +1,147 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/LocateCursor.hpp"
+
+#include "kmipcore/kmip_errors.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+
+using namespace kmipclient;
+
+namespace {
+
+  /// Page source over @p count identifiers "id-0", "id-1", ...
+  LocateCursor::FetchPage
+      make_source(std::size_t count, std::atomic<int> &calls) {
+    return [count, &calls](
+               std::size_t offset,
+               std::size_t page_size,
+               std::optional<std::size_t> *located_items
+           ) {
+      ++calls;
+      std::vector<std::string> ids;
+      for (auto i = offset; i < std::min(count, offset + page_size); ++i) {
+        ids.push_back("id-" + std::to_string(i));
+      }
+      *located_items = count;
+      return ids;
+    };
+  }
+
+}  // namespace
+
+TEST(LocateCursorTest, YieldsAllIdsPageByPageAndStopsEarly) {
+  std::atomic<int> calls{0};
+  LocateCursor all(make_source(1000, calls), {.page_size = 64});
+  std::size_t n = 0;
+  for (const auto &id : all) {
+    EXPECT_EQ(id, "id-" + std::to_string(n));
+    ++n;
+  }
+  EXPECT_EQ(n, 1000u);
+  EXPECT_EQ(calls.load(), 16);  // stops at Located Items, no empty page
+  EXPECT_EQ(all.located_items(), 1000u);
+
+  // Stopping early leaves the remaining pages unfetched, save one prefetch.
+  calls = 0;
+  {
+    LocateCursor cursor(make_source(1000, calls), {.page_size = 64});
+    for (const auto &id : cursor) {
+      if (id == "id-10") {
+        break;
+      }
+    }
+  }
+  EXPECT_EQ(calls.load(), 2);
+}
+
+TEST(LocateCursorTest, PagesPastServerCappedPages) {
+  // A server answering at most 3 identifiers whatever the page size.
+  const auto capped_source = [](std::size_t count, bool report_count) {
+    return [count, report_count](
+               std::size_t offset,
+               std::size_t page_size,
+               std::optional<std::size_t> *located_items
+           ) {
+      std::vector<std::string> ids;
+      const auto last = std::min({count, offset + page_size, offset + 3});
+      for (auto i = offset; i < last; ++i) {
+        ids.push_back("id-" + std::to_string(i));
+      }
+      if (report_count) {
+        *located_items = count;
+      }
+      return ids;
+    };
+  };
+  using Sizes = std::vector<std::size_t>;
+  const auto page_sizes = [](LocateCursor cursor) {
+    Sizes sizes;
+    while (auto page = cursor.next_page()) {
+      sizes.push_back(page->size());
+    }
+    return sizes;
+  };
+
+  EXPECT_EQ(
+      page_sizes(LocateCursor(capped_source(10, true), {.page_size = 8})),
+      Sizes({3, 3, 3, 1})
+  );
+  // Without Located Items, paging ends at the first empty page.
+  EXPECT_EQ(
+      page_sizes(LocateCursor(capped_source(7, false), {.page_size = 8})),
+      Sizes({3, 3, 1})
+  );
+}
+
+TEST(LocateCursorTest, LimitsDeduplicatesAndResumesAfterFailure) {
+  // A server whose second page overlaps the first, as with unstable order.
+  int calls = 0;
+  bool fail_next = false;
+  LocateCursor cursor(
+      [&](std::size_t offset,
+          std::size_t page_size,
+          std::optional<std::size_t> *) {
+        ++calls;
+        if (fail_next) {
+          fail_next = false;
+          throw kmipcore::KmipException(-1, "transient");
+        }
+        const auto start = calls == 2 ? offset - 2 : offset;
+        std::vector<std::string> ids;
+        for (auto i = start; i < start + page_size; ++i) {
+          ids.push_back("id-" + std::to_string(i));
+        }
+        return ids;
+      },
+      {.page_size = 4, .prefetch = false, .max_ids = 9, .dedup_window = 8}
+  );
+  using Ids = std::vector<std::string>;
+
+  EXPECT_EQ(cursor.next_page(), Ids({"id-0", "id-1", "id-2", "id-3"}));
+  EXPECT_EQ(cursor.next_page(), Ids({"id-4", "id-5"}));
+
+  fail_next = true;
+  EXPECT_THROW((void) cursor.next_page(), kmipcore::KmipException);
+  EXPECT_EQ(cursor.next_page(), Ids({"id-8", "id-9", "id-10"}));
+  EXPECT_EQ(cursor.next_page(), std::nullopt);
+  EXPECT_EQ(cursor.returned(), 9u);
+  EXPECT_EQ(calls, 4);
+}
@@ -0,0 +1,175 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/NetClientUnix.hpp"
+
+#include "kmipclient/KmipClientPool.hpp"
+#include "kmipclient/KmipIOException.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace kmipclient;
+
+namespace {
+
+  // Unix socket server echoing everything back on each accepted connection,
+  // or hanging up right after accepting when @p echo is false.
+  class EchoServer {
+  public:
+    explicit EchoServer(bool echo = true)
+      : echo_(echo),
+        path_(
+            "/tmp/kmipclient-test-" + std::to_string(::getpid()) + ".sock"
+        ) {
+      ::unlink(path_.c_str());
+      fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      sockaddr_un addr{};
+      addr.sun_family = AF_UNIX;
+      std::strncpy(addr.sun_path, path_.c_str(), sizeof(addr.sun_path) - 1);
+      if (::bind(fd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) !=
+              0 ||
+          ::listen(fd_, 4) != 0) {
+        ADD_FAILURE() << "unable to listen on " << path_;
+      }
+      thread_ = std::thread([this] { serve(); });
+    }
+
+    ~EchoServer() {
+      ::shutdown(fd_, SHUT_RDWR);
+      ::close(fd_);
+      thread_.join();
+      ::unlink(path_.c_str());
+    }
+
+    [[nodiscard]] const std::string &path() const { return path_; }
+
+  private:
+    void serve() {
+      for (;;) {
+        const int conn = ::accept(fd_, nullptr, nullptr);
+        if (conn < 0) {
+          return;
+        }
+        std::uint8_t buf[256];
+        ssize_t n = 0;
+        while (echo_ && (n = ::recv(conn, buf, sizeof(buf), 0)) > 0) {
+          (void) ::send(conn, buf, static_cast<size_t>(n), MSG_NOSIGNAL);
+        }
+        ::close(conn);
+      }
+    }
+
+    bool echo_;
+    std::string path_;
+    int fd_ = -1;
+    std::thread thread_;
+  };
+
+}  // namespace
+
+TEST(NetClientUnixTest, SendsAndReceivesRawBytes) {
+  EchoServer server;
+  NetClientUnix nc(server.path(), 1000);
+  ASSERT_TRUE(nc.connect());
+  EXPECT_TRUE(nc.is_connected());
+
+  const std::vector<std::uint8_t> out{0x42, 0x00, 0x7B, 0x01};
+  EXPECT_EQ(nc.send(out), 4);
+  std::vector<std::uint8_t> in(4);
+  EXPECT_EQ(nc.recv(in), 4);
+  EXPECT_EQ(in, out);
+
+  nc.close();
+  EXPECT_FALSE(nc.is_connected());
+}
+
+TEST(NetClientUnixTest, ConnectFailsForMissingSocket) {
+  NetClientUnix nc("/nonexistent/kmip.sock");
+  EXPECT_THROW(nc.connect(), KmipIOException);
+  EXPECT_FALSE(nc.is_connected());
+}
+
+TEST(NetClientUnixTest, PoolUsesTransportFactory) {
+  EchoServer server;
+  KmipClientPool pool({
+      .host = server.path(),
+      .max_connections = 2,
+      .transport_factory =
+          [](const KmipClientPool::Config &config) {
+            return std::make_unique<NetClientUnix>(
+                config.host, config.timeout_ms
+            );
+          },
+  });
+
+  {
+    auto first = pool.borrow();
+    auto second = pool.borrow();
+    EXPECT_EQ(pool.total_count(), 2u);
+  }
+  EXPECT_EQ(pool.available_count(), 2u);
+}
+
+TEST(NetClientUnixTest, IdleProbeDetectsServerHangUp) {
+  {
+    EchoServer server;
+    NetClientUnix nc(server.path(), 1000);
+    ASSERT_TRUE(nc.connect());
+    EXPECT_TRUE(nc.is_idle_usable());
+  }
+  EchoServer server(false);
+  NetClientUnix nc(server.path(), 1000);
+  ASSERT_TRUE(nc.connect());
+  // The server closes the connection right after accepting it.
+  for (int i = 0; i < 100 && nc.is_idle_usable(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_FALSE(nc.is_idle_usable());
+}
+
+TEST(NetClientUnixTest, PoolMaintenanceClosesIdleConnections) {
+  EchoServer server;
+  KmipClientPool pool({
+      .host = server.path(),
+      .max_connections = 2,
+      .transport_factory =
+          [](const KmipClientPool::Config &config) {
+            return std::make_unique<NetClientUnix>(
+                config.host, config.timeout_ms
+            );
+          },
+      .health_check_interval = std::chrono::milliseconds(10),
+      .idle_timeout = std::chrono::milliseconds(30),
+  });
+
+  { auto conn = pool.borrow(); }
+  EXPECT_EQ(pool.total_count(), 1u);
+  for (int i = 0; i < 100 && pool.total_count() != 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(pool.total_count(), 0u);
+  EXPECT_EQ(pool.available_count(), 0u);
+}
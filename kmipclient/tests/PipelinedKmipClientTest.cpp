@@ -0,0 +1,170 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/PipelinedKmipClient.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipclient/KmipIOException.hpp"
+#include "kmipcore/kmip_requests.hpp"
+#include "kmipcore/kmip_responses.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using kmipclient::PipelinedKmipClient;
+using kmipclient::test::FakeNetClient;
+
+namespace {
+
+  // Answers every Activate item with the identifier it was asked about.
+  kmipcore::ResponseMessage echo_activate(const kmipcore::RequestMessage &rq) {
+    std::vector<kmipcore::ResponseBatchItem> items;
+    for (const auto &item : rq.getBatchItems()) {
+      auto payload = kmipcore::Element::createStructure(
+          kmipcore::tag::KMIP_TAG_RESPONSE_PAYLOAD
+      );
+      payload->asStructure()->add(
+          item.getRequestPayload()->getChild(
+              kmipcore::tag::KMIP_TAG_UNIQUE_IDENTIFIER
+          )
+      );
+      items.push_back(kmipclient::test::make_success_item(item, payload));
+    }
+    return kmipclient::test::make_response_message(rq, std::move(items));
+  }
+
+  struct Sent {
+    PipelinedKmipClient::Ticket ticket;
+    uint32_t batch_item_id;
+  };
+
+  Sent submit_activate(PipelinedKmipClient &pipe, const std::string &id) {
+    auto request = pipe.make_request_message();
+    const auto item = request.add_batch_item(kmipcore::ActivateRequest(id));
+    return Sent{pipe.submit(std::move(request)), item};
+  }
+
+  std::string activated_id(PipelinedKmipClient &pipe, const Sent &sent) {
+    auto response = pipe.wait(sent.ticket);
+    return response.parser
+        ->getResponseByBatchItemId<kmipcore::ActivateResponseBatchItem>(
+            sent.batch_item_id
+        )
+        .getUniqueIdentifier();
+  }
+
+}  // namespace
+
+TEST(PipelinedKmipClientTest, SendsUpToWindowBeforeReadingResponses) {
+  FakeNetClient nc;
+  nc.connect();
+  nc.handler = echo_activate;
+  PipelinedKmipClient pipe(nc, {}, kmipcore::KMIP_VERSION_1_4, 2);
+
+  const auto a = submit_activate(pipe, "id-a");
+  const auto b = submit_activate(pipe, "id-b");
+  EXPECT_EQ(pipe.in_flight(), 2u);
+  EXPECT_EQ(nc.recv_calls, 0);
+
+  // Window is full: the third submit must first read the oldest response.
+  const auto c = submit_activate(pipe, "id-c");
+  EXPECT_EQ(pipe.in_flight(), 2u);
+  EXPECT_EQ(nc.received_requests.size(), 3u);
+
+  EXPECT_EQ(activated_id(pipe, c), "id-c");
+  EXPECT_EQ(activated_id(pipe, a), "id-a");
+  EXPECT_EQ(activated_id(pipe, b), "id-b");
+  EXPECT_EQ(pipe.in_flight(), 0u);
+}
+
+TEST(PipelinedKmipClientTest, BatchItemIdsAreUniqueAcrossMessages) {
+  FakeNetClient nc;
+  nc.connect();
+  nc.handler = echo_activate;
+  PipelinedKmipClient pipe(nc);
+
+  const auto a = submit_activate(pipe, "id-a");
+  const auto b = submit_activate(pipe, "id-b");
+  EXPECT_NE(a.batch_item_id, b.batch_item_id);
+  pipe.drain();
+  EXPECT_EQ(activated_id(pipe, b), "id-b");
+  EXPECT_EQ(activated_id(pipe, a), "id-a");
+}
+
+TEST(PipelinedKmipClientTest, RejectsBatchItemIdCollisionWithRequestInFlight) {
+  FakeNetClient nc;
+  nc.connect();
+  nc.handler = echo_activate;
+  PipelinedKmipClient pipe(nc);
+
+  kmipcore::RequestMessage first;
+  first.add_batch_item(kmipcore::ActivateRequest("id-a"));
+  kmipcore::RequestMessage second;
+  second.add_batch_item(kmipcore::ActivateRequest("id-b"));
+
+  const auto ticket = pipe.submit(std::move(first));
+  EXPECT_THROW(pipe.submit(std::move(second)), kmipcore::KmipException);
+  EXPECT_NO_THROW((void) pipe.wait(ticket));
+}
+
+TEST(PipelinedKmipClientTest, TransportFailureFailsWholeWindow) {
+  FakeNetClient nc;
+  nc.connect();
+  nc.handler = echo_activate;
+  PipelinedKmipClient pipe(nc);
+
+  const auto a = submit_activate(pipe, "id-a");
+  const auto b = submit_activate(pipe, "id-b");
+  const auto c = submit_activate(pipe, "id-c");
+  // Emulate a connection drop right after the first response.
+  const auto first_response = kmipclient::test::serialize_element(
+      echo_activate(nc.received_requests.front()).toElement()
+  );
+  nc.response_bytes.resize(first_response.size());
+
+  EXPECT_EQ(activated_id(pipe, a), "id-a");
+  EXPECT_THROW((void) pipe.wait(b.ticket), kmipclient::KmipIOException);
+  EXPECT_EQ(pipe.in_flight(), 0u);
+  EXPECT_THROW((void) pipe.wait(c.ticket), kmipclient::KmipIOException);
+  EXPECT_FALSE(nc.is_connected());
+}
+
+TEST(PipelinedKmipClientTest, MismatchedBatchItemIdIsReportedAsDesync) {
+  FakeNetClient nc;
+  nc.connect();
+  nc.handler = [](const kmipcore::RequestMessage &rq) {
+    auto response = echo_activate(rq);
+    for (auto &item : response.getBatchItems()) {
+      item.setUniqueBatchItemId(item.getUniqueBatchItemId() + 1);
+    }
+    return response;
+  };
+  PipelinedKmipClient pipe(nc);
+
+  const auto a = submit_activate(pipe, "id-a");
+  const auto b = submit_activate(pipe, "id-b");
+  EXPECT_THROW((void) pipe.wait(a.ticket), kmipclient::KmipIOException);
+  EXPECT_THROW((void) pipe.wait(b.ticket), kmipclient::KmipIOException);
+  EXPECT_FALSE(nc.is_connected());
+}
+
+TEST(PipelinedKmipClientTest, UnknownTicketIsRejected) {
+  FakeNetClient nc;
+  PipelinedKmipClient pipe(nc);
+  EXPECT_THROW((void) pipe.wait(42), kmipcore::KmipException);
+}
@@ -0,0 +1,52 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "kmipclient/PoolMetrics.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+
+using kmipclient::LatencyHistogram;
+using std::chrono::microseconds;
+
+TEST(PoolMetricsTest, HistogramUsesPowerOfTwoBuckets) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.snapshot().percentile(0.5), microseconds(0));
+
+  histogram.record(microseconds(0));    // bucket 0
+  histogram.record(microseconds(3));    // [2, 4)
+  histogram.record(microseconds(100));  // [64, 128)
+  histogram.record(microseconds(900));  // [512, 1024)
+
+  const auto snapshot = histogram.snapshot();
+  EXPECT_EQ(snapshot.count, 4u);
+  EXPECT_EQ(snapshot.buckets[0], 1u);
+  EXPECT_EQ(snapshot.buckets[2], 1u);
+  EXPECT_EQ(snapshot.buckets[7], 1u);
+  EXPECT_EQ(snapshot.buckets[10], 1u);
+  EXPECT_EQ(snapshot.sum, microseconds(1003));
+  EXPECT_EQ(snapshot.max, microseconds(900));
+  EXPECT_EQ(snapshot.mean(), microseconds(250));
+  EXPECT_EQ(snapshot.percentile(0.5), microseconds(4));
+  EXPECT_EQ(snapshot.percentile(0.75), microseconds(128));
+  EXPECT_EQ(snapshot.percentile(1.0), microseconds(900));  // capped at max
+  EXPECT_EQ(
+      LatencyHistogram::Snapshot::upper_bound(LatencyHistogram::BUCKETS - 1),
+      microseconds::max()
+  );
+}
@@ -0,0 +1,124 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/RetryPolicy.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipclient/KmipClient.hpp"
+#include "kmipcore/kmip_requests.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <span>
+
+using namespace kmipclient;
+using kmipcore::operation;
+
+namespace {
+
+  /// Emulates a connection the server closed while it was idle: the first
+  /// request is sent but never answered.
+  class StaleOnceNetClient : public test::FakeNetClient {
+  public:
+    StaleOnceNetClient() {
+      handler = [](const kmipcore::RequestMessage &request) {
+        return test::make_response_message(
+            request, {test::make_success_item(request.getBatchItems().front())}
+        );
+      };
+      connect();
+    }
+
+    int recv(std::span<std::uint8_t> data) override {
+      if (stale) {
+        stale = false;
+        response_bytes.clear();
+        return 0;
+      }
+      return FakeNetClient::recv(data);
+    }
+
+    bool stale = true;
+  };
+
+  kmipcore::RequestMessage
+      make_request(const KmipClient &client, kmipcore::RequestBatchItem item) {
+    auto request = client.make_request_message();
+    request.add_batch_item(std::move(item));
+    return request;
+  }
+
+}  // namespace
+
+TEST(RetryPolicyTest, ClassifiesOperationsAndBacksOff) {
+  EXPECT_TRUE(RetryPolicy::is_idempotent(operation::KMIP_OP_GET));
+  EXPECT_TRUE(RetryPolicy::is_idempotent(operation::KMIP_OP_LOCATE));
+  EXPECT_TRUE(RetryPolicy::is_idempotent(operation::KMIP_OP_QUERY));
+  EXPECT_FALSE(RetryPolicy::is_idempotent(operation::KMIP_OP_CREATE));
+  EXPECT_FALSE(RetryPolicy::is_idempotent(operation::KMIP_OP_REGISTER));
+
+  const RetryPolicy policy{
+      .max_attempts = 5,
+      .initial_backoff = std::chrono::milliseconds(100),
+      .max_backoff = std::chrono::milliseconds(300),
+      .jitter = 0.0,
+  };
+  EXPECT_EQ(policy.backoff(1), std::chrono::milliseconds(0));
+  EXPECT_EQ(policy.backoff(2), std::chrono::milliseconds(100));
+  EXPECT_EQ(policy.backoff(3), std::chrono::milliseconds(200));
+  EXPECT_EQ(policy.backoff(4), std::chrono::milliseconds(300));
+
+  const KmipIOException unsent(kmipcore::KMIP_IO_FAILURE, "refused", false);
+  const KmipIOException sent(kmipcore::KMIP_IO_FAILURE, "closed");
+  EXPECT_TRUE(policy.may_retry(false, unsent, 1));
+  EXPECT_FALSE(policy.may_retry(false, sent, 1));
+  EXPECT_TRUE(policy.may_retry(true, sent, 4));
+  EXPECT_FALSE(policy.may_retry(true, sent, 5));
+}
+
+TEST(RetryPolicyTest, IdempotentRequestIsResentOnNewConnection) {
+  StaleOnceNetClient nc;
+  KmipClient client(nc);
+  const auto request = make_request(client, kmipcore::GetRequest("id"));
+
+  EXPECT_THROW((void) client.exchange(request), KmipIOException);
+
+  nc.stale = true;
+  client.set_retry_policy({.max_attempts = 2});
+  EXPECT_NO_THROW((void) client.exchange(request));
+  EXPECT_EQ(nc.connect_calls, 2);
+  EXPECT_EQ(nc.received_requests.size(), 3u);
+}
+
+TEST(RetryPolicyTest, StateChangingRequestIsResentOnlyIfNothingWasSent) {
+  StaleOnceNetClient nc;
+  KmipClient client(nc);
+  client.set_retry_policy({.max_attempts = 3});
+  const auto request = make_request(client, kmipcore::ActivateRequest("id"));
+
+  try {
+    (void) client.exchange(request);
+    FAIL() << "a sent Activate must not be resent";
+  } catch (const KmipIOException &e) {
+    EXPECT_TRUE(e.bytes_sent());
+  }
+  EXPECT_EQ(nc.received_requests.size(), 1u);
+
+  nc.send_plan = {0};  // the next send makes no progress
+  EXPECT_NO_THROW((void) client.exchange(request));
+  EXPECT_EQ(nc.received_requests.size(), 2u);
+}
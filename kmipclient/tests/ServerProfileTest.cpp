@@ -0,0 +1,118 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/ServerProfile.hpp"
+
+#include "FakeNetClient.hpp"
+#include "kmipclient/KmipClient.hpp"
+#include "kmipcore/kmip_basics.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace kmipclient;
+using kmipcore::Element;
+using kmipcore::ProtocolVersion;
+
+namespace {
+
+  /// KMIP 1.4 server that rejects KMIP 2.0 Attribute References.
+  class LegacyServer : public test::FakeNetClient {
+  public:
+    LegacyServer() {
+      handler = [this](const kmipcore::RequestMessage &request) {
+        std::vector<kmipcore::ResponseBatchItem> items;
+        for (const auto &item : request.getBatchItems()) {
+          items.push_back(answer(item));
+        }
+        return test::make_response_message(request, std::move(items));
+      };
+      connect();
+    }
+
+    int get_attributes_calls = 0;
+
+  private:
+    kmipcore::ResponseBatchItem answer(const kmipcore::RequestBatchItem &item) {
+      auto payload =
+          Element::createStructure(kmipcore::tag::KMIP_TAG_RESPONSE_PAYLOAD);
+      switch (item.getOperation()) {
+        case kmipcore::KMIP_OP_DISCOVER_VERSIONS:
+          payload->asStructure()->add(ProtocolVersion(1, 4).toElement());
+          payload->asStructure()->add(ProtocolVersion(1, 2).toElement());
+          break;
+        case kmipcore::KMIP_OP_QUERY:
+          payload->asStructure()->add(Element::createEnumeration(
+              kmipcore::tag::KMIP_TAG_OPERATION, kmipcore::KMIP_OP_GET
+          ));
+          break;
+        case kmipcore::KMIP_OP_GET_ATTRIBUTES:
+          ++get_attributes_calls;
+          if (item.getRequestPayload()->getChild(
+                  kmipcore::tag::KMIP_TAG_ATTRIBUTE_REFERENCE
+              )) {
+            auto failed = test::make_success_item(item);
+            failed.setResultStatus(kmipcore::KMIP_STATUS_OPERATION_FAILED);
+            failed.setResultReason(kmipcore::KMIP_REASON_INVALID_FIELD);
+            return failed;
+          }
+          break;
+        default:
+          break;
+      }
+      return test::make_success_item(item, payload);
+    }
+  };
+
+}  // namespace
+
+TEST(ServerProfileTest, ChoosesHighestCommonVersion) {
+  const std::vector<ProtocolVersion> server{{1, 2}, {2, 0}, {1, 4}};
+  const auto chosen = ServerProfile::choose_version(server, {1, 4});
+  ASSERT_TRUE(chosen.has_value());
+  EXPECT_TRUE(chosen->is_at_least(1, 4));
+  EXPECT_FALSE(chosen->is_at_least(1, 5));
+  EXPECT_FALSE(ServerProfile::choose_version({{2, 1}}, {2, 0}).has_value());
+}
+
+TEST(ServerProfileTest, SharedProfileSkipsFailedAttributeEncoding) {
+  LegacyServer first_server;
+  KmipClient first(first_server, {}, kmipcore::KMIP_VERSION_2_0);
+  auto profile = std::make_shared<ServerProfile>();
+  first.set_server_profile(profile);
+
+  (void) first.op_get_attributes("id", {"State"});
+  EXPECT_EQ(first_server.get_attributes_calls, 2);
+  EXPECT_EQ(
+      profile->attribute_encoding(),
+      ServerProfile::AttributeEncoding::legacy_names
+  );
+
+  // Another client of the same endpoint goes straight to what worked.
+  LegacyServer second_server;
+  KmipClient second(second_server, {}, kmipcore::KMIP_VERSION_2_0);
+  second.set_server_profile(profile);
+  (void) second.op_get_attributes("id", {"State"});
+  EXPECT_EQ(second_server.get_attributes_calls, 1);
+
+  // Negotiation falls back to the server's highest version.
+  const auto version = second.negotiate_protocol_version();
+  EXPECT_EQ(version.getMajor(), 1);
+  EXPECT_EQ(version.getMinor(), 4);
+  EXPECT_EQ(profile->server_versions().size(), 2u);
+  EXPECT_TRUE(profile->supports(kmipcore::operation::KMIP_OP_GET));
+  EXPECT_FALSE(profile->supports(kmipcore::operation::KMIP_OP_CREATE));
+}
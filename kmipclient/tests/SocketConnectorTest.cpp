@@ -0,0 +1,135 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "../src/SocketConnector.hpp"
+
+#include "kmipclient/KmipIOException.hpp"
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace kmipclient;
+
+namespace {
+
+  // Listening IPv4 loopback socket on an ephemeral port.
+  class Listener {
+  public:
+    Listener() {
+      fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+      sockaddr_in addr{};
+      addr.sin_family = AF_INET;
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      socklen_t len = sizeof(addr);
+      if (::bind(fd_, reinterpret_cast<sockaddr *>(&addr), len) != 0 ||
+          ::listen(fd_, 4) != 0 ||
+          ::getsockname(fd_, reinterpret_cast<sockaddr *>(&addr), &len) != 0) {
+        ADD_FAILURE() << "unable to open loopback listener";
+      }
+      port_ = std::to_string(ntohs(addr.sin_port));
+    }
+    ~Listener() { ::close(fd_); }
+
+    [[nodiscard]] const std::string &port() const { return port_; }
+
+  private:
+    int fd_ = -1;
+    std::string port_;
+  };
+
+  SocketAddress ipv4(const char *ip, const std::string &port) {
+    SocketAddress address;
+    auto *in = reinterpret_cast<sockaddr_in *>(&address.storage);
+    in->sin_family = AF_INET;
+    in->sin_port = htons(static_cast<uint16_t>(std::stoi(port)));
+    inet_pton(AF_INET, ip, &in->sin_addr);
+    address.length = sizeof(sockaddr_in);
+    address.family = AF_INET;
+    return address;
+  }
+
+  SocketAddress ipv6(const char *ip, const std::string &port) {
+    SocketAddress address;
+    auto *in6 = reinterpret_cast<sockaddr_in6 *>(&address.storage);
+    in6->sin6_family = AF_INET6;
+    in6->sin6_port = htons(static_cast<uint16_t>(std::stoi(port)));
+    inet_pton(AF_INET6, ip, &in6->sin6_addr);
+    address.length = sizeof(sockaddr_in6);
+    address.family = AF_INET6;
+    return address;
+  }
+
+}  // namespace
+
+TEST(SocketConnectorTest, InterleavesAddressFamilies) {
+  const auto ordered = interleave_address_families({
+      ipv6("::1", "1"),
+      ipv6("::2", "1"),
+      ipv6("::3", "1"),
+      ipv4("10.0.0.1", "1"),
+  });
+  ASSERT_EQ(ordered.size(), 4u);
+  EXPECT_EQ(ordered[0].family, AF_INET6);
+  EXPECT_EQ(ordered[1].family, AF_INET);
+  EXPECT_EQ(ordered[2].family, AF_INET6);
+  EXPECT_EQ(ordered[3].family, AF_INET6);
+}
+
+TEST(SocketConnectorTest, FailedAttemptFallsThroughToNextAddress) {
+  Listener listener;
+  // Nothing listens on port 1, so the first attempt is refused and the
+  // listener must be reached without waiting for the attempt delay.
+  const auto started = std::chrono::steady_clock::now();
+  const int fd = connect_racing(
+      {ipv4("127.0.0.1", "1"), ipv4("127.0.0.1", listener.port())},
+      std::chrono::seconds(5),
+      2000
+  );
+  EXPECT_GE(fd, 0);
+  EXPECT_LT(
+      std::chrono::steady_clock::now() - started, std::chrono::seconds(2)
+  );
+  ::close(fd);
+}
+
+TEST(SocketConnectorTest, AllAddressesRefusedThrows) {
+  EXPECT_THROW(
+      (void) connect_racing(
+          {ipv4("127.0.0.1", "1"), ipv4("127.0.0.1", "2")},
+          std::chrono::milliseconds(10),
+          1000
+      ),
+      KmipIOException
+  );
+}
+
+TEST(SocketConnectorTest, ResolverCacheServesLiteralAddresses) {
+  auto &cache = ResolverCache::instance();
+  const auto first =
+      cache.resolve("127.0.0.1", "5696", std::chrono::seconds(30));
+  ASSERT_FALSE(first.empty());
+  EXPECT_EQ(first.front().family, AF_INET);
+  const auto second =
+      cache.resolve("127.0.0.1", "5696", std::chrono::seconds(30));
+  EXPECT_EQ(second.size(), first.size());
+  cache.invalidate("127.0.0.1", "5696");
+}
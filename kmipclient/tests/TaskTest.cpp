@@ -0,0 +1,116 @@
+/* Copyright (c) 2025 Percona LLC and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License
+   as published by the Free Software Foundation; version 2 of
+   the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "kmipclient/Task.hpp"
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+using kmipclient::Executor;
+using kmipclient::Task;
+
+namespace {
+
+  // Runs posted work only when drained, like a single-threaded event loop.
+  class QueueExecutor : public Executor {
+  public:
+    void post(std::function<void()> fn) override {
+      queue.push_back(std::move(fn));
+    }
+
+    void drain() {
+      while (!queue.empty()) {
+        auto fn = std::move(queue.front());
+        queue.pop_front();
+        fn();
+      }
+    }
+
+    std::deque<std::function<void()>> queue;
+  };
+
+  // Suspends the awaiting coroutine and resumes it from the executor.
+  struct Reschedule {
+    Executor &executor;
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> h) {
+      executor.post([h] { h.resume(); });
+    }
+    void await_resume() const noexcept {}
+  };
+
+  Task<int> answer(Executor &executor) {
+    co_await Reschedule{executor};
+    co_return 42;
+  }
+
+  Task<std::string> describe(Executor &executor) {
+    const int value = co_await answer(executor);
+    co_return "value=" + std::to_string(value);
+  }
+
+  Task<int> failing() {
+    throw std::runtime_error("boom");
+    co_return 0;
+  }
+
+  Task<void> observe_failure(bool &caught) {
+    try {
+      (void) co_await failing();
+    } catch (const std::runtime_error &) {
+      caught = true;
+    }
+  }
+
+}  // namespace
+
+TEST(TaskTest, NestedTasksCompleteThroughExecutor) {
+  QueueExecutor executor;
+  auto result = kmipclient::spawn(describe(executor));
+
+  EXPECT_EQ(result.wait_for(std::chrono::seconds(0)),
+            std::future_status::timeout);
+  executor.drain();
+  EXPECT_EQ(result.get(), "value=42");
+}
+
+TEST(TaskTest, ExceptionPropagatesToAwaiterAndFuture) {
+  bool caught = false;
+  kmipclient::spawn(observe_failure(caught)).get();
+  EXPECT_TRUE(caught);
+
+  EXPECT_THROW(kmipclient::spawn(failing()).get(), std::runtime_error);
+}
+
+TEST(TaskTest, SpawnOnExecutorDefersStart) {
+  QueueExecutor executor;
+  bool started = false;
+  auto body = [](bool &flag) -> Task<void> {
+    flag = true;
+    co_return;
+  };
+
+  auto result = kmipclient::spawn(executor, body(started));
+  EXPECT_FALSE(started);
+  executor.drain();
+  EXPECT_TRUE(started);
+  EXPECT_NO_THROW(result.get());
+}
@@ -377,6 +377,13 @@ namespace kmipcore {
     KMIP_NAME_URI = 0x02
   };
 
+  /** @brief Which members of an Object Group a Locate request returns. */
+  enum class object_group_member : std::uint32_t {
+    // KMIP 1.1
+    KMIP_GROUP_MEMBER_FRESH = 0x01,
+    KMIP_GROUP_MEMBER_DEFAULT = 0x02
+  };
+
   enum class object_type : std::uint32_t {
     // KMIP 1.0
     KMIP_OBJTYPE_CERTIFICATE = 0x01,
@@ -604,6 +611,15 @@ namespace kmipcore {
     KMIP_STATE_DESTROYED_COMPROMISED = 0x06
   };
 
+  /** @brief Storage Status Mask bits selecting where Locate searches. */
+  enum class storage_status_mask : std::uint32_t {
+    // KMIP 1.0
+    KMIP_STORAGE_ON_LINE = 0x01,
+    KMIP_STORAGE_ARCHIVAL = 0x02,
+    // KMIP 2.0
+    KMIP_STORAGE_DESTROYED = 0x04
+  };
+
   /** Convert a KMIP state enum value to a human-readable string. */
   inline const char *state_to_string(state value) {
     switch (value) {
@@ -804,6 +820,7 @@ namespace kmipcore {
     KMIP_TAG_DEACTIVATION_DATE = 0x42002F,
     KMIP_TAG_ENCRYPTION_KEY_INFORMATION = 0x420036,
     KMIP_TAG_HASHING_ALGORITHM = 0x420038,
+    KMIP_TAG_INITIAL_DATE = 0x420039,
     KMIP_TAG_IV_COUNTER_NONCE = 0x42003D,
     KMIP_TAG_KEY = 0x42003F,
     KMIP_TAG_KEY_BLOCK = 0x420040,
@@ -813,6 +830,7 @@ namespace kmipcore {
     KMIP_TAG_KEY_VALUE = 0x420045,
     KMIP_TAG_KEY_WRAPPING_DATA = 0x420046,
     KMIP_TAG_KEY_WRAPPING_SPECIFICATION = 0x420047,
+    KMIP_TAG_LAST_CHANGE_DATE = 0x420048,
     KMIP_TAG_MAC_SIGNATURE = 0x42004D,
     KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION = 0x42004E,
     KMIP_TAG_MAXIMUM_ITEMS = 0x42004F,
@@ -2189,6 +2207,8 @@ namespace kmipcore {
       static_cast<std::uint32_t>(tag::KMIP_TAG_ENCRYPTION_KEY_INFORMATION);
   inline constexpr std::uint32_t KMIP_TAG_HASHING_ALGORITHM =
       static_cast<std::uint32_t>(tag::KMIP_TAG_HASHING_ALGORITHM);
+  inline constexpr std::uint32_t KMIP_TAG_INITIAL_DATE =
+      static_cast<std::uint32_t>(tag::KMIP_TAG_INITIAL_DATE);
   inline constexpr std::uint32_t KMIP_TAG_IV_COUNTER_NONCE =
       static_cast<std::uint32_t>(tag::KMIP_TAG_IV_COUNTER_NONCE);
   inline constexpr std::uint32_t KMIP_TAG_KEY =
@@ -2207,6 +2227,8 @@ namespace kmipcore {
       static_cast<std::uint32_t>(tag::KMIP_TAG_KEY_WRAPPING_DATA);
   inline constexpr std::uint32_t KMIP_TAG_KEY_WRAPPING_SPECIFICATION =
       static_cast<std::uint32_t>(tag::KMIP_TAG_KEY_WRAPPING_SPECIFICATION);
+  inline constexpr std::uint32_t KMIP_TAG_LAST_CHANGE_DATE =
+      static_cast<std::uint32_t>(tag::KMIP_TAG_LAST_CHANGE_DATE);
   inline constexpr std::uint32_t KMIP_TAG_MAC_SIGNATURE =
       static_cast<std::uint32_t>(tag::KMIP_TAG_MAC_SIGNATURE);
   inline constexpr std::uint32_t KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION =
@@ -104,6 +104,18 @@ namespace kmipcore {
     void setBatchOrderOption(std::optional<bool> batchOrderOption) {
       batchOrderOption_ = batchOrderOption;
     }
+    /** @brief Returns optional batch error continuation option. */
+    [[nodiscard]] std::optional<int32_t>
+        getBatchErrorContinuationOption() const {
+      return batchErrorContinuationOption_;
+    }
+    /**
+     * @brief Sets optional batch error continuation option
+     * (KMIP_BATCH_CONTINUE, KMIP_BATCH_STOP or KMIP_BATCH_UNDO).
+     */
+    void setBatchErrorContinuationOption(std::optional<int32_t> option) {
+      batchErrorContinuationOption_ = option;
+    }
     /** @brief Returns optional authentication username. */
     [[nodiscard]] const std::optional<std::string> &getUserName() const {
       return userName_;
@@ -131,6 +143,7 @@ namespace kmipcore {
     std::optional<int32_t> maximumResponseSize_;
     std::optional<int64_t> timeStamp_;
     std::optional<bool> batchOrderOption_;
+    std::optional<int32_t> batchErrorContinuationOption_;
     std::optional<std::string> userName_;
     std::optional<std::string> password_;
   };
@@ -295,6 +308,19 @@ namespace kmipcore {
      * @return Assigned batch item id.
      */
     uint32_t add_batch_item(RequestBatchItem item);
+    /**
+     * @brief Adds a batch item that operates on the object of the preceding
+     * item through the ID Placeholder, e.g. Activate after Create.
+     *
+     * The item must carry no Unique Identifier (build it with
+     * ID_PLACEHOLDER instead of an identifier).  The message is switched to
+     * in-order processing that stops at the first failed item, so later
+     * items never run against a stale placeholder.
+     * @return Assigned batch item id.
+     * @throws KmipException when there is no preceding item or @p item
+     *         names its object.
+     */
+    uint32_t add_chained_batch_item(RequestBatchItem item);
     /** @brief Replaces all batch items and updates header batch count. */
     void setBatchItems(const std::vector<RequestBatchItem> &items);
     /** @brief Returns number of batch items in the message. */
@@ -306,6 +332,13 @@ namespace kmipcore {
       batchItems_.clear();
       nextBatchItemId_ = 1;
     }
+    /**
+     * @brief Sets the id assigned to the next added batch item.
+     *
+     * Lets callers that keep several messages in flight on one connection
+     * draw batch item ids from a connection-wide sequence.
+     */
+    void setNextBatchItemId(uint32_t id) { nextBatchItemId_ = id; }
 
 
     /** @brief Sets maximum response size hint in request header. */
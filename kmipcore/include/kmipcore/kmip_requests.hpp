@@ -6,9 +6,12 @@
 #include "kmipcore/kmip_enums.hpp"
 #include "kmipcore/kmip_protocol.hpp"
 
+#include <cstdint>
 #include <ctime>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace kmipcore {
@@ -19,6 +22,22 @@ namespace kmipcore {
   // ---------------------------------------------------------------------------
 
 
+  /**
+   * @brief Tag type selecting the ID Placeholder as target of a request.
+   *
+   * Requests built with ID_PLACEHOLDER instead of an identifier omit the
+   * Unique Identifier field, so the server uses the identifier produced by
+   * the preceding item of the same batch (Create, Register, Locate, ...).
+   * The batch must be processed in order, see
+   * RequestMessage::add_chained_batch_item().
+   */
+  struct IdPlaceholder {
+    explicit IdPlaceholder() = default;
+  };
+
+  /** @brief Refers to the ID Placeholder, see IdPlaceholder. */
+  inline constexpr IdPlaceholder ID_PLACEHOLDER{};
+
   // ---------------------------------------------------------------------------
   // Template for simple requests that only carry a unique identifier.
   // ---------------------------------------------------------------------------
@@ -32,12 +51,25 @@ namespace kmipcore {
      * @brief Builds a simple request payload with unique identifier.
      * @param unique_id KMIP unique identifier of target object.
      */
-    explicit SimpleIdRequest(const std::string &unique_id) {
+    explicit SimpleIdRequest(const std::string &unique_id)
+      : SimpleIdRequest(&unique_id) {}
+
+    /**
+     * @brief Builds a request on the object of the preceding batch item.
+     */
+    explicit SimpleIdRequest(IdPlaceholder) : SimpleIdRequest(nullptr) {}
+
+  private:
+    explicit SimpleIdRequest(const std::string *unique_id) {
       setOperation(OpCode);
       auto payload = Element::createStructure(tag::KMIP_TAG_REQUEST_PAYLOAD);
-      payload->asStructure()->add(
-          Element::createTextString(tag::KMIP_TAG_UNIQUE_IDENTIFIER, unique_id)
-      );
+      if (unique_id != nullptr) {
+        payload->asStructure()->add(
+            Element::createTextString(
+                tag::KMIP_TAG_UNIQUE_IDENTIFIER, *unique_id
+            )
+        );
+      }
       setRequestPayload(payload);
     }
   };
@@ -70,6 +102,34 @@ namespace kmipcore {
         const std::vector<std::string> &attribute_names,
         ProtocolVersion version = {},
         bool legacy_attribute_names_for_v2 = false
+    )
+      : GetAttributesRequest(
+            &unique_id,
+            attribute_names,
+            version,
+            legacy_attribute_names_for_v2
+        ) {}
+
+    /**
+     * @brief Builds Get Attributes request on the object of the preceding
+     * batch item; see the overload above for the other parameters.
+     */
+    GetAttributesRequest(
+        IdPlaceholder,
+        const std::vector<std::string> &attribute_names,
+        ProtocolVersion version = {},
+        bool legacy_attribute_names_for_v2 = false
+    )
+      : GetAttributesRequest(
+            nullptr, attribute_names, version, legacy_attribute_names_for_v2
+        ) {}
+
+  private:
+    GetAttributesRequest(
+        const std::string *unique_id,
+        const std::vector<std::string> &attribute_names,
+        ProtocolVersion version,
+        bool legacy_attribute_names_for_v2
     );
   };
 
@@ -152,9 +212,119 @@ namespace kmipcore {
     );
   };
 
+  /**
+   * @brief Server-side filter of a Locate request.
+   *
+   * Every criterion set narrows the result, so the server returns only the
+   * matching identifiers instead of the client filtering all of them:
+   * @code
+   * auto query = LocateQuery(object_type::KMIP_OBJTYPE_SYMMETRIC_KEY)
+   *     .in_group("tenant-7")
+   *     .in_state(state::KMIP_STATE_ACTIVE)
+   *     .with_algorithm(cryptographic_algorithm::KMIP_CRYPTOALG_AES)
+   *     .with_length(256);
+   * @endcode
+   * LocateRequest encodes the query as KMIP 1.x Attribute structures or as
+   * a KMIP 2.0 Attributes container.  Setters reject invalid values with
+   * KmipException.
+   */
+  class LocateQuery {
+  public:
+    /** @brief Matches objects of every type. */
+    LocateQuery() = default;
+
+    /** @brief Matches objects of type @p obj_type. */
+    explicit LocateQuery(object_type obj_type) : object_type_(obj_type) {}
+
+    /** @brief Object Type to match. */
+    LocateQuery &of_type(object_type obj_type);
+    /** @brief Name to match exactly; an empty name matches any. */
+    LocateQuery &named(const std::string &name);
+    /** @brief Object Group to match; an empty group matches any. */
+    LocateQuery &in_group(const std::string &group);
+    /** @brief Lifecycle State to match. */
+    LocateQuery &in_state(state value);
+    /** @brief Cryptographic Algorithm to match. */
+    LocateQuery &with_algorithm(cryptographic_algorithm algorithm);
+    /** @brief Cryptographic Length in bits to match; must be positive. */
+    LocateQuery &with_length(int32_t bits);
+
+    /** @name Date ranges
+     * Match objects whose date lies in [@p from, @p to], both inclusive;
+     * @p from must not be after @p to.
+     */
+    ///@{
+    LocateQuery &initial_date_between(time_t from, time_t to);
+    LocateQuery &activation_date_between(time_t from, time_t to);
+    LocateQuery &deactivation_date_between(time_t from, time_t to);
+    LocateQuery &last_change_date_between(time_t from, time_t to);
+    ///@}
+
+    /**
+     * @brief Custom text attribute to match.
+     * @param name Attribute name with the "x-" (client) or "y-" (server)
+     *        prefix; KMIP 2.0 sends the prefix as Vendor Identification.
+     */
+    LocateQuery &with_custom_attribute(
+        const std::string &name, const std::string &value
+    );
+
+    /**
+     * @brief Returns only the fresh or the default member of the group;
+     * requires in_group().
+     */
+    LocateQuery &group_member(object_group_member member);
+
+    /**
+     * @brief Storage the server searches, an OR of storage_status_mask bits;
+     * the server default is on-line objects only.
+     */
+    LocateQuery &storage_status(uint32_t mask);
+
+  private:
+    friend class LocateRequest;
+
+    /// Date attribute tag with the bounds of its range.
+    struct DateRange {
+      Tag tag;
+      const char *name;
+      time_t from;
+      time_t to;
+    };
+
+    LocateQuery &
+        add_date_range(Tag tag, const char *name, time_t from, time_t to);
+
+    std::optional<object_type> object_type_;
+    std::string name_;
+    std::string group_;
+    std::optional<state> state_;
+    std::optional<cryptographic_algorithm> algorithm_;
+    std::optional<int32_t> length_;
+    std::vector<DateRange> dates_;
+    std::vector<std::pair<std::string, std::string>> custom_;
+    std::optional<object_group_member> group_member_;
+    std::optional<uint32_t> storage_status_;
+  };
+
   /** @brief Request for KMIP Locate operation. */
   class LocateRequest : public RequestBatchItem {
   public:
+    /**
+     * @brief Builds a locate request from a typed query.
+     * @param query Criteria the server filters by.
+     * @param max_items Maximum number of items requested per locate call.
+     * @param offset Locate offset used for paged reads.
+     * @param version Protocol version; controls KMIP 2.0 Attributes vs 1.x
+     * Attribute format.
+     */
+    explicit LocateRequest(
+        const LocateQuery &query,
+        size_t max_items = 0,
+        size_t offset = 0,
+        ProtocolVersion version = {}
+    );
+
     /**
      * @brief Builds a locate request by name or group.
      * @param locate_by_group true to filter by Object Group, false by Name.
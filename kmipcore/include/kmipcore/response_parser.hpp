@@ -61,6 +61,12 @@ namespace kmipcore {
      * @param itemIdx Zero-based batch item index.
      */
     [[nodiscard]] bool isSuccess(int itemIdx);
+    /**
+     * @brief Returns the Unique Batch Item Id echoed by one batch item.
+     * @param itemIdx Zero-based batch item index.
+     * @return The echoed id, or 0 when the server omitted it.
+     */
+    [[nodiscard]] uint32_t getUniqueBatchItemId(int itemIdx);
 
     /**
      * @brief Returns operation status fields for one batch item.
@@ -102,6 +102,14 @@ namespace kmipcore {
           )
       );
     }
+    if (batchErrorContinuationOption_) {
+      structure->asStructure()->add(
+          Element::createEnumeration(
+              tag::KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION,
+              *batchErrorContinuationOption_
+          )
+      );
+    }
     if (batchOrderOption_) {
       structure->asStructure()->add(
           Element::createBoolean(
@@ -171,6 +179,11 @@ namespace kmipcore {
     if (batchOrderOption) {
       rh.batchOrderOption_ = batchOrderOption->toBool();
     }
+    auto batchErrorContinuationOption =
+        element->getChild(tag::KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION);
+    if (batchErrorContinuationOption) {
+      rh.batchErrorContinuationOption_ = batchErrorContinuationOption->toEnum();
+    }
     auto authentication = element->getChild(tag::KMIP_TAG_AUTHENTICATION);
     if (authentication) {
       auto credential = authentication->getChild(tag::KMIP_TAG_CREDENTIAL);
@@ -270,6 +283,24 @@ namespace kmipcore {
     return id;
   }
 
+  uint32_t RequestMessage::add_chained_batch_item(RequestBatchItem item) {
+    if (batchItems_.empty()) {
+      throw KmipException(
+          "RequestMessage: a chained batch item needs a preceding item"
+      );
+    }
+    if (const auto payload = item.getRequestPayload();
+        payload && payload->getChild(tag::KMIP_TAG_UNIQUE_IDENTIFIER)) {
+      throw KmipException(
+          "RequestMessage: a chained batch item must not carry a Unique "
+          "Identifier"
+      );
+    }
+    header_.setBatchOrderOption(true);
+    header_.setBatchErrorContinuationOption(KMIP_BATCH_STOP);
+    return add_batch_item(std::move(item));
+  }
+
   void RequestMessage::setBatchItems(
       const std::vector<RequestBatchItem> &items
   ) {
@@ -120,6 +120,20 @@ namespace kmipcore {
       attribute->asStructure()->add(attribute_value);
       return attribute;
     }
+    std::shared_ptr<Element> make_date_time_attribute(
+        const std::string &attribute_name, int64_t value
+    ) {
+      auto attribute = Element::createStructure(tag::KMIP_TAG_ATTRIBUTE);
+      attribute->asStructure()->add(
+          Element::createTextString(
+              tag::KMIP_TAG_ATTRIBUTE_NAME, attribute_name
+          )
+      );
+      attribute->asStructure()->add(
+          Element::createDateTime(tag::KMIP_TAG_ATTRIBUTE_VALUE, value)
+      );
+      return attribute;
+    }
     std::shared_ptr<Element> make_name_attribute(const std::string &value) {
       auto attribute_value =
           Element::createStructure(tag::KMIP_TAG_ATTRIBUTE_VALUE);
@@ -290,6 +304,30 @@ namespace kmipcore {
       return make_template_attribute(attributes);
     }
 
+    /**
+     * @brief Builds a KMIP 2.0 vendor Attribute for a custom attribute: the
+     *        "x"/"y" prefix of @p name becomes the Vendor Identification.
+     */
+    std::shared_ptr<Element> make_v2_custom_attribute(
+        const std::string &name, const std::string &value
+    ) {
+      auto attribute = Element::createStructure(tag::KMIP_TAG_ATTRIBUTE);
+      attribute->asStructure()->add(
+          Element::createTextString(
+              tag::KMIP_TAG_VENDOR_IDENTIFICATION, name.substr(0, 1)
+          )
+      );
+      attribute->asStructure()->add(
+          Element::createTextString(
+              tag::KMIP_TAG_ATTRIBUTE_NAME, name.substr(2)
+          )
+      );
+      attribute->asStructure()->add(
+          Element::createTextString(tag::KMIP_TAG_ATTRIBUTE_VALUE, value)
+      );
+      return attribute;
+    }
+
     // -------------------------------------------------------------------------
     // KMIP 2.0: helpers that build properly-typed child elements for the
     // Attributes container (no Attribute name/value wrappers).
@@ -446,16 +484,18 @@ namespace kmipcore {
   }  // namespace detail
 
   GetAttributesRequest::GetAttributesRequest(
-      const std::string &unique_id,
+      const std::string *unique_id,
       const std::vector<std::string> &attribute_names,
       ProtocolVersion version,
       bool legacy_attribute_names_for_v2
   ) {
     setOperation(KMIP_OP_GET_ATTRIBUTES);
     auto payload = Element::createStructure(tag::KMIP_TAG_REQUEST_PAYLOAD);
-    payload->asStructure()->add(
-        Element::createTextString(tag::KMIP_TAG_UNIQUE_IDENTIFIER, unique_id)
-    );
+    if (unique_id != nullptr) {
+      payload->asStructure()->add(
+          Element::createTextString(tag::KMIP_TAG_UNIQUE_IDENTIFIER, *unique_id)
+      );
+    }
 
     // Deduplicate selectors while preserving first-seen order.
     std::vector<std::string> unique_names;
@@ -730,6 +770,104 @@ namespace kmipcore {
     setRequestPayload(payload);
   }
 
+  // ---------------------------------------------------------------------------
+  // LocateQuery
+  // ---------------------------------------------------------------------------
+  LocateQuery &LocateQuery::of_type(object_type obj_type) {
+    object_type_ = obj_type;
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::named(const std::string &name) {
+    name_ = name;
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::in_group(const std::string &group) {
+    group_ = group;
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::in_state(state value) {
+    state_ = value;
+    return *this;
+  }
+
+  LocateQuery &
+      LocateQuery::with_algorithm(cryptographic_algorithm algorithm) {
+    algorithm_ = algorithm;
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::with_length(int32_t bits) {
+    if (bits <= 0) {
+      throw KmipException(
+          "LocateQuery: cryptographic length must be positive"
+      );
+    }
+    length_ = bits;
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::initial_date_between(time_t from, time_t to) {
+    return add_date_range(tag::KMIP_TAG_INITIAL_DATE, "Initial Date", from, to);
+  }
+
+  LocateQuery &LocateQuery::activation_date_between(time_t from, time_t to) {
+    return add_date_range(
+        tag::KMIP_TAG_ACTIVATION_DATE, "Activation Date", from, to
+    );
+  }
+
+  LocateQuery &LocateQuery::deactivation_date_between(time_t from, time_t to) {
+    return add_date_range(
+        tag::KMIP_TAG_DEACTIVATION_DATE, "Deactivation Date", from, to
+    );
+  }
+
+  LocateQuery &LocateQuery::last_change_date_between(time_t from, time_t to) {
+    return add_date_range(
+        tag::KMIP_TAG_LAST_CHANGE_DATE, "Last Change Date", from, to
+    );
+  }
+
+  LocateQuery &LocateQuery::with_custom_attribute(
+      const std::string &name, const std::string &value
+  ) {
+    if (name.size() < 3 || (name[0] != 'x' && name[0] != 'y') ||
+        name[1] != '-') {
+      throw KmipException(
+          "LocateQuery: custom attribute name '" + name +
+          "' must start with \"x-\" or \"y-\""
+      );
+    }
+    custom_.emplace_back(name, value);
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::group_member(object_group_member member) {
+    group_member_ = member;
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::storage_status(uint32_t mask) {
+    storage_status_ = mask;
+    return *this;
+  }
+
+  LocateQuery &LocateQuery::add_date_range(
+      Tag tag, const char *name, time_t from, time_t to
+  ) {
+    if (from > to) {
+      throw KmipException(
+          std::string("LocateQuery: ") + name + " range ends before it starts"
+      );
+    }
+    // Locate matches a date attribute given twice as the range between them.
+    dates_.push_back({tag, name, from, to});
+    return *this;
+  }
+
   // ---------------------------------------------------------------------------
   // LocateRequest
   // ---------------------------------------------------------------------------
@@ -740,6 +878,20 @@ namespace kmipcore {
       size_t max_items,
       size_t offset,
       ProtocolVersion version
+  )
+    : LocateRequest(
+          locate_by_group ? LocateQuery(obj_type).in_group(name)
+                          : LocateQuery(obj_type).named(name),
+          max_items,
+          offset,
+          version
+      ) {}
+
+  LocateRequest::LocateRequest(
+      const LocateQuery &query,
+      size_t max_items,
+      size_t offset,
+      ProtocolVersion version
   ) {
     setOperation(KMIP_OP_LOCATE);
 
@@ -757,6 +909,11 @@ namespace kmipcore {
           " exceeds int32_t maximum (" + std::to_string(int32_max) + ")"
       );
     }
+    if (query.group_member_ && query.group_.empty()) {
+      throw KmipException(
+          "LocateRequest: group_member requires an Object Group filter"
+      );
+    }
 
     auto payload = Element::createStructure(tag::KMIP_TAG_REQUEST_PAYLOAD);
     if (max_items > 0) {
@@ -773,41 +930,112 @@ namespace kmipcore {
           )
       );
     }
+    if (query.storage_status_) {
+      payload->asStructure()->add(
+          Element::createInteger(
+              tag::KMIP_TAG_STORAGE_STATUS_MASK,
+              static_cast<int32_t>(*query.storage_status_)
+          )
+      );
+    }
+    if (query.group_member_) {
+      payload->asStructure()->add(
+          Element::createEnumeration(
+              tag::KMIP_TAG_OBJECT_GROUP_MEMBER,
+              static_cast<int32_t>(*query.group_member_)
+          )
+      );
+    }
 
     if (detail::use_attributes_container(version)) {
       // KMIP 2.0: filter attributes go into an Attributes container with
       // properly typed child elements.
       auto attrs = Element::createStructure(tag::KMIP_TAG_ATTRIBUTES);
-      attrs->asStructure()->add(
-          Element::createEnumeration(
-              tag::KMIP_TAG_OBJECT_TYPE, static_cast<int32_t>(obj_type)
-          )
-      );
-      if (!name.empty()) {
-        if (locate_by_group) {
-          attrs->asStructure()->add(
-              Element::createTextString(tag::KMIP_TAG_OBJECT_GROUP, name)
-          );
-        } else {
-          attrs->asStructure()->add(detail::make_v2_name_struct(name));
-        }
+      if (query.object_type_) {
+        attrs->asStructure()->add(
+            Element::createEnumeration(
+                tag::KMIP_TAG_OBJECT_TYPE,
+                static_cast<int32_t>(*query.object_type_)
+            )
+        );
+      }
+      if (!query.group_.empty()) {
+        attrs->asStructure()->add(
+            Element::createTextString(tag::KMIP_TAG_OBJECT_GROUP, query.group_)
+        );
+      }
+      if (!query.name_.empty()) {
+        attrs->asStructure()->add(detail::make_v2_name_struct(query.name_));
+      }
+      if (query.state_) {
+        attrs->asStructure()->add(
+            Element::createEnumeration(
+                tag::KMIP_TAG_STATE, static_cast<int32_t>(*query.state_)
+            )
+        );
+      }
+      if (query.algorithm_) {
+        attrs->asStructure()->add(
+            Element::createEnumeration(
+                tag::KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM,
+                static_cast<int32_t>(*query.algorithm_)
+            )
+        );
+      }
+      if (query.length_) {
+        attrs->asStructure()->add(
+            Element::createInteger(
+                tag::KMIP_TAG_CRYPTOGRAPHIC_LENGTH, *query.length_
+            )
+        );
+      }
+      for (const auto &date : query.dates_) {
+        attrs->asStructure()->add(Element::createDateTime(date.tag, date.from));
+        attrs->asStructure()->add(Element::createDateTime(date.tag, date.to));
+      }
+      for (const auto &[name, value] : query.custom_) {
+        attrs->asStructure()->add(
+            detail::make_v2_custom_attribute(name, value)
+        );
       }
       payload->asStructure()->add(attrs);
     } else {
       // KMIP 1.x: individual Attribute structures directly in payload.
-      payload->asStructure()->add(
-          detail::make_enum_attribute(
-              "Object Type", static_cast<int32_t>(obj_type)
-          )
-      );
-      if (!name.empty()) {
-        if (locate_by_group) {
-          payload->asStructure()->add(
-              detail::make_text_attribute("Object Group", name)
-          );
-        } else {
-          payload->asStructure()->add(detail::make_name_attribute(name));
-        }
+      auto add = [&payload](std::shared_ptr<Element> attribute) {
+        payload->asStructure()->add(std::move(attribute));
+      };
+      if (query.object_type_) {
+        add(detail::make_enum_attribute(
+            "Object Type", static_cast<int32_t>(*query.object_type_)
+        ));
+      }
+      if (!query.group_.empty()) {
+        add(detail::make_text_attribute("Object Group", query.group_));
+      }
+      if (!query.name_.empty()) {
+        add(detail::make_name_attribute(query.name_));
+      }
+      if (query.state_) {
+        add(detail::make_enum_attribute(
+            "State", static_cast<int32_t>(*query.state_)
+        ));
+      }
+      if (query.algorithm_) {
+        add(detail::make_enum_attribute(
+            "Cryptographic Algorithm", static_cast<int32_t>(*query.algorithm_)
+        ));
+      }
+      if (query.length_) {
+        add(detail::make_integer_attribute(
+            "Cryptographic Length", *query.length_
+        ));
+      }
+      for (const auto &date : query.dates_) {
+        add(detail::make_date_time_attribute(date.name, date.from));
+        add(detail::make_date_time_attribute(date.name, date.to));
+      }
+      for (const auto &[name, value] : query.custom_) {
+        add(detail::make_text_attribute(name, value));
       }
     }
     setRequestPayload(payload);
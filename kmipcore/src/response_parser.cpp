@@ -63,6 +63,10 @@ namespace kmipcore {
     return getResponseItem(itemIdx).getResultStatus() == KMIP_STATUS_SUCCESS;
   }
 
+  uint32_t ResponseParser::getUniqueBatchItemId(int itemIdx) {
+    return getResponseItem(itemIdx).getUniqueBatchItemId();
+  }
+
   OperationResult ResponseParser::getOperationResult(int itemIdx) {
     const auto &item = getResponseItem(itemIdx);
     return OperationResult{
@@ -247,6 +247,7 @@ void test_request_message() {
   req.getHeader().getProtocolVersion().setMajor(1);
   req.getHeader().getProtocolVersion().setMinor(4);
   req.getHeader().setBatchOrderOption(true);
+  req.getHeader().setBatchErrorContinuationOption(KMIP_BATCH_CONTINUE);
 
   RequestBatchItem item;
   item.setOperation(KMIP_OP_GET);  // Some operation code
@@ -302,6 +303,10 @@ void test_request_message() {
   assert(req2.getHeader().getProtocolVersion().getMajor() == 1);
   assert(req2.getHeader().getBatchOrderOption().has_value());
   assert(req2.getHeader().getBatchOrderOption().value() == true);
+  assert(
+      req2.getHeader().getBatchErrorContinuationOption() ==
+      std::optional<int32_t>(KMIP_BATCH_CONTINUE)
+  );
   assert(req2.getBatchItems().size() == 2);
   assert(req2.getBatchItems()[0].getUniqueBatchItemId() == 1u);
   assert(req2.getBatchItems()[1].getUniqueBatchItemId() == 2u);
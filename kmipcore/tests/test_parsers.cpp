@@ -742,6 +742,84 @@ void test_get_attributes_request_encodes_per_protocol_version() {
             << std::endl;
 }
 
+void test_locate_query_encodes_per_protocol_version() {
+  const auto query =
+      LocateQuery(object_type::KMIP_OBJTYPE_SYMMETRIC_KEY)
+          .in_group("tenant-7")
+          .in_state(state::KMIP_STATE_ACTIVE)
+          .with_algorithm(cryptographic_algorithm::KMIP_CRYPTOALG_AES)
+          .with_length(256)
+          .activation_date_between(1000, 2000)
+          .with_custom_attribute("x-owner", "db")
+          .group_member(object_group_member::KMIP_GROUP_MEMBER_FRESH)
+          .storage_status(
+              static_cast<uint32_t>(storage_status_mask::KMIP_STORAGE_ON_LINE)
+          );
+
+  // KMIP 1.4: one Attribute per criterion, a date range as two of them.
+  {
+    LocateRequest req(query, 10, 0, ProtocolVersion(1, 4));
+    auto payload = req.getRequestPayload();
+    assert(payload->getChild(tag::KMIP_TAG_STORAGE_STATUS_MASK)->toInt() == 1);
+    assert(
+        payload->getChild(tag::KMIP_TAG_OBJECT_GROUP_MEMBER)->toEnum() ==
+        static_cast<int32_t>(object_group_member::KMIP_GROUP_MEMBER_FRESH)
+    );
+    const auto attrs = payload->getChildren(tag::KMIP_TAG_ATTRIBUTE);
+    assert(attrs.size() == 8);
+    assert(
+        attrs[3]->getChild(tag::KMIP_TAG_ATTRIBUTE_NAME)->toString() ==
+        "Cryptographic Algorithm"
+    );
+    assert(
+        attrs[5]->getChild(tag::KMIP_TAG_ATTRIBUTE_VALUE)->toLong() == 1000
+    );
+    assert(
+        attrs[6]->getChild(tag::KMIP_TAG_ATTRIBUTE_VALUE)->toLong() == 2000
+    );
+    assert(
+        attrs[7]->getChild(tag::KMIP_TAG_ATTRIBUTE_NAME)->toString() ==
+        "x-owner"
+    );
+    assert(payload->getChild(tag::KMIP_TAG_ATTRIBUTES) == nullptr);
+  }
+
+  // KMIP 2.0: typed elements in the Attributes container.
+  {
+    LocateRequest req(query, 10, 0, ProtocolVersion(2, 0));
+    auto payload = req.getRequestPayload();
+    assert(payload->getChild(tag::KMIP_TAG_OBJECT_GROUP_MEMBER) != nullptr);
+    assert(payload->getChildren(tag::KMIP_TAG_ATTRIBUTE).empty());
+    auto attrs = payload->getChild(tag::KMIP_TAG_ATTRIBUTES);
+    assert(attrs != nullptr);
+    assert(
+        attrs->getChild(tag::KMIP_TAG_STATE)->toEnum() == KMIP_STATE_ACTIVE
+    );
+    assert(
+        attrs->getChild(tag::KMIP_TAG_CRYPTOGRAPHIC_LENGTH)->toInt() == 256
+    );
+    assert(attrs->getChildren(tag::KMIP_TAG_ACTIVATION_DATE).size() == 2);
+    auto custom = attrs->getChild(tag::KMIP_TAG_ATTRIBUTE);
+    assert(
+        custom->getChild(tag::KMIP_TAG_VENDOR_IDENTIFICATION)->toString() ==
+        "x"
+    );
+    assert(
+        custom->getChild(tag::KMIP_TAG_ATTRIBUTE_NAME)->toString() == "owner"
+    );
+  }
+
+  bool threw = false;
+  try {
+    (void) LocateQuery().activation_date_between(2000, 1000);
+  } catch (const KmipException &) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "LocateQuery version-aware encoding test passed" << std::endl;
+}
+
 void test_get_attribute_list_response_supports_v2_attribute_reference() {
   auto payload = Element::createStructure(tag::KMIP_TAG_RESPONSE_PAYLOAD);
   payload->asStructure()->add(
@@ -907,6 +985,7 @@ int main() {
   test_attributes_parser_v2_typed();
   test_attributes_parser_legacy_wrapper_preserves_generic_types();
   test_get_attributes_request_encodes_per_protocol_version();
+  test_locate_query_encodes_per_protocol_version();
   test_get_attribute_list_response_supports_v2_attribute_reference();
   test_formatter_for_request_and_response();
   test_formatter_redacts_sensitive_fields();